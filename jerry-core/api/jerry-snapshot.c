@@ -57,6 +57,10 @@ snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
 
   flags |= (has_class ? JERRY_SNAPSHOT_HAS_CLASS_LITERAL : 0);
 
+#if JERRY_NAN_BOXING
+  flags |= JERRY_SNAPSHOT_EIGHT_BYTE_VALUE;
+#endif /* JERRY_NAN_BOXING */
+
   return flags;
 } /* snapshot_get_global_flags */
 
@@ -147,6 +151,19 @@ snapshot_add_compiled_code (const ecma_compiled_code_t *compiled_code_p, /**< co
     return 0;
   }
 
+#if JERRY_LAZY_FUNCTIONS
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+  {
+    compiled_code_p = parser_compile_lazy_function ((ecma_compiled_code_t *) compiled_code_p);
+
+    if (compiled_code_p == NULL)
+    {
+      globals_p->snapshot_error = ecma_create_exception_from_context ();
+      return 0;
+    }
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   JERRY_ASSERT ((globals_p->snapshot_buffer_write_offset & (JMEM_ALIGNMENT - 1)) == 0);
 
   if (globals_p->snapshot_buffer_write_offset > JERRY_SNAPSHOT_MAXIMUM_WRITE_OFFSET)
@@ -328,6 +345,19 @@ static_snapshot_add_compiled_code (const ecma_compiled_code_t *compiled_code_p,
     return 0;
   }
 
+#if JERRY_LAZY_FUNCTIONS
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+  {
+    compiled_code_p = parser_compile_lazy_function ((ecma_compiled_code_t *) compiled_code_p);
+
+    if (compiled_code_p == NULL)
+    {
+      globals_p->snapshot_error = ecma_create_exception_from_context ();
+      return 0;
+    }
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   JERRY_ASSERT ((globals_p->snapshot_buffer_write_offset & (JMEM_ALIGNMENT - 1)) == 0);
 
   if (globals_p->snapshot_buffer_write_offset >= JERRY_SNAPSHOT_MAXIMUM_WRITE_OFFSET)
@@ -962,9 +992,9 @@ jerry_exec_snapshot (const uint32_t *snapshot_p, /**< snapshot */
     script_p->source_name = source_name;
 #endif /* JERRY_SOURCE_NAME */
 
-#if JERRY_FUNCTION_TO_STRING
+#if JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS
     script_p->source_code = ecma_make_magic_string_value (LIT_MAGIC_STRING__EMPTY);
-#endif /* JERRY_FUNCTION_TO_STRING */
+#endif /* JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS */
 
     const uint8_t *literal_base_p = snapshot_data_p + header_p->lit_table_offset;
 
@@ -324,6 +324,42 @@ jerry_heap_gc (jerry_gc_mode_t mode) /**< operational mode */
   ecma_free_unused_memory (JMEM_PRESSURE_HIGH);
 } /* jerry_heap_gc */
 
+/**
+ * Perform a part of an incremental garbage collection cycle. A new cycle
+ * is started when no collection is in progress.
+ *
+ * Note:
+ *      at least ECMA_GC_STEP_SIZE objects are processed even if the budget is zero,
+ *      and the budget is measured by jerry_port_current_time
+ *
+ * @return true - if the garbage collection cycle is finished
+ *         false - otherwise
+ */
+bool
+jerry_heap_gc_step (uint32_t budget_us) /**< time budget in microseconds */
+{
+  jerry_assert_api_enabled ();
+
+#if JERRY_GC_INCREMENTAL
+  double deadline = jerry_port_current_time () + (double) budget_us / 1000.0;
+
+  while (!ecma_gc_step (ECMA_GC_STEP_SIZE))
+  {
+    if (jerry_port_current_time () >= deadline)
+    {
+      return false;
+    }
+  }
+
+  return true;
+#else /* !JERRY_GC_INCREMENTAL */
+  JERRY_UNUSED (budget_us);
+
+  ecma_gc_run ();
+  return true;
+#endif /* JERRY_GC_INCREMENTAL */
+} /* jerry_heap_gc_step */
+
 /**
  * Get heap memory stats.
  *
@@ -373,7 +409,7 @@ jerry_parse_common (void *source_p, /**< script source */
   {
     const uint32_t allowed_options =
       (JERRY_PARSE_STRICT_MODE | JERRY_PARSE_MODULE | JERRY_PARSE_HAS_ARGUMENT_LIST | JERRY_PARSE_HAS_SOURCE_NAME
-       | JERRY_PARSE_HAS_START | JERRY_PARSE_HAS_USER_VALUE);
+       | JERRY_PARSE_HAS_START | JERRY_PARSE_HAS_USER_VALUE | JERRY_PARSE_OPTIMIZE);
     uint32_t options = options_p->options;
 
     if ((options & ~allowed_options) != 0
@@ -403,6 +439,11 @@ jerry_parse_common (void *source_p, /**< script source */
   if (options_p != NULL)
   {
     parse_opts |= options_p->options & (JERRY_PARSE_STRICT_MODE | JERRY_PARSE_MODULE);
+
+    if (options_p->options & JERRY_PARSE_OPTIMIZE)
+    {
+      parse_opts |= ECMA_PARSE_INTERNAL_OPTIMIZE_BYTE_CODE;
+    }
   }
 
   if ((parse_opts & JERRY_PARSE_MODULE) != 0)
@@ -3620,6 +3661,7 @@ jerry_object_set_internal (jerry_value_t object, /**< object value */
     }
 
     value_p->value = ecma_make_object_value (internal_object_p);
+    ECMA_GC_REMEMBER_OBJECT (internal_object_p);
     ecma_deref_object (internal_object_p);
   }
   else
@@ -4174,6 +4216,9 @@ jerry_foreach_live_object (jerry_foreach_live_object_cb_t callback, /**< functio
 
   JERRY_ASSERT (callback != NULL);
 
+  /* The objects are not in a single list while a collection cycle is in progress. */
+  ecma_gc_finish_cycle ();
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -4211,6 +4256,9 @@ jerry_foreach_live_object_with_info (const jerry_object_native_info_t *native_in
 
   ecma_native_pointer_t *native_pointer_p;
 
+  /* The objects are not in a single list while a collection cycle is in progress. */
+  ecma_gc_finish_cycle ();
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -5897,9 +5945,11 @@ jerry_realm_set_this (jerry_value_t realm, /**< realm value */
     {
       ecma_global_object_t *global_object_p = (ecma_global_object_t *) object_p;
       global_object_p->this_binding = this_value;
+      ECMA_GC_REMEMBER_OBJECT (ecma_get_object_from_value (this_value));
 
       ecma_object_t *global_lex_env_p = ecma_create_object_lex_env (NULL, ecma_get_object_from_value (this_value));
 
+      ECMA_GC_REMEMBER_OBJECT (global_lex_env_p);
       ECMA_SET_NON_NULL_POINTER (global_object_p->global_env_cp, global_lex_env_p);
       global_object_p->global_scope_cp = global_object_p->global_env_cp;
 
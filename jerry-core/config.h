@@ -206,15 +206,78 @@
 #define JERRY_STACK_LIMIT (0)
 #endif /* !defined (JERRY_STACK_LIMIT) */
 
+/**
+ * Maximum number of backtracking steps of a single RegExp match attempt
+ *
+ * Patterns which cannot be matched by the linear time automaton (e.g. patterns
+ * with backreferences or lookaheads) are matched by backtracking. When the
+ * number of steps exceeds this limit, a RangeError is thrown.
+ *
+ * Default value: 0, unlimited
+ */
+#ifndef JERRY_REGEXP_STEP_LIMIT
+#define JERRY_REGEXP_STEP_LIMIT (0)
+#endif /* !defined (JERRY_REGEXP_STEP_LIMIT) */
+
 /**
  * Maximum depth of recursion during GC mark phase
  *
+ * The objects which are found deeper are pushed onto the GC mark stack.
+ *
  * Default value: 8
  */
 #ifndef JERRY_GC_MARK_LIMIT
 #define JERRY_GC_MARK_LIMIT (8)
 #endif /* !defined (JERRY_GC_MARK_LIMIT) */
 
+/**
+ * Number of objects in a segment of the GC mark stack
+ *
+ * The first segment is reserved in the engine context, the other segments
+ * are allocated on the heap. When no memory is available for a new segment,
+ * the objects are found by scanning the object list again.
+ *
+ * Default value: 256
+ */
+#ifndef JERRY_GC_MARK_STACK_SIZE
+#define JERRY_GC_MARK_STACK_SIZE (256)
+#endif /* !defined (JERRY_GC_MARK_STACK_SIZE) */
+
+/**
+ * Enable/Disable incremental garbage collection.
+ *
+ * When enabled, the jerry_heap_gc_step API function can spread a collection cycle
+ * over several calls, and write barriers keep the marking consistent while the
+ * engine runs between the steps.
+ *
+ * Allowed values:
+ *  0: Disable incremental garbage collection.
+ *  1: Enable incremental garbage collection.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_GC_INCREMENTAL
+#define JERRY_GC_INCREMENTAL 1
+#endif /* !defined (JERRY_GC_INCREMENTAL) */
+
+/**
+ * Enable/Disable generational garbage collection.
+ *
+ * When enabled, the objects allocated since the last collection form a young
+ * generation, which is collected without traversing the old objects when the
+ * heap usage limit is reached. A bitmap, which size is 1/64 of the heap, keeps
+ * track of the young objects which are not referenced by other objects.
+ *
+ * Allowed values:
+ *  0: Disable generational garbage collection.
+ *  1: Enable generational garbage collection.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_GC_GENERATIONAL
+#define JERRY_GC_GENERATIONAL 0
+#endif /* !defined (JERRY_GC_GENERATIONAL) */
+
 /**
  * Enable/Disable property lookup cache.
  *
@@ -228,6 +291,40 @@
 #define JERRY_LCACHE 1
 #endif /* !defined (JERRY_LCACHE) */
 
+/**
+ * Enable/Disable inline caching of property accesses in the vm.
+ *
+ * Property get / set instructions remember the position of the accessed
+ * property in the property list, so objects with the same layout can
+ * be accessed without a property lookup.
+ *
+ * Allowed values:
+ *  0: Disable property inline caches.
+ *  1: Enable property inline caches.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_VM_PROPERTY_CACHE
+#define JERRY_VM_PROPERTY_CACHE 1
+#endif /* !defined (JERRY_VM_PROPERTY_CACHE) */
+
+/**
+ * Enable/Disable stackless calls between byte code functions.
+ *
+ * When enabled, the frames of the called byte code functions are allocated
+ * on a vm managed stack and executed by the vm loop of the caller, so only
+ * calls crossing native code boundaries consume native stack space.
+ *
+ * Allowed values:
+ *  0: Call every function recursively.
+ *  1: Call byte code functions without recursion.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_VM_STACKLESS
+#define JERRY_VM_STACKLESS 1
+#endif /* !defined (JERRY_VM_STACKLESS) */
+
 /**
  * Enable/Disable function toString operation.
  *
@@ -254,6 +351,24 @@
 #define JERRY_LINE_INFO 0
 #endif /* !defined (JERRY_LINE_INFO) */
 
+/**
+ * Enable/Disable lazy compilation of function bodies.
+ *
+ * When enabled, the parser only records the source range of the inner
+ * functions of scripts, and their byte code is created when they are
+ * called the first time. Some syntax errors inside these functions are
+ * only reported by their first call.
+ *
+ * Allowed values:
+ *  0: Disable lazy function compilation.
+ *  1: Enable lazy function compilation.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_LAZY_FUNCTIONS
+#define JERRY_LAZY_FUNCTIONS 0
+#endif /* !defined (JERRY_LAZY_FUNCTIONS) */
+
 /**
  * Enable/Disable logging inside the engine.
  *
@@ -309,6 +424,25 @@
 #define JERRY_NUMBER_TYPE_FLOAT64 1
 #endif /* !defined (JERRY_NUMBER_TYPE_FLOAT64 */
 
+/**
+ * Use 64-bit NaN-boxed ecma-values
+ * This option is for expert use only!
+ *
+ * When enabled, ecma-values (and jerry_value_t) are 64 bit wide and floating
+ * point numbers are stored inline in the value instead of being allocated on
+ * the heap. This increases memory consumption, but arithmetic on non-integer
+ * numbers does not allocate memory.
+ *
+ * Allowed values:
+ *  0: use 32-bit ecma-values, floating point numbers are allocated on the heap
+ *  1: use 64-bit ecma-values, floating point numbers are stored inline
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_NAN_BOXING
+#define JERRY_NAN_BOXING 0
+#endif /* !defined (JERRY_NAN_BOXING) */
+
 /**
  * Enable/Disable the JavaScript parser.
  *
@@ -350,6 +484,23 @@
 #define JERRY_PROPERTY_HASHMAP 1
 #endif /* !defined (JERRY_PROPERTY_HASHMAP) */
 
+/**
+ * Enable/Disable object shapes.
+ *
+ * Objects which have the same property names added in the same order
+ * share a shape, which stores the property names, so the objects only
+ * store the property types and values.
+ *
+ * Allowed values:
+ *  0: Disable object shapes.
+ *  1: Enable object shapes.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_OBJECT_SHAPES
+#define JERRY_OBJECT_SHAPES 1
+#endif /* !defined (JERRY_OBJECT_SHAPES) */
+
 /**
  * Enables/disables the Promise event callbacks
  *
@@ -462,6 +613,21 @@
 #define JERRY_VM_THROW 0
 #endif /* !defined (JERRY_VM_THROW) */
 
+/**
+ * Enable/Disable threaded dispatch in the vm loop.
+ *
+ * When enabled, the opcode handlers are reached through a table of label
+ * addresses (labels-as-values) instead of the switch statement. This
+ * requires a GCC compatible compiler.
+ *
+ * Allowed values:
+ *  0: Dispatch opcodes through a switch statement.
+ *  1: Dispatch opcodes through computed gotos.
+ */
+#ifndef JERRY_VM_THREADED_DISPATCH
+#define JERRY_VM_THREADED_DISPATCH 0
+#endif /* !defined (JERRY_VM_THREADED_DISPATCH) */
+
 /**
  * Advanced section configurations.
  */
@@ -598,18 +764,39 @@
 #if JERRY_STACK_LIMIT < 0
 #error "Invalid value for 'JERRY_STACK_LIMIT' macro."
 #endif /* JERRY_STACK_LIMIT < 0 */
+#if JERRY_REGEXP_STEP_LIMIT < 0
+#error "Invalid value for 'JERRY_REGEXP_STEP_LIMIT' macro."
+#endif /* JERRY_REGEXP_STEP_LIMIT < 0 */
 #if JERRY_GC_MARK_LIMIT < 0
 #error "Invalid value for 'JERRY_GC_MARK_LIMIT' macro."
 #endif /* JERRY_GC_MARK_LIMIT < 0 */
+#if JERRY_GC_MARK_STACK_SIZE < 1
+#error "Invalid value for 'JERRY_GC_MARK_STACK_SIZE' macro."
+#endif /* JERRY_GC_MARK_STACK_SIZE < 1 */
+#if (JERRY_GC_INCREMENTAL != 0) && (JERRY_GC_INCREMENTAL != 1)
+#error "Invalid value for 'JERRY_GC_INCREMENTAL' macro."
+#endif /* (JERRY_GC_INCREMENTAL != 0) && (JERRY_GC_INCREMENTAL != 1) */
+#if (JERRY_GC_GENERATIONAL != 0) && (JERRY_GC_GENERATIONAL != 1)
+#error "Invalid value for 'JERRY_GC_GENERATIONAL' macro."
+#endif /* (JERRY_GC_GENERATIONAL != 0) && (JERRY_GC_GENERATIONAL != 1) */
 #if (JERRY_LCACHE != 0) && (JERRY_LCACHE != 1)
 #error "Invalid value for 'JERRY_LCACHE' macro."
 #endif /* (JERRY_LCACHE != 0) && (JERRY_LCACHE != 1) */
+#if (JERRY_VM_PROPERTY_CACHE != 0) && (JERRY_VM_PROPERTY_CACHE != 1)
+#error "Invalid value for 'JERRY_VM_PROPERTY_CACHE' macro."
+#endif /* (JERRY_VM_PROPERTY_CACHE != 0) && (JERRY_VM_PROPERTY_CACHE != 1) */
+#if (JERRY_VM_STACKLESS != 0) && (JERRY_VM_STACKLESS != 1)
+#error "Invalid value for 'JERRY_VM_STACKLESS' macro."
+#endif /* (JERRY_VM_STACKLESS != 0) && (JERRY_VM_STACKLESS != 1) */
 #if (JERRY_FUNCTION_TO_STRING != 0) && (JERRY_FUNCTION_TO_STRING != 1)
 #error "Invalid value for 'JERRY_FUNCTION_TO_STRING' macro."
 #endif /* (JERRY_FUNCTION_TO_STRING != 0) && (JERRY_FUNCTION_TO_STRING != 1) */
 #if (JERRY_LINE_INFO != 0) && (JERRY_LINE_INFO != 1)
 #error "Invalid value for 'JERRY_LINE_INFO' macro."
 #endif /* (JERRY_LINE_INFO != 0) && (JERRY_LINE_INFO != 1) */
+#if (JERRY_LAZY_FUNCTIONS != 0) && (JERRY_LAZY_FUNCTIONS != 1)
+#error "Invalid value for 'JERRY_LAZY_FUNCTIONS' macro."
+#endif /* (JERRY_LAZY_FUNCTIONS != 0) && (JERRY_LAZY_FUNCTIONS != 1) */
 #if (JERRY_LOGGING != 0) && (JERRY_LOGGING != 1)
 #error "Invalid value for 'JERRY_LOGGING' macro."
 #endif /* (JERRY_LOGGING != 0) && (JERRY_LOGGING != 1) */
@@ -622,6 +809,9 @@
 #if (JERRY_NUMBER_TYPE_FLOAT64 != 0) && (JERRY_NUMBER_TYPE_FLOAT64 != 1)
 #error "Invalid value for 'JERRY_NUMBER_TYPE_FLOAT64' macro."
 #endif /* (JERRY_NUMBER_TYPE_FLOAT64 != 0) && (JERRY_NUMBER_TYPE_FLOAT64 != 1) */
+#if (JERRY_NAN_BOXING != 0) && (JERRY_NAN_BOXING != 1)
+#error "Invalid value for 'JERRY_NAN_BOXING' macro."
+#endif /* (JERRY_NAN_BOXING != 0) && (JERRY_NAN_BOXING != 1) */
 #if (JERRY_PARSER != 0) && (JERRY_PARSER != 1)
 #error "Invalid value for 'JERRY_PARSER' macro."
 #endif /* (JERRY_PARSER != 0) && (JERRY_PARSER != 1) */
@@ -631,6 +821,9 @@
 #if (JERRY_PROPERTY_HASHMAP != 0) && (JERRY_PROPERTY_HASHMAP != 1)
 #error "Invalid value for 'JERRY_PROPERTY_HASHMAP' macro."
 #endif /* (JERRY_PROPERTY_HASHMAP != 0) && (JERRY_PROPERTY_HASHMAP != 1) */
+#if (JERRY_OBJECT_SHAPES != 0) && (JERRY_OBJECT_SHAPES != 1)
+#error "Invalid value for 'JERRY_OBJECT_SHAPES' macro."
+#endif /* (JERRY_OBJECT_SHAPES != 0) && (JERRY_OBJECT_SHAPES != 1) */
 #if (JERRY_PROMISE_CALLBACK != 0) && (JERRY_PROMISE_CALLBACK != 1)
 #error "Invalid value for 'JERRY_PROMISE_CALLBACK' macro."
 #endif /* (JERRY_PROMISE_CALLBACK != 0) && (JERRY_PROMISE_CALLBACK != 1) */
@@ -661,6 +854,12 @@
 #if (JERRY_VM_THROW != 0) && (JERRY_VM_THROW != 1)
 #error "Invalid value for 'JERRY_VM_THROW' macro."
 #endif /* (JERRY_VM_THROW != 0) && (JERRY_VM_THROW != 1) */
+#if (JERRY_VM_THREADED_DISPATCH != 0) && (JERRY_VM_THREADED_DISPATCH != 1)
+#error "Invalid value for 'JERRY_VM_THREADED_DISPATCH' macro."
+#endif /* (JERRY_VM_THREADED_DISPATCH != 0) && (JERRY_VM_THREADED_DISPATCH != 1) */
+#if JERRY_VM_THREADED_DISPATCH && !defined(__GNUC__)
+#error "Threaded dispatch ('JERRY_VM_THREADED_DISPATCH') requires a GCC compatible compiler."
+#endif /* JERRY_VM_THREADED_DISPATCH && !defined(__GNUC__) */
 
 /**
  * Cross component requirements check.
@@ -673,6 +872,23 @@
 #error "Date does not support float32"
 #endif /* JERRY_BUILTIN_DATE && !JERRY_NUMBER_TYPE_FLOAT64 */
 
+/**
+ * Function bodies are compiled lazily by the JavaScript parser.
+ */
+#if JERRY_LAZY_FUNCTIONS && !JERRY_PARSER
+#error "Lazy function compilation ('JERRY_LAZY_FUNCTIONS') requires the JavaScript parser."
+#endif /* JERRY_LAZY_FUNCTIONS && !JERRY_PARSER */
+#if JERRY_LAZY_FUNCTIONS && JERRY_DEBUGGER
+#error "Lazy function compilation ('JERRY_LAZY_FUNCTIONS') cannot be used with the debugger."
+#endif /* JERRY_LAZY_FUNCTIONS && JERRY_DEBUGGER */
+
+/**
+ * The young generation is tracked by a bitmap, which covers the JerryScript heap.
+ */
+#if JERRY_GC_GENERATIONAL && JERRY_SYSTEM_ALLOCATOR
+#error "Generational garbage collection ('JERRY_GC_GENERATIONAL') requires the JerryScript heap."
+#endif /* JERRY_GC_GENERATIONAL && JERRY_SYSTEM_ALLOCATOR */
+
 /**
  * Source name related types into a single guard
  */
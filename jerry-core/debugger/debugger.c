@@ -23,6 +23,7 @@
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-objects.h"
+#include "ecma-shape.h"
 
 #include "byte-code.h"
 #include "jcontext.h"
@@ -461,6 +462,15 @@ jerry_debugger_send_scope_variables (const uint8_t *recv_buffer_p) /**< pointer
       ecma_fast_array_convert_to_normal (binding_obj_p);
     }
 
+#if JERRY_OBJECT_SHAPES
+    if (binding_obj_p->u1.property_list_cp != JMEM_CP_NULL
+        && (ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, binding_obj_p->u1.property_list_cp)->types[0]
+            == ECMA_PROPERTY_TYPE_SHAPE))
+    {
+      ecma_shape_convert_to_property_list (binding_obj_p, NULL);
+    }
+#endif /* JERRY_OBJECT_SHAPES */
+
     prop_iter_cp = binding_obj_p->u1.property_list_cp;
   }
 
@@ -26,8 +26,13 @@ JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) == sizeof (ecma_value_t),
 JERRY_STATIC_ASSERT (((sizeof (ecma_property_value_t) - 1) & sizeof (ecma_property_value_t)) == 0,
                      size_of_ecma_property_value_t_must_be_power_of_2);
 
+#if JERRY_NAN_BOXING
+JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= 2 * sizeof (ecma_value_t),
+                     size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_2_values);
+#else /* !JERRY_NAN_BOXING */
 JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= sizeof (uint64_t),
                      size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_8_bytes);
+#endif /* JERRY_NAN_BOXING */
 
 /** \addtogroup ecma ECMA
  * @{
@@ -112,7 +117,7 @@ ecma_alloc_extended_object (size_t size) /**< size of object */
   jmem_stats_allocate_object_bytes (size);
 #endif /* JERRY_MEM_STATS */
 
-  return jmem_heap_alloc_block (size);
+  return jmem_pools_alloc (size);
 } /* ecma_alloc_extended_object */
 
 /**
@@ -128,7 +133,7 @@ ecma_dealloc_extended_object (ecma_object_t *object_p, /**< extended object */
   jmem_stats_free_object_bytes (size);
 #endif /* JERRY_MEM_STATS */
 
-  jmem_heap_free_block (object_p, size);
+  jmem_pools_free (object_p, size);
 } /* ecma_dealloc_extended_object */
 
 /**
@@ -173,7 +178,7 @@ ecma_alloc_extended_string (void)
   jmem_stats_allocate_string_bytes (sizeof (ecma_extended_string_t));
 #endif /* JERRY_MEM_STATS */
 
-  return (ecma_extended_string_t *) jmem_heap_alloc_block (sizeof (ecma_extended_string_t));
+  return (ecma_extended_string_t *) jmem_pools_alloc (sizeof (ecma_extended_string_t));
 } /* ecma_alloc_extended_string */
 
 /**
@@ -188,7 +193,7 @@ ecma_dealloc_extended_string (ecma_extended_string_t *ext_string_p) /**< extende
   jmem_stats_free_string_bytes (sizeof (ecma_extended_string_t));
 #endif /* JERRY_MEM_STATS */
 
-  jmem_heap_free_block (ext_string_p, sizeof (ecma_extended_string_t));
+  jmem_pools_free (ext_string_p, sizeof (ecma_extended_string_t));
 } /* ecma_dealloc_extended_string */
 
 /**
@@ -203,7 +208,7 @@ ecma_alloc_external_string (void)
   jmem_stats_allocate_string_bytes (sizeof (ecma_external_string_t));
 #endif /* JERRY_MEM_STATS */
 
-  return (ecma_external_string_t *) jmem_heap_alloc_block (sizeof (ecma_external_string_t));
+  return (ecma_external_string_t *) jmem_pools_alloc (sizeof (ecma_external_string_t));
 } /* ecma_alloc_external_string */
 
 /**
@@ -218,7 +223,7 @@ ecma_dealloc_external_string (ecma_external_string_t *ext_string_p) /**< externa
   jmem_stats_free_string_bytes (sizeof (ecma_external_string_t));
 #endif /* JERRY_MEM_STATS */
 
-  jmem_heap_free_block (ext_string_p, sizeof (ecma_external_string_t));
+  jmem_pools_free (ext_string_p, sizeof (ecma_external_string_t));
 } /* ecma_dealloc_external_string */
 
 /**
@@ -264,7 +269,7 @@ ecma_alloc_property_pair (void)
   jmem_stats_allocate_property_bytes (sizeof (ecma_property_pair_t));
 #endif /* JERRY_MEM_STATS */
 
-  return jmem_heap_alloc_block (sizeof (ecma_property_pair_t));
+  return jmem_pools_alloc (sizeof (ecma_property_pair_t));
 } /* ecma_alloc_property_pair */
 
 /**
@@ -279,7 +284,7 @@ ecma_dealloc_property_pair (ecma_property_pair_t *property_pair_p) /**< property
   jmem_stats_free_property_bytes (sizeof (ecma_property_pair_t));
 #endif /* JERRY_MEM_STATS */
 
-  jmem_heap_free_block (property_pair_p, sizeof (ecma_property_pair_t));
+  jmem_pools_free (property_pair_p, sizeof (ecma_property_pair_t));
 } /* ecma_dealloc_property_pair */
 
 /**
@@ -200,6 +200,9 @@ ECMA_ERROR_DEF (ECMA_ERR_MODULE_NOT_SUPPORTED, "Module support is disabled")
 ECMA_ERROR_DEF (ECMA_ERR_OBJECT_IS_NOT_A_TYPEDARRAY, "Object is not a TypedArray")
 #endif /* JERRY_BUILTIN_TYPEDARRAY */
 ECMA_ERROR_DEF (ECMA_ERR_RECEIVER_MUST_BE_AN_OBJECT, "Receiver must be an object")
+#if JERRY_BUILTIN_REGEXP
+ECMA_ERROR_DEF (ECMA_ERR_REGEXP_STEP_LIMIT_EXCEEDED, "RegExp step limit exceeded")
+#endif /* JERRY_BUILTIN_REGEXP */
 #if JERRY_BUILTIN_BIGINT && JERRY_BUILTIN_JSON
 ECMA_ERROR_DEF (ECMA_ERR_BIGINT_SERIALIZED, "BigInt cannot be serialized")
 #endif /* JERRY_BUILTIN_BIGINT && JERRY_BUILTIN_JSON */
@@ -316,9 +319,9 @@ ECMA_ERROR_DEF (ECMA_ERR_FIRST_PARAMETER_MUST_BE_CALLABLE, "First parameter must
 ECMA_ERROR_DEF (ECMA_ERR_FUNCTION_ADD_ORSET_IS_NOT_CALLABLE, "Function add/set is not callable")
 #endif /* JERRY_BUILTIN_CONTAINER */
 ECMA_ERROR_DEF (ECMA_ERR_ITERATOR_RESULT_IS_NOT_AN_OBJECT, "Iterator result is not an object")
-#if (JERRY_STACK_LIMIT != 0)
+#if (JERRY_STACK_LIMIT != 0) || JERRY_VM_STACKLESS
 ECMA_ERROR_DEF (ECMA_ERR_MAXIMUM_CALL_STACK_SIZE_EXCEEDED, "Maximum call stack size exceeded")
-#endif /* (JERRY_STACK_LIMIT != 0) */
+#endif /* (JERRY_STACK_LIMIT != 0) || JERRY_VM_STACKLESS */
 ECMA_ERROR_DEF (ECMA_ERR_MAXIMUM_STRING_LENGTH_IS_REACHED, "Maximum string length is reached")
 #if JERRY_MODULE_SYSTEM
 ECMA_ERROR_DEF (ECMA_ERR_MODULE_MUST_BE_IN_UNLINKED_STATE, "Module must be in unlinked state")
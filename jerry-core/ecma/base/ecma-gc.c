@@ -31,6 +31,7 @@
 #include "ecma-objects.h"
 #include "ecma-property-hashmap.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 
 #include "jcontext.h"
 #include "jrt-bit-fields.h"
@@ -57,8 +58,19 @@
 
 /*
  * The garbage collector uses the reference counter
- * of object: it increases the counter by one when
- * the object is marked at the first time.
+ * of non-root objects as their color: white objects
+ * are not visited yet, gray objects are visited but
+ * their references are not marked, and marked objects
+ * are visited with all their references. These colors
+ * are above ECMA_OBJECT_MAX_REF, so the mutator can
+ * only reference colored objects through the slow
+ * path of ecma_ref_object_inline.
+ *
+ * The objects which are found beyond the recursion
+ * limit are pushed onto the mark stack. When no memory
+ * is available to grow the stack, the objects are
+ * colored gray, and they are found by scanning the
+ * list of the colored objects again.
  */
 
 /**
@@ -75,6 +87,102 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
   return (object_p->type_flags_refs < ECMA_OBJECT_NON_VISITED);
 } /* ecma_gc_is_object_visited */
 
+/**
+ * Set the color (or the reference count) of the object.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_set_object_color (ecma_object_t *object_p, /**< object */
+                          ecma_object_descriptor_t color) /**< new color */
+{
+  object_p->type_flags_refs =
+    (ecma_object_descriptor_t) ((object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1)) | color);
+} /* ecma_gc_set_object_color */
+
+/**
+ * Push a visited object onto a new segment of the mark stack.
+ *
+ * @return true  - if the object is pushed onto the stack
+ *         false - if the stack cannot grow, and the object must be found by scanning the colored objects
+ */
+static bool JERRY_ATTR_NOINLINE
+ecma_gc_push_object_to_new_segment (ecma_object_t *object_p) /**< object */
+{
+  ecma_gc_mark_segment_t *segment_p = JERRY_CONTEXT (ecma_gc_mark_segment_p);
+  ecma_gc_mark_segment_t *next_p = segment_p->next_p;
+
+  if (next_p == NULL)
+  {
+    next_p = (ecma_gc_mark_segment_t *) jmem_heap_alloc_block_without_gc (sizeof (ecma_gc_mark_segment_t));
+
+    if (next_p == NULL)
+    {
+      JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = true;
+      return false;
+    }
+
+    next_p->prev_p = segment_p;
+    next_p->next_p = NULL;
+    segment_p->next_p = next_p;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (next_p->objects[0], object_p);
+  JERRY_CONTEXT (ecma_gc_mark_segment_p) = next_p;
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 1;
+  return true;
+} /* ecma_gc_push_object_to_new_segment */
+
+/**
+ * Push a visited object onto the mark stack.
+ *
+ * @return true  - if the object is pushed onto the stack
+ *         false - if the stack cannot grow, and the object must be found by scanning the colored objects
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_push_object (ecma_object_t *object_p) /**< object */
+{
+  uint32_t top = JERRY_CONTEXT (ecma_gc_mark_stack_top);
+
+  if (JERRY_LIKELY (top < JERRY_GC_MARK_STACK_SIZE))
+  {
+    ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_mark_segment_p)->objects[top], object_p);
+    JERRY_CONTEXT (ecma_gc_mark_stack_top) = top + 1;
+    return true;
+  }
+
+  return ecma_gc_push_object_to_new_segment (object_p);
+} /* ecma_gc_push_object */
+
+/**
+ * Free the segments of the mark stack which are allocated on the heap.
+ */
+static void
+ecma_gc_free_mark_segments (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_segment_p) == &JERRY_CONTEXT (ecma_gc_mark_stack));
+
+  ecma_gc_mark_segment_t *segment_p = JERRY_CONTEXT (ecma_gc_mark_stack).next_p;
+
+  while (segment_p != NULL)
+  {
+    ecma_gc_mark_segment_t *next_p = segment_p->next_p;
+    jmem_heap_free_block (segment_p, sizeof (ecma_gc_mark_segment_t));
+    segment_p = next_p;
+  }
+
+  JERRY_CONTEXT (ecma_gc_mark_stack).next_p = NULL;
+} /* ecma_gc_free_mark_segments */
+
+/**
+ * Push a white object onto the mark stack, or color it gray if the stack cannot grow.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_push_white_object (ecma_object_t *object_p) /**< object */
+{
+  bool is_pushed = ecma_gc_push_object (object_p);
+  ecma_gc_set_object_color (object_p, is_pushed ? ECMA_OBJECT_GC_MARKED : ECMA_OBJECT_GC_GRAY);
+} /* ecma_gc_push_white_object */
+
 /**
  * Mark objects as visited starting from specified object as root
  */
@@ -82,6 +190,9 @@ static void ecma_gc_mark (ecma_object_t *object_p);
 
 /**
  * Set visited flag of the object.
+ *
+ * The references of the object are marked recursively until the recursion
+ * limit is reached, then the object is pushed onto the mark stack.
  */
 static void
 ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
@@ -92,24 +203,181 @@ ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
     if (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) != 0)
     {
       JERRY_CONTEXT (ecma_gc_mark_recursion_limit)--;
-      /* Set the reference count of gray object to 0 */
-      object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+      ecma_gc_set_object_color (object_p, ECMA_OBJECT_GC_MARKED);
       ecma_gc_mark (object_p);
       JERRY_CONTEXT (ecma_gc_mark_recursion_limit)++;
+      return;
     }
-    else
-    {
-      /* Set the reference count of the non-marked gray object to 1 */
-      object_p->type_flags_refs &= (ecma_object_descriptor_t) ((ECMA_OBJECT_REF_ONE << 1) - 1);
-      JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
-    }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-    /* Set the reference count of gray object to 0 */
-    object_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+    ecma_gc_push_white_object (object_p);
   }
 } /* ecma_gc_set_object_visited */
 
+#if JERRY_GC_INCREMENTAL
+
+/**
+ * Slow path of ecma_ref_object_inline: the mutator references an object
+ * colored by the current garbage collection cycle.
+ *
+ * The object gets a reference count, and it is marked as a root object.
+ */
+static void JERRY_ATTR_NOINLINE
+ecma_gc_ref_colored_object (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE);
+
+  bool is_white = !ecma_gc_is_object_visited (object_p);
+
+  ecma_gc_set_object_color (object_p, ECMA_OBJECT_REF_ONE);
+
+  if (is_white)
+  {
+    JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) >= ECMA_GC_PHASE_MARK_ROOTS);
+
+    /* If the stack cannot grow, the object is found by the scan of the colored
+     * objects, which marks the objects with reference count as well. */
+    ecma_gc_push_object (object_p);
+  }
+} /* ecma_gc_ref_colored_object */
+
+/**
+ * Write barrier: an object is stored into a property or an internal
+ * slot of another object while the objects are being marked.
+ *
+ * The stored object is pushed onto the mark stack unless it is already visited.
+ */
+void
+ecma_gc_write_barrier (ecma_object_t *object_p) /**< stored object */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) >= ECMA_GC_PHASE_MARK_ROOTS);
+
+  if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
+  {
+    ecma_gc_push_white_object (object_p);
+  }
+} /* ecma_gc_write_barrier */
+
+/**
+ * Checks whether the object is found unreachable by the current
+ * garbage collection cycle, and it is waiting to be freed.
+ *
+ * Note:
+ *      weak references must not return such objects
+ *
+ * @return true  - if the object is unreachable
+ *         false - otherwise
+ */
+bool
+ecma_gc_is_object_unreachable (ecma_object_t *object_p) /**< object */
+{
+#if JERRY_GC_GENERATIONAL
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MINOR)
+  {
+    return object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED;
+  }
+#endif /* JERRY_GC_GENERATIONAL */
+
+  return (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP
+          && object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED);
+} /* ecma_gc_is_object_unreachable */
+
+#endif /* JERRY_GC_INCREMENTAL */
+
+#if JERRY_GC_GENERATIONAL
+
+/**
+ * Size of the young object bitmap
+ */
+#define ECMA_GC_YOUNG_BITMAP_SIZE \
+  ((((size_t) JMEM_HEAP_AREA_SIZE >> JMEM_ALIGNMENT_LOG) + JERRY_BITSINBYTE - 1) / JERRY_BITSINBYTE)
+
+/**
+ * Get the index of the bit of an object in the young object bitmap
+ */
+#define ECMA_GC_YOUNG_BITMAP_INDEX(object_p) \
+  ((size_t) ((uint8_t *) (object_p) - JERRY_HEAP_CONTEXT (area)) >> JMEM_ALIGNMENT_LOG)
+
+/**
+ * Get the byte of an object in the young object bitmap
+ */
+#define ECMA_GC_YOUNG_BITMAP_BYTE(index) (JERRY_CONTEXT (ecma_gc_young_bitmap_p)[(index) / JERRY_BITSINBYTE])
+
+/**
+ * Get the bit of an object in the byte of the young object bitmap
+ */
+#define ECMA_GC_YOUNG_BITMAP_BIT(index) ((uint8_t) (1u << ((index) % JERRY_BITSINBYTE)))
+
+/**
+ * Checks whether a young object is neither remembered nor referenced by the old objects.
+ *
+ * @return true  - if the object can be freed by a minor collection
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_is_young_object (ecma_object_t *object_p) /**< object */
+{
+  size_t index = ECMA_GC_YOUNG_BITMAP_INDEX (object_p);
+
+  return (ECMA_GC_YOUNG_BITMAP_BYTE (index) & ECMA_GC_YOUNG_BITMAP_BIT (index)) != 0;
+} /* ecma_gc_is_young_object */
+
+/**
+ * Write barrier of the generational collector: an object is stored into
+ * a property or an internal slot of another object.
+ *
+ * The object is added to the remembered set, so it is a root of the next minor
+ * collection, and it is promoted to the old generation. Calling the function
+ * with an old object has no effect.
+ */
+void
+ecma_gc_remember_object (ecma_object_t *object_p) /**< stored object */
+{
+  size_t index = ECMA_GC_YOUNG_BITMAP_INDEX (object_p);
+
+  ECMA_GC_YOUNG_BITMAP_BYTE (index) &= (uint8_t) ~ECMA_GC_YOUNG_BITMAP_BIT (index);
+} /* ecma_gc_remember_object */
+
+/**
+ * Write barrier of the generational collector for a stored value.
+ */
+void
+ecma_gc_remember_value (ecma_value_t value) /**< stored value */
+{
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_remember_object (ecma_get_object_from_value (value));
+  }
+} /* ecma_gc_remember_value */
+
+/**
+ * Initialize the young generation.
+ */
+void
+ecma_gc_init_young_generation (void)
+{
+  uint8_t *bitmap_p = (uint8_t *) jmem_heap_alloc_block (ECMA_GC_YOUNG_BITMAP_SIZE);
+  memset (bitmap_p, 0, ECMA_GC_YOUNG_BITMAP_SIZE);
+
+  JERRY_CONTEXT (ecma_gc_young_bitmap_p) = bitmap_p;
+  JERRY_CONTEXT (ecma_gc_old_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_promoted_objects) = 0;
+} /* ecma_gc_init_young_generation */
+
+/**
+ * Finalize the young generation.
+ */
+void
+ecma_gc_finalize_young_generation (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_cp) == JMEM_CP_NULL);
+
+  jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_young_bitmap_p), ECMA_GC_YOUNG_BITMAP_SIZE);
+  JERRY_CONTEXT (ecma_gc_young_bitmap_p) = NULL;
+} /* ecma_gc_finalize_young_generation */
+
+#endif /* JERRY_GC_GENERATIONAL */
+
 /**
  * Initialize GC information for the object
  */
@@ -119,6 +387,11 @@ ecma_init_gc_info (ecma_object_t *object_p) /**< object */
   JERRY_CONTEXT (ecma_gc_objects_number)++;
   JERRY_CONTEXT (ecma_gc_new_objects)++;
 
+#if JERRY_GC_GENERATIONAL
+  size_t index = ECMA_GC_YOUNG_BITMAP_INDEX (object_p);
+  ECMA_GC_YOUNG_BITMAP_BYTE (index) |= ECMA_GC_YOUNG_BITMAP_BIT (index);
+#endif /* JERRY_GC_GENERATIONAL */
+
   JERRY_ASSERT (object_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
   object_p->type_flags_refs |= ECMA_OBJECT_REF_ONE;
 
@@ -138,6 +411,12 @@ ecma_ref_object_inline (ecma_object_t *object_p) /**< object */
   {
     object_p->type_flags_refs = (ecma_object_descriptor_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
   }
+#if JERRY_GC_INCREMENTAL
+  else if (object_p->type_flags_refs >= ECMA_OBJECT_GC_MARKED)
+  {
+    ecma_gc_ref_colored_object (object_p);
+  }
+#endif /* JERRY_GC_INCREMENTAL */
   else
   {
     jerry_fatal (JERRY_FATAL_REF_COUNT_LIMIT);
@@ -227,6 +506,49 @@ ecma_gc_mark_arguments_object (ecma_extended_object_t *ext_object_p) /**< argume
   }
 } /* ecma_gc_mark_arguments_object */
 
+#if JERRY_OBJECT_SHAPES
+
+/**
+ * Mark referenced objects from the properties of an object which has a shape
+ */
+static void
+ecma_gc_mark_shaped_properties (ecma_shape_property_list_t *list_p) /**< property list */
+{
+  ecma_shape_property_pair_t *pairs_p = ECMA_SHAPE_GET_PAIRS (list_p);
+  uint32_t property_count = ECMA_SHAPE_FROM_LIST (list_p)->property_count;
+
+  for (uint32_t index = 0; index < property_count; index++)
+  {
+    ecma_property_t property = *ECMA_SHAPE_GET_PROPERTY (pairs_p, index);
+    ecma_property_value_t *value_p = ECMA_SHAPE_GET_PROPERTY_VALUE (pairs_p, index);
+
+    JERRY_ASSERT (ECMA_PROPERTY_IS_RAW (property));
+
+    if (property & ECMA_PROPERTY_FLAG_DATA)
+    {
+      if (ecma_is_value_object (value_p->value))
+      {
+        ecma_gc_set_object_visited (ecma_get_object_from_value (value_p->value));
+      }
+      continue;
+    }
+
+    ecma_getter_setter_pointers_t *get_set_pair_p = ecma_get_named_accessor_property (value_p);
+
+    if (get_set_pair_p->getter_cp != JMEM_CP_NULL)
+    {
+      ecma_gc_set_object_visited (ECMA_GET_NON_NULL_POINTER (ecma_object_t, get_set_pair_p->getter_cp));
+    }
+
+    if (get_set_pair_p->setter_cp != JMEM_CP_NULL)
+    {
+      ecma_gc_set_object_visited (ECMA_GET_NON_NULL_POINTER (ecma_object_t, get_set_pair_p->setter_cp));
+    }
+  }
+} /* ecma_gc_mark_shaped_properties */
+
+#endif /* JERRY_OBJECT_SHAPES */
+
 /**
  * Mark referenced object from property
  */
@@ -242,6 +564,18 @@ ecma_gc_mark_properties (ecma_object_t *object_p, /**< object */
 
   jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
 
+#if JERRY_OBJECT_SHAPES
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      ecma_gc_mark_shaped_properties ((ecma_shape_property_list_t *) prop_iter_p);
+      return;
+    }
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
 #if JERRY_PROPERTY_HASHMAP
   if (prop_iter_cp != JMEM_CP_NULL)
   {
@@ -1660,6 +1994,18 @@ ecma_gc_free_properties (ecma_object_t *object_p, /**< object */
 {
   jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
 
+#if JERRY_OBJECT_SHAPES
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      ecma_shape_free_properties (object_p);
+      return;
+    }
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
 #if JERRY_PROPERTY_HASHMAP
   if (prop_iter_cp != JMEM_CP_NULL)
   {
@@ -2110,14 +2456,30 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 } /* ecma_gc_free_object */
 
 /**
- * Run garbage collection, freeing objects that are no longer referenced.
+ * Initialize the mark stack: only the first segment, which is stored in the context, is used.
  */
-void
-ecma_gc_run (void)
+static void
+ecma_gc_init_mark_stack (void)
 {
-#if (JERRY_GC_MARK_LIMIT != 0)
-  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  JERRY_CONTEXT (ecma_gc_mark_stack).prev_p = NULL;
+  JERRY_CONTEXT (ecma_gc_mark_stack).next_p = NULL;
+  JERRY_CONTEXT (ecma_gc_mark_segment_p) = &JERRY_CONTEXT (ecma_gc_mark_stack);
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 0;
+  JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+} /* ecma_gc_init_mark_stack */
+
+/**
+ * Start a new garbage collection cycle.
+ *
+ * The root objects are moved to the black list and the non-root objects are
+ * colored white in one go, since a white object which is stored into another
+ * object before it is colored could be missed by the write barrier. The objects
+ * allocated during the cycle are not collected by the cycle.
+ */
+static void
+ecma_gc_start_cycle (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
 
   JERRY_CONTEXT (ecma_gc_new_objects) = 0;
 
@@ -2125,22 +2487,18 @@ ecma_gc_run (void)
   black_list_head.gc_next_cp = JMEM_CP_NULL;
   ecma_object_t *black_end_p = &black_list_head;
 
-  ecma_object_t white_gray_list_head;
-  white_gray_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+  ecma_object_t white_list_head;
+  white_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
-  ecma_object_t *obj_prev_p = &white_gray_list_head;
+  ecma_object_t *obj_prev_p = &white_list_head;
   jmem_cpointer_t obj_iter_cp = obj_prev_p->gc_next_cp;
-  ecma_object_t *obj_iter_p;
 
   /* Move root objects (i.e. they have global or stack references) to the black list. */
   while (obj_iter_cp != JMEM_CP_NULL)
   {
-    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
     const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
 
-    JERRY_ASSERT (obj_prev_p == NULL
-                  || ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_p->gc_next_cp) == obj_iter_p);
-
     if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
     {
       /* Moving the object to list of marked objects. */
@@ -2160,88 +2518,543 @@ ecma_gc_run (void)
 
   black_end_p->gc_next_cp = JMEM_CP_NULL;
 
-  /* Mark root objects. */
-  obj_iter_cp = black_list_head.gc_next_cp;
-  while (obj_iter_cp != JMEM_CP_NULL)
+  JERRY_CONTEXT (ecma_gc_white_cp) = white_list_head.gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_black_cp) = black_list_head.gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_cursor_cp) = black_list_head.gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_objects_cp) = JMEM_CP_NULL;
+
+  if (black_end_p == &black_list_head)
+  {
+    JERRY_CONTEXT (ecma_gc_black_end_cp) = JMEM_CP_NULL;
+  }
+  else
   {
-    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_black_end_cp), black_end_p);
+  }
+
+  ecma_gc_init_mark_stack ();
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_MARK_ROOTS;
+} /* ecma_gc_start_cycle */
+
+/**
+ * Mark the objects on the mark stack, until the stack is empty.
+ *
+ * @return remaining work
+ */
+static uint32_t
+ecma_gc_drain_mark_stack (uint32_t work) /**< maximum number of objects to process */
+{
+  while (true)
+  {
+    uint32_t top = JERRY_CONTEXT (ecma_gc_mark_stack_top);
+
+    if (top == 0)
+    {
+      ecma_gc_mark_segment_t *prev_p = JERRY_CONTEXT (ecma_gc_mark_segment_p)->prev_p;
+
+      if (prev_p == NULL)
+      {
+        return work;
+      }
+
+      JERRY_CONTEXT (ecma_gc_mark_segment_p) = prev_p;
+      JERRY_CONTEXT (ecma_gc_mark_stack_top) = JERRY_GC_MARK_STACK_SIZE;
+      continue;
+    }
+
+    if (work == 0)
+    {
+      return 0;
+    }
+
+    work--;
+
+    JERRY_CONTEXT (ecma_gc_mark_stack_top) = --top;
+    jmem_cpointer_t object_cp = JERRY_CONTEXT (ecma_gc_mark_segment_p)->objects[top];
+    ecma_gc_mark (JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, object_cp));
+  }
+} /* ecma_gc_drain_mark_stack */
+
+/**
+ * Mark the objects referenced by the root objects.
+ *
+ * @return remaining work
+ */
+static uint32_t
+ecma_gc_mark_roots (uint32_t work) /**< maximum number of objects to process */
+{
+  while (true)
+  {
+    work = ecma_gc_drain_mark_stack (work);
+
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_cursor_cp);
+
+    if (obj_iter_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    if (work == 0)
+    {
+      return 0;
+    }
+
+    work--;
+
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    JERRY_CONTEXT (ecma_gc_cursor_cp) = obj_iter_p->gc_next_cp;
     ecma_gc_mark (obj_iter_p);
-    obj_iter_cp = obj_iter_p->gc_next_cp;
   }
 
-  /* Mark non-root objects. */
-  bool marked_anything_during_current_iteration;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_MARK;
+  return work;
+} /* ecma_gc_mark_roots */
 
-  do
+/**
+ * Mark the objects reachable from the roots.
+ *
+ * The mark stack is drained first. When the stack overflowed, the
+ * gray objects, which could not be pushed onto the stack, are found
+ * by scanning the white list.
+ *
+ * @return remaining work
+ */
+static uint32_t
+ecma_gc_mark_objects (uint32_t work) /**< maximum number of objects to process */
+{
+  uint32_t remaining_work = work;
+  bool new_objects_marked = false;
+
+  while (true)
   {
-#if (JERRY_GC_MARK_LIMIT != 0)
-    JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+    work = ecma_gc_drain_mark_stack (work);
 
-    marked_anything_during_current_iteration = false;
+    if (work == 0)
+    {
+      return 0;
+    }
 
-    obj_prev_p = &white_gray_list_head;
-    obj_iter_cp = obj_prev_p->gc_next_cp;
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_cursor_cp);
 
-    while (obj_iter_cp != JMEM_CP_NULL)
+    if (obj_iter_cp != JMEM_CP_NULL)
+    {
+      work--;
+
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+      JERRY_CONTEXT (ecma_gc_cursor_cp) = obj_iter_p->gc_next_cp;
+
+      if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_GC_MARKED)
+      {
+        if (obj_iter_p->type_flags_refs < ECMA_OBJECT_GC_GRAY || !ecma_gc_is_object_visited (obj_iter_p))
+        {
+          /* White objects are not reachable so far, and marked objects are already processed. */
+          continue;
+        }
+
+        ecma_gc_set_object_color (obj_iter_p, ECMA_OBJECT_GC_MARKED);
+      }
+
+      /* Objects referenced by the mutator during the cycle keep their reference count. */
+      ecma_gc_mark (obj_iter_p);
+      continue;
+    }
+
+    if (JERRY_CONTEXT (ecma_gc_mark_stack_overflow))
+    {
+      JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+      JERRY_CONTEXT (ecma_gc_cursor_cp) = JERRY_CONTEXT (ecma_gc_white_cp);
+      continue;
+    }
+
+    if (new_objects_marked || JERRY_CONTEXT (ecma_gc_objects_cp) == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    /* The objects allocated during the cycle may reference white objects which were
+     * not passed to the write barrier (e.g. the lexical environments of a frame), so
+     * they are marked before the cycle is finished without interruption. */
+    jmem_cpointer_t new_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+    while (new_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *new_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, new_iter_cp);
+      ecma_gc_mark (new_iter_p);
+      new_iter_cp = new_iter_p->gc_next_cp;
+    }
+
+    new_objects_marked = true;
+    remaining_work = work;
+    work = UINT32_MAX;
+  }
+
+  ecma_gc_free_mark_segments ();
+
+  JERRY_CONTEXT (ecma_gc_cursor_cp) = JERRY_CONTEXT (ecma_gc_white_cp);
+  JERRY_CONTEXT (ecma_gc_cursor_prev_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_SWEEP;
+  return new_objects_marked ? remaining_work : work;
+} /* ecma_gc_mark_objects */
+
+/**
+ * Finish the sweep phase: the root objects and the objects kept
+ * in the white list are linked before the newly allocated objects.
+ */
+static void
+ecma_gc_finish_sweep (void)
+{
+  jmem_cpointer_t list_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+  jmem_cpointer_t white_end_cp = JERRY_CONTEXT (ecma_gc_cursor_prev_cp);
+
+  if (white_end_cp != JMEM_CP_NULL)
+  {
+    JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, white_end_cp)->gc_next_cp = list_cp;
+    list_cp = JERRY_CONTEXT (ecma_gc_white_cp);
+  }
+
+  jmem_cpointer_t black_end_cp = JERRY_CONTEXT (ecma_gc_black_end_cp);
+
+  if (black_end_cp != JMEM_CP_NULL)
+  {
+    JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, black_end_cp)->gc_next_cp = list_cp;
+    list_cp = JERRY_CONTEXT (ecma_gc_black_cp);
+  }
+
+  JERRY_CONTEXT (ecma_gc_objects_cp) = list_cp;
+  JERRY_CONTEXT (ecma_gc_white_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_IDLE;
+
+#if JERRY_GC_GENERATIONAL
+  /* All surviving objects are promoted to the old generation. */
+  JERRY_CONTEXT (ecma_gc_old_cp) = list_cp;
+  JERRY_CONTEXT (ecma_gc_promoted_objects) = 0;
+#endif /* JERRY_GC_GENERATIONAL */
+
+#if JERRY_BUILTIN_REGEXP
+  /* Free RegExp bytecodes stored in cache */
+  re_cache_gc ();
+#endif /* JERRY_BUILTIN_REGEXP */
+} /* ecma_gc_finish_sweep */
+
+/**
+ * Free the objects which are not marked by the current cycle.
+ *
+ * @return remaining work
+ */
+static uint32_t
+ecma_gc_sweep_objects (uint32_t work) /**< maximum number of objects to process */
+{
+  while (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP)
+  {
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_cursor_cp);
+    jmem_cpointer_t obj_prev_cp = JERRY_CONTEXT (ecma_gc_cursor_prev_cp);
+    ecma_object_t *obj_iter_p = NULL;
+
+    /* Skip the marked objects. */
+    while (obj_iter_cp != JMEM_CP_NULL && work > 0)
     {
       obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
-      const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
 
-      JERRY_ASSERT (obj_prev_p == NULL
-                    || ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_p->gc_next_cp) == obj_iter_p);
+      if (!ecma_gc_is_object_visited (obj_iter_p))
+      {
+        break;
+      }
+
+      JERRY_ASSERT (obj_iter_p->type_flags_refs < ECMA_OBJECT_GC_GRAY);
 
-      if (ecma_gc_is_object_visited (obj_iter_p))
+      if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_GC_MARKED)
       {
-        /* Moving the object to list of marked objects */
-        obj_prev_p->gc_next_cp = obj_next_cp;
+        /* Set the reference count of the object to 0 */
+        obj_iter_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+      }
+
+      work--;
+      obj_prev_cp = obj_iter_cp;
+      obj_iter_cp = obj_iter_p->gc_next_cp;
+    }
+
+    JERRY_CONTEXT (ecma_gc_cursor_prev_cp) = obj_prev_cp;
+
+    if (obj_iter_cp == JMEM_CP_NULL)
+    {
+      ecma_gc_finish_sweep ();
+      break;
+    }
+
+    JERRY_CONTEXT (ecma_gc_cursor_cp) = obj_iter_cp;
+
+    if (work == 0)
+    {
+      break;
+    }
 
-        black_end_p->gc_next_cp = obj_iter_cp;
-        black_end_p = obj_iter_p;
+    work--;
+
+    /* The object is unlinked first, since free callbacks may run a garbage collection. */
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+    JERRY_CONTEXT (ecma_gc_cursor_cp) = obj_next_cp;
 
+    if (obj_prev_cp == JMEM_CP_NULL)
+    {
+      JERRY_CONTEXT (ecma_gc_white_cp) = obj_next_cp;
+    }
+    else
+    {
+      JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_cp)->gc_next_cp = obj_next_cp;
+    }
+
+    ecma_gc_free_object (obj_iter_p);
+  }
+
+  return work;
+} /* ecma_gc_sweep_objects */
+
+/**
+ * Perform a part of the current garbage collection cycle.
+ *
+ * @return true  - if the cycle is finished
+ *         false - otherwise
+ */
+static bool
+ecma_gc_process (uint32_t work) /**< maximum number of objects to process */
+{
+  while (true)
+  {
+    switch (JERRY_CONTEXT (ecma_gc_phase))
+    {
+      case ECMA_GC_PHASE_MARK_ROOTS:
+      {
+        work = ecma_gc_mark_roots (work);
+        break;
+      }
+      case ECMA_GC_PHASE_MARK:
+      {
+        work = ecma_gc_mark_objects (work);
+        break;
+      }
+      case ECMA_GC_PHASE_SWEEP:
+      {
+        work = ecma_gc_sweep_objects (work);
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+        return true;
+      }
+    }
+
+    if (work == 0)
+    {
+      return JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE;
+    }
+  }
+} /* ecma_gc_process */
+
+/**
+ * Finish the current garbage collection cycle, if there is any.
+ */
+void
+ecma_gc_finish_cycle (void)
+{
+  ecma_gc_process (UINT32_MAX);
+} /* ecma_gc_finish_cycle */
+
+#if JERRY_GC_INCREMENTAL
+
+/**
+ * Perform a part of the incremental garbage collection. A new cycle
+ * is started when no collection is in progress.
+ *
+ * @return true  - if the cycle is finished
+ *         false - otherwise
+ */
+bool
+ecma_gc_step (uint32_t work) /**< maximum number of objects to process */
+{
+#if JERRY_GC_GENERATIONAL
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MINOR)
+  {
+    return false;
+  }
+#endif /* JERRY_GC_GENERATIONAL */
+
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE)
+  {
+    ecma_gc_start_cycle ();
+  }
+
+  return ecma_gc_process (work);
+} /* ecma_gc_step */
+
+#endif /* JERRY_GC_INCREMENTAL */
+
+/**
+ * Run garbage collection, freeing objects that are no longer referenced.
+ */
+void
+ecma_gc_run (void)
+{
 #if (JERRY_GC_MARK_LIMIT != 0)
-        if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
+#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+#if JERRY_GC_GENERATIONAL
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MINOR)
+  {
+    /* Free callbacks of a minor collection cannot start a full collection. */
+    return;
+  }
+#endif /* JERRY_GC_GENERATIONAL */
+
+  /* An incremental cycle does not free the objects which became unreachable after it was started. */
+  ecma_gc_finish_cycle ();
+
+  ecma_gc_start_cycle ();
+  ecma_gc_finish_cycle ();
+} /* ecma_gc_run */
+
+#if JERRY_GC_GENERATIONAL
+
+/**
+ * Run a minor garbage collection, freeing the young objects which are no longer referenced.
+ *
+ * The young generation is the list of objects allocated since the last collection. The
+ * roots of a minor collection are the young objects which have references, or which
+ * were stored into another object (see ecma_gc_remember_object). The old objects are
+ * neither marked nor traversed, so the cost of the collection depends on the size of the
+ * young generation only. The surviving objects are promoted to the old generation, and
+ * they are freed by the next full collection when they become unreachable.
+ */
+void
+ecma_gc_run_minor (void)
+{
+  if (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE)
+  {
+    return;
+  }
+
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+
+  jmem_cpointer_t young_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+  jmem_cpointer_t old_cp = JERRY_CONTEXT (ecma_gc_old_cp);
+
+  if (young_cp == old_cp)
+  {
+    return;
+  }
+
+  /* The young objects are detached, so the free callbacks can allocate new objects. */
+  JERRY_CONTEXT (ecma_gc_objects_cp) = old_cp;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_MINOR;
+
+  jmem_cpointer_t obj_iter_cp = young_cp;
+
+  while (obj_iter_cp != old_cp)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE && ecma_gc_is_young_object (obj_iter_p))
+    {
+      obj_iter_p->type_flags_refs |= ECMA_OBJECT_NON_VISITED;
+    }
+
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  ecma_gc_init_mark_stack ();
+
+  /* The old objects are never colored, so they are considered visited by the marking. */
+  bool scan_gray_objects = false;
+
+  do
+  {
+    JERRY_CONTEXT (ecma_gc_mark_stack_overflow) = false;
+    obj_iter_cp = young_cp;
+
+    while (obj_iter_cp != old_cp)
+    {
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+      obj_iter_cp = obj_iter_p->gc_next_cp;
+
+      if (scan_gray_objects)
+      {
+        if (obj_iter_p->type_flags_refs < ECMA_OBJECT_GC_GRAY || !ecma_gc_is_object_visited (obj_iter_p))
         {
-          /* Set the reference count of non-marked gray object to 0 */
-          obj_iter_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
-          ecma_gc_mark (obj_iter_p);
-          marked_anything_during_current_iteration = true;
+          continue;
         }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-        marked_anything_during_current_iteration = true;
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+        ecma_gc_set_object_color (obj_iter_p, ECMA_OBJECT_GC_MARKED);
       }
-      else
+      else if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_GC_MARKED)
       {
-        obj_prev_p = obj_iter_p;
+        continue;
       }
 
-      obj_iter_cp = obj_next_cp;
+      ecma_gc_mark (obj_iter_p);
+      ecma_gc_drain_mark_stack (UINT32_MAX);
     }
-  } while (marked_anything_during_current_iteration);
 
-  black_end_p->gc_next_cp = JMEM_CP_NULL;
-  JERRY_CONTEXT (ecma_gc_objects_cp) = black_list_head.gc_next_cp;
+    scan_gray_objects = true;
+  } while (JERRY_CONTEXT (ecma_gc_mark_stack_overflow));
 
-  /* Sweep objects that are currently unmarked. */
-  obj_iter_cp = white_gray_list_head.gc_next_cp;
+  ecma_gc_free_mark_segments ();
 
-  while (obj_iter_cp != JMEM_CP_NULL)
+  ecma_object_t survivor_list_head;
+  ecma_object_t *survivor_end_p = &survivor_list_head;
+  jmem_cpointer_t unreachable_cp = JMEM_CP_NULL;
+  size_t promoted_objects = 0;
+
+  obj_iter_cp = young_cp;
+
+  while (obj_iter_cp != old_cp)
   {
-    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
     const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
 
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+    if (!ecma_gc_is_object_visited (obj_iter_p))
+    {
+      obj_iter_p->gc_next_cp = unreachable_cp;
+      unreachable_cp = obj_iter_cp;
+    }
+    else
+    {
+      JERRY_ASSERT (obj_iter_p->type_flags_refs < ECMA_OBJECT_GC_GRAY);
+
+      if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_GC_MARKED)
+      {
+        /* Set the reference count of the object to 0 */
+        obj_iter_p->type_flags_refs &= (ecma_object_descriptor_t) (ECMA_OBJECT_REF_ONE - 1);
+      }
+
+      survivor_end_p->gc_next_cp = obj_iter_cp;
+      survivor_end_p = obj_iter_p;
+      promoted_objects++;
+    }
 
-    ecma_gc_free_object (obj_iter_p);
     obj_iter_cp = obj_next_cp;
   }
 
-#if JERRY_BUILTIN_REGEXP
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc ();
-#endif /* JERRY_BUILTIN_REGEXP */
-} /* ecma_gc_run */
+  if (survivor_end_p != &survivor_list_head)
+  {
+    survivor_end_p->gc_next_cp = old_cp;
+    JERRY_CONTEXT (ecma_gc_objects_cp) = survivor_list_head.gc_next_cp;
+    JERRY_CONTEXT (ecma_gc_old_cp) = survivor_list_head.gc_next_cp;
+    JERRY_CONTEXT (ecma_gc_promoted_objects) += promoted_objects;
+  }
+
+  /* The objects allocated by the free callbacks are linked before the old generation. */
+  while (unreachable_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, unreachable_cp);
+    unreachable_cp = obj_iter_p->gc_next_cp;
+    ecma_gc_free_object (obj_iter_p);
+  }
+
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_IDLE;
+} /* ecma_gc_run_minor */
+
+#endif /* JERRY_GC_GENERATIONAL */
 
 /**
  * Try to free some memory (depending on memory pressure).
@@ -2277,6 +3090,15 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
 
     if (JERRY_CONTEXT (ecma_gc_new_objects) * new_objects_fraction > JERRY_CONTEXT (ecma_gc_objects_number))
     {
+#if JERRY_GC_GENERATIONAL
+      /* A full collection is started when too many objects were promoted since the last one. */
+      if (JERRY_CONTEXT (ecma_gc_promoted_objects) * new_objects_fraction <= JERRY_CONTEXT (ecma_gc_objects_number))
+      {
+        ecma_gc_run_minor ();
+        return;
+      }
+#endif /* JERRY_GC_GENERATIONAL */
+
       ecma_gc_run ();
     }
 
@@ -2299,14 +3121,26 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
 
     ecma_gc_run ();
 
-#if JERRY_PROPERTY_HASHMAP
-    /* Free hashmaps of remaining objects. */
+#if JERRY_VM_STACKLESS
+    vm_call_stack_free_unused ();
+#endif /* JERRY_VM_STACKLESS */
+
+#if JERRY_PROPERTY_HASHMAP || JERRY_BUILTIN_CONTAINER
+    /* Free hashmaps and container indexes of remaining objects. */
     jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
     while (obj_iter_cp != JMEM_CP_NULL)
     {
       ecma_object_t *obj_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
 
+#if JERRY_BUILTIN_CONTAINER
+      if (!ecma_is_lexical_environment (obj_iter_p) && ecma_object_class_is (obj_iter_p, ECMA_OBJECT_CLASS_CONTAINER))
+      {
+        ecma_op_container_free_index (obj_iter_p);
+      }
+#endif /* JERRY_BUILTIN_CONTAINER */
+
+#if JERRY_PROPERTY_HASHMAP
       if (!ecma_is_lexical_environment (obj_iter_p)
           || ecma_get_lex_env_type (obj_iter_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
       {
@@ -2328,10 +3162,11 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
           }
         }
       }
+#endif /* JERRY_PROPERTY_HASHMAP */
 
       obj_iter_cp = obj_iter_p->gc_next_cp;
     }
-#endif /* JERRY_PROPERTY_HASHMAP */
+#endif /* JERRY_PROPERTY_HASHMAP || JERRY_BUILTIN_CONTAINER */
 
     jmem_pools_collect_empty ();
     return;
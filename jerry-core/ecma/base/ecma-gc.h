@@ -27,6 +27,12 @@
  * @{
  */
 
+/**
+ * Number of objects processed by an incremental garbage collection step
+ * before the time budget is checked again
+ */
+#define ECMA_GC_STEP_SIZE 256
+
 /**
  * Free option flags
  */
@@ -37,6 +43,26 @@ typedef enum
   ECMA_GC_FREE_REFERENCES = (1 << 1), /**< free references */
 } ecma_gc_free_options_t;
 
+/**
+ * Write barrier of the generational collector for the object references,
+ * which are stored without calling ecma_copy_value_if_not_object
+ */
+#if JERRY_GC_GENERATIONAL
+#define ECMA_GC_REMEMBER_OBJECT(object_p) ecma_gc_remember_object (object_p)
+#else /* !JERRY_GC_GENERATIONAL */
+#define ECMA_GC_REMEMBER_OBJECT(object_p)
+#endif /* JERRY_GC_GENERATIONAL */
+
+/**
+ * Write barrier of the generational collector for the values,
+ * which are stored without calling ecma_copy_value_if_not_object
+ */
+#if JERRY_GC_GENERATIONAL
+#define ECMA_GC_REMEMBER_VALUE(value) ecma_gc_remember_value (value)
+#else /* !JERRY_GC_GENERATIONAL */
+#define ECMA_GC_REMEMBER_VALUE(value)
+#endif /* JERRY_GC_GENERATIONAL */
+
 void ecma_init_gc_info (ecma_object_t *object_p);
 void ecma_ref_object (ecma_object_t *object_p);
 void ecma_ref_object_inline (ecma_object_t *object_p);
@@ -44,6 +70,19 @@ void ecma_deref_object (ecma_object_t *object_p);
 void ecma_gc_free_property (ecma_object_t *object_p, ecma_property_pair_t *prop_pair_p, uint32_t options);
 void ecma_gc_free_properties (ecma_object_t *object_p, uint32_t options);
 void ecma_gc_run (void);
+void ecma_gc_finish_cycle (void);
+#if JERRY_GC_INCREMENTAL
+bool ecma_gc_step (uint32_t work);
+void ecma_gc_write_barrier (ecma_object_t *object_p);
+bool ecma_gc_is_object_unreachable (ecma_object_t *object_p);
+#endif /* JERRY_GC_INCREMENTAL */
+#if JERRY_GC_GENERATIONAL
+void ecma_gc_run_minor (void);
+void ecma_gc_remember_object (ecma_object_t *object_p);
+void ecma_gc_remember_value (ecma_value_t value);
+void ecma_gc_init_young_generation (void);
+void ecma_gc_finalize_young_generation (void);
+#endif /* JERRY_GC_GENERATIONAL */
 void ecma_free_unused_memory (jmem_pressure_t pressure);
 
 /**
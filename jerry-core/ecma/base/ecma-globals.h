@@ -76,7 +76,8 @@ typedef enum
 {
   ECMA_TYPE_DIRECT = 0, /**< directly encoded value, a 28 bit signed integer or a simple value */
   ECMA_TYPE_STRING = 1, /**< pointer to description of a string */
-  ECMA_TYPE_FLOAT = 2, /**< pointer to a 64 or 32 bit floating point number */
+  ECMA_TYPE_FLOAT = 2, /**< pointer to a 64 or 32 bit floating point number
+                        *   (or an inline floating point number when JERRY_NAN_BOXING is enabled) */
   ECMA_TYPE_OBJECT = 3, /**< pointer to description of an object */
   ECMA_TYPE_SYMBOL = 4, /**< pointer to description of a symbol */
   ECMA_TYPE_DIRECT_STRING = 5, /**< directly encoded string values */
@@ -124,6 +125,12 @@ typedef enum
 #if JERRY_FUNCTION_TO_STRING
   ECMA_PARSE_INTERNAL_HAS_4_BYTE_MARKER = (1u << 19), /**< source has 4 byte marker */
 #endif /* JERRY_FUNCTION_TO_STRING */
+#if JERRY_LAZY_FUNCTIONS
+  ECMA_PARSE_INTERNAL_LAZY_FUNCTIONS = (1u << 20), /**< the body of the inner functions can be compiled lazily */
+  ECMA_PARSE_INTERNAL_LAZY_FUNCTION_BODY = (1u << 21), /**< the body of a lazy function is compiled */
+  ECMA_PARSE_INTERNAL_HAS_LAZY_FUNCTION = (1u << 22), /**< a lazy function is created */
+#endif /* JERRY_LAZY_FUNCTIONS */
+  ECMA_PARSE_INTERNAL_OPTIMIZE_BYTE_CODE = (1u << 23), /**< run the byte code optimizer */
 #ifndef JERRY_NDEBUG
   /**
    * This flag represents an error in for in/of statements, which cannot be set
@@ -133,6 +140,30 @@ typedef enum
 #endif /* !JERRY_NDEBUG */
 } ecma_parse_opts_t;
 
+#if JERRY_NAN_BOXING
+
+/**
+ * Description of an ecma value
+ *
+ * Values below 2^32 have the same bit-field structure as in the 32 bit
+ * representation: type (3) | value (29). All other values are floating
+ * point numbers, whose binary representation is increased by
+ * ECMA_VALUE_FLOAT_OFFSET (NaN values are canonicalized).
+ */
+typedef uint64_t ecma_value_t;
+
+/**
+ * Offset added to the binary representation of inline floating point numbers
+ */
+#define ECMA_VALUE_FLOAT_OFFSET ((ecma_value_t) 1 << 48)
+
+/**
+ * Checks whether an ecma value is an inline floating point number
+ */
+#define ECMA_VALUE_IS_INLINE_FLOAT(value) ((value) > UINT32_MAX)
+
+#else /* !JERRY_NAN_BOXING */
+
 /**
  * Description of an ecma value
  *
@@ -140,6 +171,8 @@ typedef enum
  */
 typedef uint32_t ecma_value_t;
 
+#endif /* JERRY_NAN_BOXING */
+
 /**
  * Type for directly encoded integer numbers in JerryScript.
  */
@@ -461,6 +494,14 @@ typedef enum
  */
 #define ECMA_PROPERTY_TYPE_HASHMAP (ECMA_DIRECT_STRING_SPECIAL << ECMA_PROPERTY_NAME_TYPE_SHIFT)
 
+#if JERRY_OBJECT_SHAPES
+/**
+ * Type of the header of a property list which belongs to an object with a shape.
+ */
+#define ECMA_PROPERTY_TYPE_SHAPE \
+  (ECMA_PROPERTY_FLAG_CONFIGURABLE | (ECMA_DIRECT_STRING_SPECIAL << ECMA_PROPERTY_NAME_TYPE_SHIFT))
+#endif /* JERRY_OBJECT_SHAPES */
+
 /**
  * Type of deleted property.
  */
@@ -574,7 +615,13 @@ typedef struct
 /**
  * Returns true if the property pointer is a property pair.
  */
+#if JERRY_OBJECT_SHAPES
+#define ECMA_PROPERTY_IS_PROPERTY_PAIR(property_header_p)        \
+  ((property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP \
+   && (property_header_p)->types[0] != ECMA_PROPERTY_TYPE_SHAPE)
+#else /* !JERRY_OBJECT_SHAPES */
 #define ECMA_PROPERTY_IS_PROPERTY_PAIR(property_header_p) ((property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP)
+#endif /* JERRY_OBJECT_SHAPES */
 
 /**
  * Property value of all internal properties
@@ -891,9 +938,52 @@ typedef uint16_t ecma_object_descriptor_t;
 #define ECMA_OBJECT_NON_VISITED ECMA_OBJECT_REF_MASK
 
 /**
- * Maximum value of the object reference counter (1022 / 67108862).
+ * Represents a visited object whose referenced objects are not marked yet
  */
-#define ECMA_OBJECT_MAX_REF (ECMA_OBJECT_NON_VISITED - ECMA_OBJECT_REF_ONE)
+#define ECMA_OBJECT_GC_GRAY (ECMA_OBJECT_NON_VISITED - ECMA_OBJECT_REF_ONE)
+
+/**
+ * Represents a visited object whose referenced objects are marked
+ */
+#define ECMA_OBJECT_GC_MARKED (ECMA_OBJECT_GC_GRAY - ECMA_OBJECT_REF_ONE)
+
+/**
+ * Maximum value of the object reference counter (1020 / 67108860).
+ *
+ * Note:
+ *      the values above the maximum are used as colors by the garbage collector,
+ *      so the mutator can only reach a colored object through the slow path of
+ *      ecma_ref_object_inline
+ */
+#define ECMA_OBJECT_MAX_REF (ECMA_OBJECT_GC_MARKED - ECMA_OBJECT_REF_ONE)
+
+/**
+ * Phases of the garbage collector
+ */
+typedef enum
+{
+  ECMA_GC_PHASE_IDLE, /**< no collection is in progress */
+  ECMA_GC_PHASE_SWEEP, /**< unreachable objects are being freed */
+#if JERRY_GC_GENERATIONAL
+  ECMA_GC_PHASE_MINOR, /**< unreachable young objects are being collected */
+#endif /* JERRY_GC_GENERATIONAL */
+  ECMA_GC_PHASE_MARK_ROOTS, /**< objects referenced by the root objects are being marked */
+  ECMA_GC_PHASE_MARK, /**< reachable objects are being marked */
+} ecma_gc_phase_t;
+
+/**
+ * Segment of the GC mark stack
+ *
+ * Note:
+ *      the first segment is reserved in the engine context, and
+ *      the other segments are allocated when the stack grows
+ */
+typedef struct ecma_gc_mark_segment_t
+{
+  struct ecma_gc_mark_segment_t *prev_p; /**< previous segment */
+  struct ecma_gc_mark_segment_t *next_p; /**< next segment, which is kept until the mark phase is finished */
+  jmem_cpointer_t objects[JERRY_GC_MARK_STACK_SIZE]; /**< gray objects waiting to be marked */
+} ecma_gc_mark_segment_t;
 
 /**
  * Description of ECMA-object or lexical environment
@@ -1272,25 +1362,48 @@ typedef struct
  */
 #define ECMA_CONTAINER_PAIR_SIZE 2
 
+/**
+ * Hash index of the internal buffer of a container.
+ *
+ * Note:
+ *   The hash index is an open addressing table, which maps the hash of a key to the
+ *   position of its entry in the internal buffer. The slots follow this header.
+ */
+typedef struct
+{
+  uint32_t mask; /**< number of slots - 1 (number of slots is a power of 2) */
+  uint32_t free_count; /**< number of never used slots */
+} ecma_container_index_t;
+
+/**
+ * Number of header items (size and hash index) at the beginning of the internal buffer.
+ */
+#define ECMA_CONTAINER_HEADER_SIZE 2
+
 /**
  * Size of the internal buffer.
  */
-#define ECMA_CONTAINER_GET_SIZE(container_p) (container_p->buffer_p[0])
+#define ECMA_CONTAINER_GET_SIZE(container_p) ((uint32_t) container_p->buffer_p[0])
 
 /**
  * Remove the size field of the internal buffer.
  */
 #define ECMA_CONTAINER_SET_SIZE(container_p, size) (container_p->buffer_p[0] = (ecma_value_t) (size))
 
+/**
+ * Hash index field of the internal buffer.
+ */
+#define ECMA_CONTAINER_INDEX(container_p) (container_p->buffer_p[1])
+
 /**
  * Number of entries of the internal buffer.
  */
-#define ECMA_CONTAINER_ENTRY_COUNT(collection_p) (collection_p->item_count - 1)
+#define ECMA_CONTAINER_ENTRY_COUNT(collection_p) (collection_p->item_count - ECMA_CONTAINER_HEADER_SIZE)
 
 /**
  * Pointer to the first entry of the internal buffer.
  */
-#define ECMA_CONTAINER_START(collection_p) (collection_p->buffer_p + 1)
+#define ECMA_CONTAINER_START(collection_p) (collection_p->buffer_p + ECMA_CONTAINER_HEADER_SIZE)
 
 #endif /* JERRY_BUILTIN_CONTAINER */
 
@@ -1518,8 +1631,10 @@ typedef enum
                                             *   maximum size is 2^16. */
   ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
   ECMA_STRING_CONTAINER_SYMBOL, /**< the ecma-string is a symbol */
+  ECMA_STRING_CONTAINER_ROPE, /**< the ecma-string is the lazy concatenation of two strings,
+                               *   which is flattened when its characters are accessed */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_SYMBOL /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_ROPE /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1618,6 +1733,27 @@ typedef struct
   void *user_p; /**< user pointer passed to the callback when the string is freed */
 } ecma_external_string_t;
 
+/**
+ * Rope string-value descriptor
+ *
+ * Note:
+ *   After the rope is flattened, the left part is the flat string and the right part is ECMA_VALUE_EMPTY.
+ */
+typedef struct
+{
+  ecma_string_t header; /**< string header */
+  ecma_value_t left; /**< first part of the string, which is never a direct string */
+  ecma_value_t right; /**< second part of the string, which is never a rope string */
+  lit_utf8_size_t size; /**< size of the rope string in bytes */
+  lit_utf8_size_t length; /**< length of the rope string in characters */
+} ecma_rope_string_t;
+
+/**
+ * Minimum size of the first part of a rope string. Shorter strings are concatenated
+ * by copying, and shorter second parts are merged by copying as well.
+ */
+#define ECMA_ROPE_STRING_MIN_SIZE 256
+
 /**
  * Header size of an ecma ASCII string
  */
@@ -1767,6 +1903,18 @@ typedef struct
   jmem_cpointer_t values[ECMA_LIT_STORAGE_VALUE_COUNT]; /**< list of values */
 } ecma_lit_storage_item_t;
 
+/**
+ * Hash table of literal strings, numbers and BigInts
+ *
+ * Note:
+ *   the table is an open addressing hash table, its ecma_value_t slots follow this header
+ */
+typedef struct
+{
+  uint32_t mask; /**< number of slots - 1 (number of slots is a power of 2) */
+  uint32_t count; /**< number of stored literals */
+} ecma_lit_storage_hash_t;
+
 #if JERRY_LCACHE
 /**
  * Container of an LCache entry identifier
@@ -37,7 +37,7 @@ ecma_collection_t *
 ecma_new_collection (void)
 {
   ecma_collection_t *collection_p;
-  collection_p = (ecma_collection_t *) jmem_heap_alloc_block (sizeof (ecma_collection_t));
+  collection_p = (ecma_collection_t *) jmem_pools_alloc (sizeof (ecma_collection_t));
 
   collection_p->item_count = 0;
   collection_p->capacity = ECMA_COLLECTION_INITIAL_CAPACITY;
@@ -58,7 +58,7 @@ ecma_collection_destroy (ecma_collection_t *collection_p) /**< value collection
   JERRY_ASSERT (collection_p != NULL);
 
   jmem_heap_free_block (collection_p->buffer_p, ECMA_COLLECTION_ALLOCATED_SIZE (collection_p->capacity));
-  jmem_heap_free_block (collection_p, sizeof (ecma_collection_t));
+  jmem_pools_free (collection_p, sizeof (ecma_collection_t));
 } /* ecma_collection_destroy */
 
 /**
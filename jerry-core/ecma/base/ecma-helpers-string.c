@@ -117,6 +117,8 @@ ecma_string_to_array_index (const lit_utf8_byte_t *string_p, /**< utf-8 string *
   return true;
 } /* ecma_string_to_array_index */
 
+static ecma_string_t *ecma_rope_string_flatten (const ecma_string_t *string_p);
+
 /**
  * Returns the characters and size of a string.
  *
@@ -169,6 +171,10 @@ ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
       *size_p = ECMA_ASCII_STRING_GET_SIZE (string_p);
       return ECMA_ASCII_STRING_GET_BUFFER (string_p);
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      return ecma_string_get_chars_fast (ecma_rope_string_flatten (string_p), size_p);
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -701,6 +707,224 @@ ecma_get_internal_string (lit_magic_string_id_t id) /**< identifier of magic str
   return (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_SPECIAL, (uintptr_t) id);
 } /* ecma_get_internal_string */
 
+/**
+ * Checks whether the concatenation of a string and a second string with the given size
+ * is represented as a rope string.
+ *
+ * @return true - if a rope string should be created
+ *         false - otherwise
+ */
+static bool
+ecma_rope_string_is_applicable (const ecma_string_t *string1_p, /**< first ecma-string */
+                                lit_utf8_size_t string2_size) /**< size of the second string */
+{
+  if (ECMA_IS_DIRECT_STRING (string1_p))
+  {
+    return false;
+  }
+
+  lit_utf8_size_t string1_size;
+
+  switch (ECMA_STRING_GET_CONTAINER (string1_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      string1_size = ((ecma_short_string_t *) string1_p)->size;
+      break;
+    }
+    case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
+    {
+      string1_size = ((ecma_long_string_t *) string1_p)->size;
+      break;
+    }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      string1_size = ((ecma_rope_string_t *) string1_p)->size;
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  lit_utf8_size_t new_size = string1_size + string2_size;
+
+  if (string1_size < ECMA_ROPE_STRING_MIN_SIZE || new_size < string1_size)
+  {
+    return false;
+  }
+
+  /* The external magic strings are sorted by their size. */
+  uint32_t magic_string_ex_count = lit_get_magic_string_ex_count ();
+  return (magic_string_ex_count == 0 || new_size > lit_get_magic_string_ex_size (magic_string_ex_count - 1));
+} /* ecma_rope_string_is_applicable */
+
+/**
+ * Create a rope string, which represents the concatenation of two strings without copying them.
+ *
+ * Note:
+ *   The string1_p argument is freed. If the second part of string1_p is short, it is
+ *   merged with the characters of string2_p, so short appends do not create long chains.
+ *
+ * @return rope string
+ */
+static ecma_string_t *
+ecma_new_rope_string (ecma_string_t *string1_p, /**< first ecma-string */
+                      ecma_string_t *string2_p, /**< second ecma-string */
+                      const lit_utf8_byte_t *cesu8_string2_p, /**< characters of string2_p */
+                      lit_utf8_size_t cesu8_string2_size, /**< byte size of cesu8_string2_p */
+                      lit_utf8_size_t cesu8_string2_length) /**< character length of cesu8_string2_p */
+{
+  JERRY_ASSERT (ecma_rope_string_is_applicable (string1_p, cesu8_string2_size));
+
+  if (!ECMA_IS_DIRECT_STRING (string2_p) && ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    string2_p = ecma_rope_string_flatten (string2_p);
+  }
+
+  lit_utf8_size_t size = ecma_string_get_size (string1_p) + cesu8_string2_size;
+  lit_utf8_size_t length = ecma_string_get_length (string1_p) + cesu8_string2_length;
+  lit_string_hash_t hash = lit_utf8_string_hash_combine (string1_p->u.hash, cesu8_string2_p, cesu8_string2_size);
+
+  ecma_value_t left = ecma_make_string_value (string1_p);
+  ecma_string_t *right_p = string2_p;
+  ecma_ref_ecma_string (right_p);
+
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    ecma_rope_string_t *rope1_p = (ecma_rope_string_t *) string1_p;
+
+    if (rope1_p->right != ECMA_VALUE_EMPTY)
+    {
+      ecma_string_t *right1_p = ecma_get_string_from_value (rope1_p->right);
+
+      if (ecma_string_get_size (right1_p) + cesu8_string2_size <= ECMA_ROPE_STRING_MIN_SIZE)
+      {
+        ecma_deref_ecma_string (right_p);
+        ecma_ref_ecma_string (right1_p);
+        right_p = ecma_append_chars_to_string (right1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+
+        left = rope1_p->left;
+        ecma_ref_ecma_string (ecma_get_string_from_value (left));
+        ecma_deref_ecma_string (string1_p);
+      }
+    }
+  }
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) ecma_alloc_string_buffer (sizeof (ecma_rope_string_t));
+
+  rope_p->header.refs_and_container = ECMA_STRING_CONTAINER_ROPE | ECMA_STRING_REF_ONE;
+  rope_p->header.u.hash = hash;
+  rope_p->left = left;
+  rope_p->right = ecma_make_string_value (right_p);
+  rope_p->size = size;
+  rope_p->length = length;
+
+  return (ecma_string_t *) rope_p;
+} /* ecma_new_rope_string */
+
+/**
+ * Copy the characters of a rope string which is not flattened into a buffer.
+ *
+ * Note:
+ *   The parts are copied from the end, so long chains of ropes are processed without recursion.
+ */
+static void
+ecma_rope_string_copy_chars (const ecma_rope_string_t *rope_p, /**< rope string */
+                             lit_utf8_byte_t *buffer_p) /**< destination buffer, which size is rope_p->size */
+{
+  lit_utf8_byte_t *end_p = buffer_p + rope_p->size;
+
+  while (true)
+  {
+    JERRY_ASSERT (rope_p->right != ECMA_VALUE_EMPTY);
+
+    ecma_string_t *right_p = ecma_get_string_from_value (rope_p->right);
+    lit_utf8_size_t right_size = ecma_string_get_size (right_p);
+
+    end_p -= right_size;
+    ecma_string_to_cesu8_bytes (right_p, end_p, right_size);
+
+    ecma_string_t *left_p = ecma_get_string_from_value (rope_p->left);
+    JERRY_ASSERT (!ECMA_IS_DIRECT_STRING (left_p));
+
+    if (ECMA_STRING_GET_CONTAINER (left_p) != ECMA_STRING_CONTAINER_ROPE
+        || ((ecma_rope_string_t *) left_p)->right == ECMA_VALUE_EMPTY)
+    {
+      ecma_string_to_cesu8_bytes (left_p, buffer_p, (lit_utf8_size_t) (end_p - buffer_p));
+      return;
+    }
+
+    rope_p = (ecma_rope_string_t *) left_p;
+  }
+} /* ecma_rope_string_copy_chars */
+
+/**
+ * Flatten a rope string: its characters are copied into a flat string, which replaces the parts of the rope.
+ *
+ * @return the flat string (the rope keeps the reference)
+ */
+static ecma_string_t *
+ecma_rope_string_flatten (const ecma_string_t *string_p) /**< rope string */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE);
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+  if (rope_p->right == ECMA_VALUE_EMPTY)
+  {
+    return ecma_get_string_from_value (rope_p->left);
+  }
+
+  lit_utf8_byte_t *data_p;
+  ecma_string_t *flat_p = ecma_new_ecma_string_from_utf8_buffer (rope_p->length, rope_p->size, &data_p);
+  flat_p->u.hash = rope_p->header.u.hash;
+
+  ecma_rope_string_copy_chars (rope_p, data_p);
+
+  ecma_value_t left = rope_p->left;
+  ecma_value_t right = rope_p->right;
+
+  rope_p->left = ecma_make_string_value (flat_p);
+  rope_p->right = ECMA_VALUE_EMPTY;
+
+  ecma_deref_ecma_string (ecma_get_string_from_value (right));
+  ecma_deref_ecma_string (ecma_get_string_from_value (left));
+  return flat_p;
+} /* ecma_rope_string_flatten */
+
+/**
+ * Deallocate a rope string. The chain of the first parts is freed iteratively.
+ */
+static void
+ecma_destroy_rope_string (ecma_string_t *string_p) /**< rope string */
+{
+  do
+  {
+    ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+    if (rope_p->right != ECMA_VALUE_EMPTY)
+    {
+      ecma_deref_ecma_string (ecma_get_string_from_value (rope_p->right));
+    }
+
+    string_p = ecma_get_string_from_value (rope_p->left);
+    ecma_dealloc_string_buffer ((ecma_string_t *) rope_p, sizeof (ecma_rope_string_t));
+
+    JERRY_ASSERT (!ECMA_IS_DIRECT_STRING (string_p));
+
+    if (ECMA_STRING_GET_CONTAINER (string_p) != ECMA_STRING_CONTAINER_ROPE)
+    {
+      ecma_deref_ecma_string_non_direct (string_p);
+      return;
+    }
+
+    JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
+    string_p->refs_and_container -= ECMA_STRING_REF_ONE;
+  } while (string_p->refs_and_container < ECMA_STRING_REF_ONE);
+} /* ecma_destroy_rope_string */
+
 /**
  * Append a cesu8 string after an ecma-string
  *
@@ -723,6 +947,16 @@ ecma_append_chars_to_string (ecma_string_t *string1_p, /**< base ecma-string */
     return ecma_new_ecma_string_from_utf8 (cesu8_string2_p, cesu8_string2_size);
   }
 
+  if (ecma_rope_string_is_applicable (string1_p, cesu8_string2_size))
+  {
+    ecma_string_t *string2_p = ecma_new_ecma_string_from_utf8 (cesu8_string2_p, cesu8_string2_size);
+    ecma_string_t *result_p =
+      ecma_new_rope_string (string1_p, string2_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+
+    ecma_deref_ecma_string (string2_p);
+    return result_p;
+  }
+
   lit_utf8_size_t cesu8_string1_size;
   lit_utf8_size_t cesu8_string1_length;
   uint8_t flags = ECMA_STRING_FLAG_IS_ASCII;
@@ -839,8 +1073,16 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
 
   JERRY_ASSERT (cesu8_string2_p != NULL);
 
-  ecma_string_t *result_p =
-    ecma_append_chars_to_string (string1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+  ecma_string_t *result_p;
+
+  if (ecma_rope_string_is_applicable (string1_p, cesu8_string2_size))
+  {
+    result_p = ecma_new_rope_string (string1_p, string2_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+  }
+  else
+  {
+    result_p = ecma_append_chars_to_string (string1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+  }
 
   JERRY_ASSERT (!(flags & ECMA_STRING_FLAG_MUST_BE_FREED));
 
@@ -994,6 +1236,11 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       ecma_dealloc_extended_string (symbol_p);
       return;
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_destroy_rope_string (string_p);
+      return;
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC
@@ -1120,6 +1367,18 @@ ecma_string_copy_to_buffer (const ecma_string_t *string_p, /**< ecma-string desc
     {
       return ecma_uint32_to_buffer (string_p->u.uint32_number, buffer_p, buffer_size);
     }
+
+    if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+    {
+      ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+      /* The string builders copy the parts of the ropes, so the ropes are not flattened. */
+      if (rope_p->right != ECMA_VALUE_EMPTY && encoding == JERRY_ENCODING_CESU8 && buffer_size >= rope_p->size)
+      {
+        ecma_rope_string_copy_chars (rope_p, buffer_p);
+        return rope_p->size;
+      }
+    }
   }
 
   lit_utf8_size_t string_size;
@@ -1353,6 +1612,10 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
         *flags_p |= ECMA_STRING_FLAG_IS_UINT32 | ECMA_STRING_FLAG_REHASH_NEEDED;
         break;
       }
+      case ECMA_STRING_CONTAINER_ROPE:
+      {
+        return ecma_string_get_chars (ecma_rope_string_flatten (string_p), size_p, length_p, uint32_buff_p, flags_p);
+      }
       default:
       {
         JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -1584,6 +1847,10 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
       size_and_length_p[1] = size_and_length_p[0];
       return ECMA_ASCII_STRING_GET_BUFFER (string_p);
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      return ecma_compare_get_string_chars (ecma_rope_string_flatten (string_p), size_and_length_p);
+    }
     default:
     {
       return NULL;
@@ -1872,6 +2139,11 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_long_string_t *) string_p)->length;
   }
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ((ecma_rope_string_t *) string_p)->length;
+  }
+
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
 
   lit_magic_string_ex_id_t id = LIT_MAGIC_STRING__COUNT - string_p->u.magic_string_ex_id;
@@ -1928,6 +2200,11 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_length_of_cesu8_string (long_string_p->string_p, size);
   }
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ecma_string_get_utf8_length (ecma_rope_string_flatten (string_p));
+  }
+
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
 
   lit_magic_string_ex_id_t id = LIT_MAGIC_STRING__COUNT - string_p->u.magic_string_ex_id;
@@ -1968,6 +2245,11 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_long_string_t *) string_p)->size;
   }
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ((ecma_rope_string_t *) string_p)->size;
+  }
+
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
 
   return lit_get_magic_string_ex_size (LIT_MAGIC_STRING__COUNT - string_p->u.magic_string_ex_id);
@@ -2022,6 +2304,11 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_size_of_cesu8_string (long_string_p->string_p, long_string_p->size);
   }
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ecma_string_get_utf8_size (ecma_rope_string_flatten (string_p));
+  }
+
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
 
   lit_magic_string_ex_id_t id = LIT_MAGIC_STRING__COUNT - string_p->u.magic_string_ex_id;
@@ -2136,6 +2423,10 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
 
       return (ecma_char_t) uint32_to_string_buffer[index];
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      return ecma_string_get_char_at_pos (ecma_rope_string_flatten (string_p), index);
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -21,6 +21,7 @@
 #include "ecma-helpers-number.h"
 #include "ecma-helpers.h"
 
+#include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "jrt.h"
 #include "vm-defines.h"
@@ -43,12 +44,18 @@ JERRY_STATIC_ASSERT (sizeof (jmem_cpointer_t) <= sizeof (jmem_cpointer_tag_t),
 /* cppcheck-suppress zerodiv */
 JERRY_STATIC_ASSERT (sizeof (uintptr_t) <= sizeof (ecma_value_t), uintptr_t_must_fit_in_ecma_value_t);
 
-#else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
+#elif !JERRY_NAN_BOXING /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
 
 JERRY_STATIC_ASSERT (sizeof (uintptr_t) > sizeof (ecma_value_t), uintptr_t_must_not_fit_in_ecma_value_t);
 
 #endif /* ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
 
+#if JERRY_NAN_BOXING
+
+JERRY_STATIC_ASSERT (JERRY_NUMBER_TYPE_FLOAT64, nan_boxing_requires_64_bit_floating_point_numbers);
+
+#endif /* JERRY_NAN_BOXING */
+
 JERRY_STATIC_ASSERT ((ECMA_VALUE_FALSE | (1 << ECMA_DIRECT_SHIFT)) == ECMA_VALUE_TRUE
                        && ECMA_VALUE_FALSE != ECMA_VALUE_TRUE,
                      only_the_lowest_bit_must_be_different_for_simple_value_true_and_false);
@@ -75,7 +82,14 @@ JERRY_STATIC_ASSERT (ECMA_NULL_POINTER == (ECMA_BIGINT_ZERO & ~(ecma_value_t) EC
 extern inline ecma_type_t JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_get_value_type_field (ecma_value_t value) /**< ecma value */
 {
-  return value & ECMA_VALUE_TYPE_MASK;
+#if JERRY_NAN_BOXING
+  if (ECMA_VALUE_IS_INLINE_FLOAT (value))
+  {
+    return ECMA_TYPE_FLOAT;
+  }
+#endif /* JERRY_NAN_BOXING */
+
+  return (ecma_type_t) (value & ECMA_VALUE_TYPE_MASK);
 } /* ecma_get_value_type_field */
 
 /**
@@ -140,7 +154,11 @@ ecma_is_value_direct (ecma_value_t value) /**< ecma value */
 extern inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_simple (ecma_value_t value) /**< ecma value */
 {
+#if JERRY_NAN_BOXING
+  return !ECMA_VALUE_IS_INLINE_FLOAT (value) && (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_SIMPLE_VALUE;
+#else /* !JERRY_NAN_BOXING */
   return (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_SIMPLE_VALUE;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_is_value_simple */
 
 /**
@@ -261,7 +279,11 @@ ecma_is_value_array_hole (ecma_value_t value) /**< ecma value */
 extern inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_integer_number (ecma_value_t value) /**< ecma value */
 {
+#if JERRY_NAN_BOXING
+  return !ECMA_VALUE_IS_INLINE_FLOAT (value) && (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+#else /* !JERRY_NAN_BOXING */
   return (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_is_value_integer_number */
 
 /**
@@ -276,7 +298,11 @@ ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value
 {
   JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_INTEGER_VALUE == 0, ecma_direct_type_integer_value_must_be_zero);
 
+#if JERRY_NAN_BOXING
+  return ecma_is_value_integer_number (first_value | second_value);
+#else /* !JERRY_NAN_BOXING */
   return ((first_value | second_value) & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_are_values_integer_numbers */
 
 /**
@@ -315,7 +341,11 @@ JERRY_STATIC_ASSERT ((ECMA_TYPE_STRING | 0x4) == ECMA_TYPE_DIRECT_STRING,
 extern inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_string (ecma_value_t value) /**< ecma value */
 {
+#if JERRY_NAN_BOXING
+  return !ECMA_VALUE_IS_INLINE_FLOAT (value) && ((value & (ECMA_VALUE_TYPE_MASK - 0x4)) == ECMA_TYPE_STRING);
+#else /* !JERRY_NAN_BOXING */
   return ((value & (ECMA_VALUE_TYPE_MASK - 0x4)) == ECMA_TYPE_STRING);
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_is_value_string */
 
 /**
@@ -494,7 +524,7 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 {
   JERRY_ASSERT (ECMA_IS_INTEGER_NUMBER (integer_value));
 
-  return (((ecma_value_t) integer_value) << ECMA_DIRECT_SHIFT) | ECMA_DIRECT_TYPE_INTEGER_VALUE;
+  return ((ecma_value_t) ((uint32_t) integer_value << ECMA_DIRECT_SHIFT)) | ECMA_DIRECT_TYPE_INTEGER_VALUE;
 } /* ecma_make_integer_value */
 
 /**
@@ -505,13 +535,25 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 static ecma_value_t
 ecma_create_float_number (ecma_number_t ecma_number) /**< value of the float number */
 {
+#if JERRY_NAN_BOXING
+  if (JERRY_UNLIKELY (ecma_number_is_nan (ecma_number)))
+  {
+    /* Canonicalized NaN values cannot overflow when the offset is added. */
+    ecma_number = ecma_number_make_nan ();
+  }
+
+  return ecma_number_to_binary (ecma_number) + ECMA_VALUE_FLOAT_OFFSET;
+#else /* !JERRY_NAN_BOXING */
   ecma_number_t *ecma_num_p = ecma_alloc_number ();
 
   *ecma_num_p = ecma_number;
 
   return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_FLOAT;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_create_float_number */
 
+#if !JERRY_NAN_BOXING
+
 /**
  * Encode float number without checks.
  *
@@ -523,6 +565,8 @@ ecma_make_float_value (ecma_number_t *ecma_num_p) /**< pointer to the float numb
   return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_FLOAT;
 } /* ecma_make_float_value */
 
+#endif /* !JERRY_NAN_BOXING */
+
 /**
  * Create a new NaN value.
  *
@@ -729,9 +773,15 @@ ecma_get_float_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
 
+#if JERRY_NAN_BOXING
+  return ecma_number_from_binary (value - ECMA_VALUE_FLOAT_OFFSET);
+#else /* !JERRY_NAN_BOXING */
   return *(ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_get_float_from_value */
 
+#if !JERRY_NAN_BOXING
+
 /**
  * Get floating point value pointer from an ecma value
  *
@@ -745,6 +795,8 @@ ecma_get_pointer_from_float_value (ecma_value_t value) /**< ecma value */
   return (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 } /* ecma_get_pointer_from_float_value */
 
+#endif /* !JERRY_NAN_BOXING */
+
 /**
  * Get floating point value from an ecma value
  *
@@ -865,12 +917,16 @@ ecma_copy_value (ecma_value_t value) /**< value description */
   {
     case ECMA_TYPE_FLOAT:
     {
+#if JERRY_NAN_BOXING
+      return value;
+#else /* !JERRY_NAN_BOXING */
       ecma_number_t *num_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
       ecma_number_t *new_num_p = ecma_alloc_number ();
 
       *new_num_p = *num_p;
 
       return ecma_make_float_value (new_num_p);
+#endif /* JERRY_NAN_BOXING */
     }
     case ECMA_TYPE_SYMBOL:
     case ECMA_TYPE_STRING:
@@ -934,6 +990,17 @@ ecma_copy_value_if_not_object (ecma_value_t value) /**< value description */
     return ecma_copy_value (value);
   }
 
+#if JERRY_GC_INCREMENTAL
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_phase) >= ECMA_GC_PHASE_MARK_ROOTS))
+  {
+    ecma_gc_write_barrier (ecma_get_object_from_value (value));
+  }
+#endif /* JERRY_GC_INCREMENTAL */
+
+#if JERRY_GC_GENERATIONAL
+  ecma_gc_remember_object (ecma_get_object_from_value (value));
+#endif /* JERRY_GC_GENERATIONAL */
+
   return value;
 } /* ecma_copy_value_if_not_object */
 
@@ -988,10 +1055,14 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
   }
   else if (ecma_is_value_float_number (ecma_value) && ecma_is_value_float_number (*value_p))
   {
+#if JERRY_NAN_BOXING
+    *value_p = ecma_value;
+#else /* !JERRY_NAN_BOXING */
     const ecma_number_t *num_src_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (ecma_value);
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
 
     *num_dst_p = *num_src_p;
+#endif /* JERRY_NAN_BOXING */
   }
   else
   {
@@ -1015,6 +1086,17 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
   JERRY_ASSERT (ecma_is_value_float_number (float_value));
 
   ecma_integer_value_t integer_number = (ecma_integer_value_t) new_number;
+
+#if JERRY_NAN_BOXING
+  if ((ecma_number_t) integer_number == new_number
+      && ((integer_number == 0) ? ecma_is_number_equal_to_positive_zero (new_number)
+                                : ECMA_IS_INTEGER_NUMBER (integer_number)))
+  {
+    return ecma_make_integer_value (integer_number);
+  }
+
+  return ecma_create_float_number (new_number);
+#else /* !JERRY_NAN_BOXING */
   ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (float_value);
 
   if ((ecma_number_t) integer_number == new_number
@@ -1027,6 +1109,7 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
 
   *number_p = new_number;
   return float_value;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_update_float_number */
 
 /**
@@ -1039,6 +1122,7 @@ static void
 ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value */
                                 ecma_number_t ecma_number) /**< number to assign */
 {
+#if !JERRY_NAN_BOXING
   if (ecma_is_value_float_number (*value_p))
   {
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
@@ -1046,6 +1130,7 @@ ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value
     *num_dst_p = ecma_number;
     return;
   }
+#endif /* !JERRY_NAN_BOXING */
 
   if (ecma_get_value_type_field (*value_p) != ECMA_TYPE_DIRECT
       && ecma_get_value_type_field (*value_p) != ECMA_TYPE_OBJECT)
@@ -1094,8 +1179,10 @@ ecma_free_value (ecma_value_t value) /**< value description */
   {
     case ECMA_TYPE_FLOAT:
     {
+#if !JERRY_NAN_BOXING
       ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
       ecma_dealloc_number (number_p);
+#endif /* !JERRY_NAN_BOXING */
       break;
     }
     case ECMA_TYPE_SYMBOL:
@@ -1185,11 +1272,15 @@ ecma_free_number (ecma_value_t value) /**< value description */
 {
   JERRY_ASSERT (ecma_is_value_number (value));
 
+#if JERRY_NAN_BOXING
+  JERRY_UNUSED (value);
+#else /* !JERRY_NAN_BOXING */
   if (ecma_is_value_float_number (value))
   {
     ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
     ecma_dealloc_number (number_p);
   }
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_free_number */
 
 /**
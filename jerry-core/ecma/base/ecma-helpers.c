@@ -24,6 +24,7 @@
 #include "ecma-lcache.h"
 #include "ecma-line-info.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 
 #include "byte-code.h"
 #include "jcontext.h"
@@ -53,7 +54,7 @@ JERRY_STATIC_ASSERT (ECMA_OBJECT_FLAG_EXTENSIBLE == ECMA_OBJECT_TYPE_MASK + 1,
 JERRY_STATIC_ASSERT (ECMA_OBJECT_REF_ONE == (ECMA_OBJECT_FLAG_EXTENSIBLE << 1),
                      ecma_object_ref_one_must_follow_the_extensible_flag);
 
-JERRY_STATIC_ASSERT ((ECMA_OBJECT_MAX_REF + ECMA_OBJECT_REF_ONE) == ECMA_OBJECT_REF_MASK,
+JERRY_STATIC_ASSERT ((ECMA_OBJECT_MAX_REF + 3 * ECMA_OBJECT_REF_ONE) == ECMA_OBJECT_REF_MASK,
                      ecma_object_max_ref_does_not_fill_the_remaining_bits);
 
 JERRY_STATIC_ASSERT ((ECMA_OBJECT_REF_MASK & (ECMA_OBJECT_TYPE_MASK | ECMA_OBJECT_FLAG_EXTENSIBLE)) == 0,
@@ -397,6 +398,19 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
   JERRY_ASSERT (name_p != NULL);
   JERRY_ASSERT (object_p != NULL);
 
+#if JERRY_OBJECT_SHAPES
+  if (ECMA_SHAPE_OBJECT_CAN_HAVE_SHAPE (object_p))
+  {
+    ecma_property_value_t *property_value_p =
+      ecma_shape_create_property (object_p, name_p, type_and_flags, value, out_prop_p);
+
+    if (property_value_p != NULL)
+    {
+      return property_value_p;
+    }
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
   jmem_cpointer_t *property_list_head_p = &object_p->u1.property_list_cp;
 
   if (*property_list_head_p != ECMA_NULL_POINTER)
@@ -557,6 +571,18 @@ ecma_create_named_accessor_property (ecma_object_t *object_p, /**< object */
 
   uint8_t type_and_flags = prop_attributes;
 
+#if JERRY_GC_GENERATIONAL
+  if (get_p != NULL)
+  {
+    ecma_gc_remember_object (get_p);
+  }
+
+  if (set_p != NULL)
+  {
+    ecma_gc_remember_object (set_p);
+  }
+#endif /* JERRY_GC_GENERATIONAL */
+
   ecma_property_value_t value;
 #if JERRY_CPOINTER_32_BIT
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
@@ -624,6 +650,17 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 
   jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
 
+#if JERRY_OBJECT_SHAPES
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      return ecma_shape_find_property (obj_p, (ecma_shape_property_list_t *) prop_iter_p, name_p);
+    }
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
 #if JERRY_PROPERTY_HASHMAP
   if (prop_iter_cp != JMEM_CP_NULL)
   {
@@ -778,6 +815,20 @@ void
 ecma_delete_property (ecma_object_t *object_p, /**< object */
                       ecma_property_value_t *prop_value_p) /**< property value reference */
 {
+#if JERRY_OBJECT_SHAPES
+  if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *cur_prop_p =
+      ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, object_p->u1.property_list_cp);
+
+    /* Shapes cannot represent deleted properties. */
+    if (cur_prop_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      prop_value_p = ecma_shape_convert_to_property_list (object_p, prop_value_p);
+    }
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
   jmem_cpointer_t cur_prop_cp = object_p->u1.property_list_cp;
 
   ecma_property_header_t *prev_prop_p = NULL;
@@ -881,6 +932,25 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
 
   ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
 
+#if JERRY_OBJECT_SHAPES
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+  {
+    ecma_shape_property_list_t *list_p = (ecma_shape_property_list_t *) prop_iter_p;
+    ecma_shape_property_pair_t *pairs_p = ECMA_SHAPE_GET_PAIRS (list_p);
+    uint32_t property_count = ECMA_SHAPE_FROM_LIST (list_p)->property_count;
+
+    for (uint32_t i = 0; i < property_count; i++)
+    {
+      if (ECMA_SHAPE_GET_PROPERTY_VALUE (pairs_p, i) == prop_value_p)
+      {
+        JERRY_ASSERT (is_data == ((*ECMA_SHAPE_GET_PROPERTY (pairs_p, i) & ECMA_PROPERTY_FLAG_DATA) != 0));
+        return;
+      }
+    }
+    return;
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
   if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
   {
     prop_iter_cp = prop_iter_p->next_property_cp;
@@ -955,6 +1025,13 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
 {
   ecma_assert_object_contains_the_property (object_p, prop_value_p, false);
 
+#if JERRY_GC_GENERATIONAL
+  if (getter_p != NULL)
+  {
+    ecma_gc_remember_object (getter_p);
+  }
+#endif /* JERRY_GC_GENERATIONAL */
+
 #if JERRY_CPOINTER_32_BIT
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
   getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t, prop_value_p->getter_setter_pair_cp);
@@ -974,6 +1051,13 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
 {
   ecma_assert_object_contains_the_property (object_p, prop_value_p, false);
 
+#if JERRY_GC_GENERATIONAL
+  if (setter_p != NULL)
+  {
+    ecma_gc_remember_object (setter_p);
+  }
+#endif /* JERRY_GC_GENERATIONAL */
+
 #if JERRY_CPOINTER_32_BIT
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
   getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t, prop_value_p->getter_setter_pair_cp);
@@ -1441,9 +1525,11 @@ ecma_script_deref (ecma_value_t script_value) /**< script value */
   }
 #endif /* JERRY_MODULE_SYSTEM */
 
-#if JERRY_FUNCTION_TO_STRING
+#if JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS
   ecma_deref_ecma_string (ecma_get_string_from_value (script_p->source_code));
+#endif /* JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS */
 
+#if JERRY_FUNCTION_TO_STRING
   if (type & CBC_SCRIPT_HAS_FUNCTION_ARGUMENTS)
   {
     ecma_deref_ecma_string (ecma_get_string_from_value (CBC_SCRIPT_GET_FUNCTION_ARGUMENTS (script_p, type)));
@@ -1526,6 +1612,18 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
       }
     }
 
+#if JERRY_LAZY_FUNCTIONS
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+    {
+      cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+
+      if (!ECMA_IS_INTERNAL_VALUE_NULL (lazy_function_p->compiled_code))
+      {
+        ecma_bytecode_deref (ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_compiled_code_t, lazy_function_p->compiled_code));
+      }
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     ecma_script_deref (((cbc_uint8_arguments_t *) bytecode_p)->script_value);
 
     if (bytecode_p->status_flags & CBC_CODE_FLAGS_HAS_TAGGED_LITERALS)
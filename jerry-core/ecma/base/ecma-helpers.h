@@ -235,7 +235,9 @@ void ecma_check_value_type_is_spec_defined (ecma_value_t value);
 ecma_value_t JERRY_ATTR_CONST ecma_make_boolean_value (bool boolean_value);
 ecma_value_t JERRY_ATTR_CONST ecma_make_integer_value (ecma_integer_value_t integer_value);
 ecma_value_t ecma_make_nan_value (void);
+#if !JERRY_NAN_BOXING
 ecma_value_t ecma_make_float_value (ecma_number_t *ecma_num_p);
+#endif /* !JERRY_NAN_BOXING */
 ecma_value_t ecma_make_length_value (ecma_length_t length);
 ecma_value_t ecma_make_number_value (ecma_number_t ecma_number);
 ecma_value_t ecma_make_int32_value (int32_t int32_number);
@@ -249,7 +251,9 @@ ecma_value_t JERRY_ATTR_PURE ecma_make_extended_primitive_value (const ecma_exte
                                                                  uint32_t type);
 ecma_integer_value_t JERRY_ATTR_CONST ecma_get_integer_from_value (ecma_value_t value);
 ecma_number_t JERRY_ATTR_PURE ecma_get_float_from_value (ecma_value_t value);
+#if !JERRY_NAN_BOXING
 ecma_number_t *ecma_get_pointer_from_float_value (ecma_value_t value);
+#endif /* !JERRY_NAN_BOXING */
 ecma_number_t JERRY_ATTR_PURE ecma_get_number_from_value (ecma_value_t value);
 ecma_string_t JERRY_ATTR_PURE *ecma_get_string_from_value (ecma_value_t value);
 ecma_string_t JERRY_ATTR_PURE *ecma_get_symbol_from_value (ecma_value_t value);
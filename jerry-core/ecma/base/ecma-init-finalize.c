@@ -23,6 +23,7 @@
 
 #include "jcontext.h"
 #include "jmem.h"
+#include "vm-stack.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -46,6 +47,10 @@ ecma_init (void)
   JERRY_CONTEXT (ecma_gc_mark_recursion_limit) = JERRY_GC_MARK_LIMIT;
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
 
+#if JERRY_GC_GENERATIONAL
+  ecma_gc_init_young_generation ();
+#endif /* JERRY_GC_GENERATIONAL */
+
   ecma_init_global_environment ();
 
 #if JERRY_PROPERTY_HASHMAP
@@ -87,6 +92,11 @@ ecma_finalize (void)
     }
   } while (JERRY_CONTEXT (ecma_gc_new_objects) != 0);
 
+#if JERRY_OBJECT_SHAPES
+  /* Shapes are freed with the last object which uses them. */
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_root_shapes_cp) == JMEM_CP_NULL);
+#endif /* JERRY_OBJECT_SHAPES */
+
   jmem_cpointer_t *global_symbols_cp = JERRY_CONTEXT (global_symbols_cp);
 
   for (uint32_t i = 0; i < ECMA_BUILTIN_GLOBAL_SYMBOL_COUNT; i++)
@@ -98,6 +108,15 @@ ecma_finalize (void)
   }
 
   ecma_finalize_lit_storage ();
+
+#if JERRY_VM_STACKLESS
+  JERRY_ASSERT (JERRY_CONTEXT (vm_call_stack_p) == NULL);
+  vm_call_stack_free_unused ();
+#endif /* JERRY_VM_STACKLESS */
+
+#if JERRY_GC_GENERATIONAL
+  ecma_gc_finalize_young_generation ();
+#endif /* JERRY_GC_GENERATIONAL */
 } /* ecma_finalize */
 
 /**
@@ -18,6 +18,7 @@
 #include "ecma-alloc.h"
 #include "ecma-big-uint.h"
 #include "ecma-bigint.h"
+#include "ecma-helpers-number.h"
 #include "ecma-helpers.h"
 
 #include "jcontext.h"
@@ -57,86 +58,157 @@ ecma_free_symbol_list (jmem_cpointer_t symbol_list_cp) /**< symbol list */
 } /* ecma_free_symbol_list */
 
 /**
- * Free string list
+ * Initial number of slots of the literal hash table.
  */
-static void
-ecma_free_string_list (jmem_cpointer_t string_list_cp) /**< string list */
+#define ECMA_LIT_STORAGE_HASH_INITIAL_SIZE 32
+
+/**
+ * Hash table slot which is not used.
+ */
+#define ECMA_LIT_STORAGE_HASH_FREE_SLOT ((ecma_value_t) 0)
+
+/**
+ * Compute the total size of the literal hash table.
+ */
+#define ECMA_LIT_STORAGE_HASH_GET_TOTAL_SIZE(slot_count) \
+  (sizeof (ecma_lit_storage_hash_t) + (slot_count) * sizeof (ecma_value_t))
+
+/**
+ * Get the slots of the literal hash table.
+ */
+#define ECMA_LIT_STORAGE_HASH_GET_SLOTS(hash_p) ((ecma_value_t *) ((hash_p) + 1))
+
+/**
+ * Compute the hash of a literal number.
+ *
+ * @return hash of the number
+ */
+static lit_string_hash_t
+ecma_lit_storage_hash_number (ecma_number_t number) /**< number */
 {
-  while (string_list_cp != JMEM_CP_NULL)
-  {
-    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
+  uint64_t binary = (uint64_t) ecma_number_to_binary (number);
+  uint32_t hash = (uint32_t) binary ^ (uint32_t) (binary >> 32);
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-    {
-      if (string_list_p->values[i] != JMEM_CP_NULL)
-      {
-        ecma_string_t *string_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, string_list_p->values[i]);
+  /* The low bits of the binary representation of short decimal numbers are usually zero. */
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
 
-        JERRY_ASSERT (ECMA_STRING_IS_REF_EQUALS_TO_ONE (string_p));
-        ecma_destroy_ecma_string (string_p);
-      }
-    }
+  return (lit_string_hash_t) hash;
+} /* ecma_lit_storage_hash_number */
 
-    jmem_cpointer_t next_item_cp = string_list_p->next_cp;
-    jmem_pools_free (string_list_p, sizeof (ecma_lit_storage_item_t));
-    string_list_cp = next_item_cp;
-  }
-} /* ecma_free_string_list */
+#if JERRY_BUILTIN_BIGINT
 
 /**
- * Free number list
+ * Compute the hash of a literal BigInt.
+ *
+ * @return hash of the BigInt
  */
-static void
-ecma_free_number_list (jmem_cpointer_t number_list_cp) /**< number list */
+static lit_string_hash_t
+ecma_lit_storage_hash_bigint (ecma_extended_primitive_t *bigint_p) /**< BigInt */
 {
-  while (number_list_cp != JMEM_CP_NULL)
-  {
-    ecma_lit_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, number_list_cp);
+  const lit_utf8_byte_t *digits_p = (const lit_utf8_byte_t *) ECMA_BIGINT_GET_DIGITS (bigint_p, 0);
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (digits_p, ECMA_BIGINT_GET_SIZE (bigint_p));
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-    {
-      if (number_list_p->values[i] != JMEM_CP_NULL)
-      {
-        ecma_dealloc_number (JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, number_list_p->values[i]));
-      }
-    }
+  return (lit_string_hash_t) (hash ^ bigint_p->u.bigint_sign_and_size);
+} /* ecma_lit_storage_hash_bigint */
 
-    jmem_cpointer_t next_item_cp = number_list_p->next_cp;
-    jmem_pools_free (number_list_p, sizeof (ecma_lit_storage_item_t));
-    number_list_cp = next_item_cp;
+#endif /* JERRY_BUILTIN_BIGINT */
+
+/**
+ * Compute the hash of a literal stored in the literal hash table.
+ *
+ * @return hash of the literal
+ */
+static lit_string_hash_t
+ecma_lit_storage_hash_literal (ecma_value_t literal) /**< literal */
+{
+  if (ecma_is_value_string (literal))
+  {
+    return ecma_string_hash (ecma_get_string_from_value (literal));
   }
-} /* ecma_free_number_list */
 
 #if JERRY_BUILTIN_BIGINT
+  if (ecma_is_value_bigint (literal))
+  {
+    return ecma_lit_storage_hash_bigint (ecma_get_extended_primitive_from_value (literal));
+  }
+#endif /* JERRY_BUILTIN_BIGINT */
+
+  return ecma_lit_storage_hash_number (ecma_get_float_from_value (literal));
+} /* ecma_lit_storage_hash_literal */
 
 /**
- * Free bigint list
+ * Store a literal in the first free slot of its probe sequence.
+ *
+ * Note:
+ *   the table must have at least one free slot
  */
 static void
-ecma_free_bigint_list (jmem_cpointer_t bigint_list_cp) /**< bigint list */
+ecma_lit_storage_hash_insert_slot (ecma_lit_storage_hash_t *hash_p, /**< literal hash table */
+                                   ecma_value_t literal, /**< literal */
+                                   lit_string_hash_t hash) /**< hash of the literal */
 {
-  while (bigint_list_cp != JMEM_CP_NULL)
+  ecma_value_t *slots_p = ECMA_LIT_STORAGE_HASH_GET_SLOTS (hash_p);
+  uint32_t slot = hash & hash_p->mask;
+
+  while (slots_p[slot] != ECMA_LIT_STORAGE_HASH_FREE_SLOT)
   {
-    ecma_lit_storage_item_t *bigint_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, bigint_list_cp);
+    slot = (slot + 1) & hash_p->mask;
+  }
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  slots_p[slot] = literal;
+  hash_p->count++;
+} /* ecma_lit_storage_hash_insert_slot */
+
+/**
+ * Insert a new literal into the literal hash table. The table is grown when its load factor exceeds 3/4.
+ */
+static void
+ecma_lit_storage_hash_insert (ecma_value_t literal, /**< literal */
+                              lit_string_hash_t hash) /**< hash of the literal */
+{
+  JERRY_ASSERT (literal != ECMA_LIT_STORAGE_HASH_FREE_SLOT);
+
+  ecma_lit_storage_hash_t *hash_p = JERRY_CONTEXT (lit_storage_hash_p);
+
+  if (hash_p == NULL || (hash_p->count + 1) * 4 > (hash_p->mask + 1) * 3)
+  {
+    uint32_t slot_count = ECMA_LIT_STORAGE_HASH_INITIAL_SIZE;
+
+    if (hash_p != NULL)
     {
-      if (bigint_list_p->values[i] != JMEM_CP_NULL)
+      slot_count = (hash_p->mask + 1) << 1;
+    }
+
+    size_t total_size = ECMA_LIT_STORAGE_HASH_GET_TOTAL_SIZE (slot_count);
+    ecma_lit_storage_hash_t *new_hash_p = (ecma_lit_storage_hash_t *) jmem_heap_alloc_block (total_size);
+
+    new_hash_p->mask = slot_count - 1;
+    new_hash_p->count = 0;
+    memset (ECMA_LIT_STORAGE_HASH_GET_SLOTS (new_hash_p), 0, slot_count * sizeof (ecma_value_t));
+
+    if (hash_p != NULL)
+    {
+      ecma_value_t *slots_p = ECMA_LIT_STORAGE_HASH_GET_SLOTS (hash_p);
+
+      for (uint32_t i = 0; i <= hash_p->mask; i++)
       {
-        ecma_extended_primitive_t *bigint_p =
-          JMEM_CP_GET_NON_NULL_POINTER (ecma_extended_primitive_t, bigint_list_p->values[i]);
-        JERRY_ASSERT (ECMA_EXTENDED_PRIMITIVE_IS_REF_EQUALS_TO_ONE (bigint_p));
-        ecma_deref_bigint (bigint_p);
+        if (slots_p[i] != ECMA_LIT_STORAGE_HASH_FREE_SLOT)
+        {
+          ecma_lit_storage_hash_insert_slot (new_hash_p, slots_p[i], ecma_lit_storage_hash_literal (slots_p[i]));
+        }
       }
+
+      jmem_heap_free_block (hash_p, ECMA_LIT_STORAGE_HASH_GET_TOTAL_SIZE (hash_p->mask + 1));
     }
 
-    jmem_cpointer_t next_item_cp = bigint_list_p->next_cp;
-    jmem_pools_free (bigint_list_p, sizeof (ecma_lit_storage_item_t));
-    bigint_list_cp = next_item_cp;
+    hash_p = new_hash_p;
+    JERRY_CONTEXT (lit_storage_hash_p) = hash_p;
   }
-} /* ecma_free_bigint_list */
 
-#endif /* JERRY_BUILTIN_BIGINT */
+  ecma_lit_storage_hash_insert_slot (hash_p, literal, hash);
+} /* ecma_lit_storage_hash_insert */
 
 /**
  * Finalize literal storage
@@ -145,11 +217,51 @@ void
 ecma_finalize_lit_storage (void)
 {
   ecma_free_symbol_list (JERRY_CONTEXT (symbol_list_first_cp));
-  ecma_free_string_list (JERRY_CONTEXT (string_list_first_cp));
-  ecma_free_number_list (JERRY_CONTEXT (number_list_first_cp));
+
+  ecma_lit_storage_hash_t *hash_p = JERRY_CONTEXT (lit_storage_hash_p);
+
+  if (hash_p == NULL)
+  {
+    return;
+  }
+
+  ecma_value_t *slots_p = ECMA_LIT_STORAGE_HASH_GET_SLOTS (hash_p);
+
+  for (uint32_t i = 0; i <= hash_p->mask; i++)
+  {
+    ecma_value_t literal = slots_p[i];
+
+    if (literal == ECMA_LIT_STORAGE_HASH_FREE_SLOT)
+    {
+      continue;
+    }
+
+    if (ecma_is_value_string (literal))
+    {
+      ecma_string_t *string_p = ecma_get_string_from_value (literal);
+
+      JERRY_ASSERT (ECMA_STRING_IS_REF_EQUALS_TO_ONE (string_p));
+      ecma_destroy_ecma_string (string_p);
+    }
 #if JERRY_BUILTIN_BIGINT
-  ecma_free_bigint_list (JERRY_CONTEXT (bigint_list_first_cp));
+    else if (ecma_is_value_bigint (literal))
+    {
+      ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (literal);
+
+      JERRY_ASSERT (ECMA_EXTENDED_PRIMITIVE_IS_REF_EQUALS_TO_ONE (bigint_p));
+      ecma_deref_bigint (bigint_p);
+    }
 #endif /* JERRY_BUILTIN_BIGINT */
+#if !JERRY_NAN_BOXING
+    else
+    {
+      ecma_dealloc_number (ecma_get_pointer_from_float_value (literal));
+    }
+#endif /* !JERRY_NAN_BOXING */
+  }
+
+  jmem_heap_free_block (hash_p, ECMA_LIT_STORAGE_HASH_GET_TOTAL_SIZE (hash_p->mask + 1));
+  JERRY_CONTEXT (lit_storage_hash_p) = NULL;
 } /* ecma_finalize_lit_storage */
 
 /**
@@ -170,61 +282,38 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
     return ecma_make_string_value (string_p);
   }
 
-  jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  lit_string_hash_t hash = ecma_string_hash (string_p);
+  ecma_lit_storage_hash_t *hash_p = JERRY_CONTEXT (lit_storage_hash_p);
 
-  while (string_list_cp != JMEM_CP_NULL)
+  if (hash_p != NULL)
   {
-    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
+    ecma_value_t *slots_p = ECMA_LIT_STORAGE_HASH_GET_SLOTS (hash_p);
+    uint32_t slot = hash & hash_p->mask;
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    while (slots_p[slot] != ECMA_LIT_STORAGE_HASH_FREE_SLOT)
     {
-      if (string_list_p->values[i] == JMEM_CP_NULL)
+      if (ecma_is_value_string (slots_p[slot]))
       {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = string_list_p->values + i;
-        }
-      }
-      else
-      {
-        ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, string_list_p->values[i]);
+        ecma_string_t *value_p = ecma_get_string_from_value (slots_p[slot]);
 
         if (ecma_compare_ecma_strings (string_p, value_p))
         {
-          /* Return with string if found in the list. */
+          /* Return with string if found in the table. */
           ecma_deref_ecma_string (string_p);
-          return ecma_make_string_value (value_p);
+          return slots_p[slot];
         }
       }
-    }
 
-    string_list_cp = string_list_p->next_cp;
+      slot = (slot + 1) & hash_p->mask;
+    }
   }
 
   ECMA_SET_STRING_AS_STATIC (string_p);
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
-
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return ecma_make_string_value (string_p);
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
 
-  new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
+  ecma_value_t result = ecma_make_string_value (string_p);
+  ecma_lit_storage_hash_insert (result, hash);
 
-  return ecma_make_string_value (string_p);
+  return result;
 } /* ecma_find_or_create_literal_string */
 
 /**
@@ -237,6 +326,10 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
 {
   ecma_value_t num = ecma_make_number_value (number_arg);
 
+#if JERRY_NAN_BOXING
+  /* Floating point numbers are stored inline, so they do not need to be shared. */
+  return num;
+#else /* !JERRY_NAN_BOXING */
   if (ecma_is_value_integer_number (num))
   {
     return num;
@@ -244,59 +337,33 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
 
   JERRY_ASSERT (ecma_is_value_float_number (num));
 
-  jmem_cpointer_t number_list_cp = JERRY_CONTEXT (number_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  lit_string_hash_t hash = ecma_lit_storage_hash_number (number_arg);
+  ecma_lit_storage_hash_t *hash_p = JERRY_CONTEXT (lit_storage_hash_p);
 
-  while (number_list_cp != JMEM_CP_NULL)
+  if (hash_p != NULL)
   {
-    ecma_lit_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, number_list_cp);
+    ecma_value_t *slots_p = ECMA_LIT_STORAGE_HASH_GET_SLOTS (hash_p);
+    uint32_t slot = hash & hash_p->mask;
+    ecma_binary_num_t binary = ecma_number_to_binary (number_arg);
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    while (slots_p[slot] != ECMA_LIT_STORAGE_HASH_FREE_SLOT)
     {
-      if (number_list_p->values[i] == JMEM_CP_NULL)
+      /* Numbers are compared by their binary representation, so -0 and NaN literals are also shared. */
+      if (ecma_is_value_float_number (slots_p[slot])
+          && ecma_number_to_binary (ecma_get_float_from_value (slots_p[slot])) == binary)
       {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = number_list_p->values + i;
-        }
+        ecma_free_value (num);
+        return slots_p[slot];
       }
-      else
-      {
-        ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, number_list_p->values[i]);
 
-        if (*number_p == number_arg)
-        {
-          ecma_free_value (num);
-          return ecma_make_float_value (number_p);
-        }
-      }
+      slot = (slot + 1) & hash_p->mask;
     }
-
-    number_list_cp = number_list_p->next_cp;
-  }
-
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_pointer_from_float_value (num));
-
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return num;
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
   }
 
-  new_item_p->next_cp = JERRY_CONTEXT (number_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (number_list_first_cp), new_item_p);
+  ecma_lit_storage_hash_insert (num, hash);
 
   return num;
+#endif /* JERRY_NAN_BOXING */
 } /* ecma_find_or_create_literal_number */
 
 #if JERRY_BUILTIN_BIGINT
@@ -316,59 +383,27 @@ ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searc
     return bigint;
   }
 
-  jmem_cpointer_t bigint_list_cp = JERRY_CONTEXT (bigint_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  lit_string_hash_t hash = ecma_lit_storage_hash_bigint (ecma_get_extended_primitive_from_value (bigint));
+  ecma_lit_storage_hash_t *hash_p = JERRY_CONTEXT (lit_storage_hash_p);
 
-  while (bigint_list_cp != JMEM_CP_NULL)
+  if (hash_p != NULL)
   {
-    ecma_lit_storage_item_t *bigint_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, bigint_list_cp);
+    ecma_value_t *slots_p = ECMA_LIT_STORAGE_HASH_GET_SLOTS (hash_p);
+    uint32_t slot = hash & hash_p->mask;
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    while (slots_p[slot] != ECMA_LIT_STORAGE_HASH_FREE_SLOT)
     {
-      if (bigint_list_p->values[i] == JMEM_CP_NULL)
+      if (ecma_is_value_bigint (slots_p[slot]) && ecma_bigint_is_equal_to_bigint (bigint, slots_p[slot]))
       {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = bigint_list_p->values + i;
-        }
+        ecma_free_value (bigint);
+        return slots_p[slot];
       }
-      else
-      {
-        ecma_extended_primitive_t *other_bigint_p =
-          JMEM_CP_GET_NON_NULL_POINTER (ecma_extended_primitive_t, bigint_list_p->values[i]);
-        ecma_value_t other_bigint = ecma_make_extended_primitive_value (other_bigint_p, ECMA_TYPE_BIGINT);
 
-        if (ecma_bigint_is_equal_to_bigint (bigint, other_bigint))
-        {
-          ecma_free_value (bigint);
-          return other_bigint;
-        }
-      }
+      slot = (slot + 1) & hash_p->mask;
     }
-
-    bigint_list_cp = bigint_list_p->next_cp;
-  }
-
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_extended_primitive_from_value (bigint));
-
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return bigint;
   }
 
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (bigint_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (bigint_list_first_cp), new_item_p);
+  ecma_lit_storage_hash_insert (bigint, hash);
 
   return bigint;
 } /* ecma_find_or_create_literal_bigint */
@@ -451,6 +486,17 @@ ecma_save_literals_add_compiled_code (const ecma_compiled_code_t *compiled_code_
 
   JERRY_ASSERT (CBC_IS_FUNCTION (compiled_code_p->status_flags));
 
+#if JERRY_LAZY_FUNCTIONS
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+  {
+    /* The snapshot generator compiles all lazy functions before the literals are collected. */
+    ecma_value_t lazy_compiled_code = ((cbc_lazy_function_t *) compiled_code_p)->compiled_code;
+
+    JERRY_ASSERT (!ECMA_IS_INTERNAL_VALUE_NULL (lazy_compiled_code));
+    compiled_code_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_compiled_code_t, lazy_compiled_code);
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
     cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) compiled_code_p;
@@ -887,6 +887,7 @@ ecma_module_create_namespace_object (ecma_module_t *module_p) /**< module */
                                                           ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE,
                                                           NULL);
       property_value_p->value = buffer_p[1];
+      ECMA_GC_REMEMBER_VALUE (buffer_p[1]);
     }
     else
     {
@@ -966,6 +967,7 @@ ecma_module_connect_imports (ecma_module_t *module_p)
         value_p =
           ecma_create_named_data_property (module_p->scope_p, import_names_p->local_name_p, ECMA_PROPERTY_FIXED, NULL);
         value_p->value = ecma_make_object_value (imported_module_p->namespace_object_p);
+        ECMA_GC_REMEMBER_OBJECT (imported_module_p->namespace_object_p);
       }
       else
       {
@@ -985,6 +987,7 @@ ecma_module_connect_imports (ecma_module_t *module_p)
                                                               ECMA_PROPERTY_FIXED,
                                                               NULL);
           property_value_p->value = resolve_result.result;
+          ECMA_GC_REMEMBER_VALUE (resolve_result.result);
         }
         else
         {
@@ -1228,6 +1231,7 @@ restart:
       ECMA_SET_INTERNAL_VALUE_POINTER (ext_object_p->u.cls.u3.value, module_p);
 
       current_module_p->namespace_object_p = namespace_object_p;
+      ECMA_GC_REMEMBER_OBJECT (namespace_object_p);
       ecma_deref_object (namespace_object_p);
     }
 
@@ -0,0 +1,752 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-shape.h"
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-lcache.h"
+
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Object shapes
+ * @{
+ */
+
+#if JERRY_OBJECT_SHAPES
+
+JERRY_STATIC_ASSERT (ECMA_SHAPE_MAX_PROPERTIES <= UINT8_MAX, ecma_shape_max_properties_must_fit_into_a_byte);
+JERRY_STATIC_ASSERT ((ECMA_SHAPE_MAX_PROPERTIES & (ECMA_SHAPE_MAX_PROPERTIES - 1)) == 0,
+                     ecma_shape_max_properties_must_be_power_of_2);
+JERRY_STATIC_ASSERT (ECMA_PROPERTY_TYPE_SHAPE != ECMA_PROPERTY_TYPE_HASHMAP,
+                     ecma_property_type_shape_must_differ_from_hashmap);
+JERRY_STATIC_ASSERT (!ECMA_PROPERTY_IS_NAMED_PROPERTY (ECMA_PROPERTY_TYPE_SHAPE),
+                     ecma_property_type_shape_must_not_be_a_named_property);
+JERRY_STATIC_ASSERT (sizeof (ecma_shape_property_pair_t) == offsetof (ecma_property_pair_t, names_cp),
+                     ecma_shape_property_pair_must_have_the_same_layout_as_ecma_property_pair);
+
+/**
+ * Minimum capacity of name tables.
+ */
+#define ECMA_SHAPE_NAMES_MINIMUM_CAPACITY 4
+
+/**
+ * Get the hash index of a name table.
+ */
+#define ECMA_SHAPE_GET_HASH_INDEX(names_p) ((uint8_t *) (ECMA_SHAPE_GET_NAME_TYPES (names_p) + (names_p)->capacity))
+
+/**
+ * Compute the size of a name table.
+ */
+#define ECMA_SHAPE_NAMES_GET_SIZE(capacity)                                           \
+  (sizeof (ecma_shape_names_t) + (capacity) * (sizeof (jmem_cpointer_t) + sizeof (ecma_property_t)) \
+   + ((capacity) > ECMA_SHAPE_NAMES_HASH_LIMIT ? 2 * (capacity) : 0))
+
+/**
+ * Compute the size of a shaped property list.
+ */
+#define ECMA_SHAPE_PROPERTY_LIST_GET_SIZE(pair_count) \
+  (ECMA_SHAPE_PAIRS_OFFSET + (pair_count) * sizeof (ecma_shape_property_pair_t))
+
+/**
+ * Insert a name into the hash index of a name table.
+ */
+static void
+ecma_shape_names_insert_hash (ecma_shape_names_t *names_p, /**< name table */
+                              uint32_t index) /**< index of the name */
+{
+  JERRY_ASSERT (names_p->capacity > ECMA_SHAPE_NAMES_HASH_LIMIT && index < names_p->count);
+
+  uint8_t *hash_index_p = ECMA_SHAPE_GET_HASH_INDEX (names_p);
+  uint32_t mask = 2u * names_p->capacity - 1;
+  uint32_t entry_index =
+    ecma_string_get_property_name_hash (ECMA_SHAPE_GET_NAME_TYPES (names_p)[index], ECMA_SHAPE_GET_NAMES (names_p)[index]);
+
+  entry_index &= mask;
+
+  while (hash_index_p[entry_index] != 0)
+  {
+    entry_index = (entry_index + 1) & mask;
+  }
+
+  hash_index_p[entry_index] = (uint8_t) (index + 1);
+} /* ecma_shape_names_insert_hash */
+
+/**
+ * Allocate a name table, and copy the first names of another table into it.
+ *
+ * @return pointer to the new name table
+ */
+static ecma_shape_names_t *
+ecma_shape_names_create (ecma_shape_names_t *source_p, /**< source table or NULL */
+                         uint32_t count) /**< number of names copied from the source table */
+{
+  uint32_t capacity = ECMA_SHAPE_NAMES_MINIMUM_CAPACITY;
+
+  while (capacity <= count)
+  {
+    capacity <<= 1;
+  }
+
+  JERRY_ASSERT (capacity <= ECMA_SHAPE_MAX_PROPERTIES);
+
+  size_t size = ECMA_SHAPE_NAMES_GET_SIZE (capacity);
+  ecma_shape_names_t *names_p = (ecma_shape_names_t *) jmem_pools_alloc (size);
+
+  memset (names_p, 0, size);
+  names_p->capacity = (uint8_t) capacity;
+
+  if (count == 0)
+  {
+    return names_p;
+  }
+
+  JERRY_ASSERT (source_p != NULL && count <= source_p->count);
+
+  jmem_cpointer_t *names_cp_p = ECMA_SHAPE_GET_NAMES (names_p);
+  ecma_property_t *name_types_p = ECMA_SHAPE_GET_NAME_TYPES (names_p);
+
+  memcpy (names_cp_p, ECMA_SHAPE_GET_NAMES (source_p), count * sizeof (jmem_cpointer_t));
+  memcpy (name_types_p, ECMA_SHAPE_GET_NAME_TYPES (source_p), count * sizeof (ecma_property_t));
+  names_p->count = (uint8_t) count;
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    if (ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[i]) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[i]));
+    }
+
+    if (capacity > ECMA_SHAPE_NAMES_HASH_LIMIT)
+    {
+      ecma_shape_names_insert_hash (names_p, i);
+    }
+  }
+
+  return names_p;
+} /* ecma_shape_names_create */
+
+/**
+ * Decrease the reference counter of a name table, and free it when it is unused.
+ */
+static void
+ecma_shape_names_deref (ecma_shape_names_t *names_p) /**< name table */
+{
+  JERRY_ASSERT (names_p->refs > 0);
+
+  if (--names_p->refs > 0)
+  {
+    return;
+  }
+
+  jmem_cpointer_t *names_cp_p = ECMA_SHAPE_GET_NAMES (names_p);
+  ecma_property_t *name_types_p = ECMA_SHAPE_GET_NAME_TYPES (names_p);
+
+  for (uint32_t i = 0; i < names_p->count; i++)
+  {
+    if (ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[i]) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[i]));
+    }
+  }
+
+  jmem_pools_free (names_p, ECMA_SHAPE_NAMES_GET_SIZE (names_p->capacity));
+} /* ecma_shape_names_deref */
+
+/**
+ * Find a property name in the first count names of a name table.
+ *
+ * @return index of the name - if found
+ *         ECMA_SHAPE_PROPERTY_NOT_FOUND - otherwise
+ */
+static uint32_t
+ecma_shape_names_find (ecma_shape_names_t *names_p, /**< name table */
+                       uint32_t count, /**< number of names used by the shape */
+                       ecma_string_t *name_p) /**< property name */
+{
+  JERRY_ASSERT (count <= names_p->count);
+
+  jmem_cpointer_t *names_cp_p = ECMA_SHAPE_GET_NAMES (names_p);
+  ecma_property_t *name_types_p = ECMA_SHAPE_GET_NAME_TYPES (names_p);
+
+  if (names_p->capacity > ECMA_SHAPE_NAMES_HASH_LIMIT)
+  {
+    uint8_t *hash_index_p = ECMA_SHAPE_GET_HASH_INDEX (names_p);
+    uint32_t mask = 2u * names_p->capacity - 1;
+    uint32_t entry_index = ecma_string_hash (name_p) & mask;
+
+    while (hash_index_p[entry_index] != 0)
+    {
+      uint32_t index = (uint32_t) hash_index_p[entry_index] - 1;
+
+      /* Names above count are used by other shapes. */
+      if (index < count && ecma_string_compare_to_property_name (name_types_p[index], names_cp_p[index], name_p))
+      {
+        return index;
+      }
+
+      entry_index = (entry_index + 1) & mask;
+    }
+
+    return ECMA_SHAPE_PROPERTY_NOT_FOUND;
+  }
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    ecma_property_t name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    jmem_cpointer_t name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+      if (names_cp_p[index] == name_cp && ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[index]) == name_type)
+      {
+        return index;
+      }
+    }
+
+    return ECMA_SHAPE_PROPERTY_NOT_FOUND;
+  }
+
+  for (uint32_t index = 0; index < count; index++)
+  {
+    if (ECMA_PROPERTY_GET_NAME_TYPE (name_types_p[index]) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_string_t *prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[index]);
+
+      if (ecma_compare_ecma_non_direct_strings (name_p, prop_name_p))
+      {
+        return index;
+      }
+    }
+  }
+
+  return ECMA_SHAPE_PROPERTY_NOT_FOUND;
+} /* ecma_shape_names_find */
+
+/**
+ * Find the shape which is created from a shape by adding a property.
+ *
+ * @return pointer to the shape - if found
+ *         NULL - otherwise
+ */
+static ecma_shape_t *
+ecma_shape_find_transition (ecma_shape_t *shape_p, /**< shape or NULL for objects without properties */
+                            ecma_string_t *name_p, /**< name of the new property */
+                            uint32_t *transition_count_p) /**< [out] number of checked shapes */
+{
+  jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_root_shapes_cp);
+  uint32_t count = 0;
+
+  if (shape_p != NULL)
+  {
+    iter_cp = shape_p->children_cp;
+    count = shape_p->property_count;
+  }
+
+  uint32_t transition_count = 0;
+
+  while (iter_cp != JMEM_CP_NULL)
+  {
+    ecma_shape_t *iter_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, iter_cp);
+    ecma_shape_names_t *names_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, iter_p->names_cp);
+
+    JERRY_ASSERT (iter_p->property_count == count + 1);
+
+    if (ecma_string_compare_to_property_name (ECMA_SHAPE_GET_NAME_TYPES (names_p)[count],
+                                              ECMA_SHAPE_GET_NAMES (names_p)[count],
+                                              name_p))
+    {
+      return iter_p;
+    }
+
+    transition_count++;
+    iter_cp = iter_p->next_cp;
+  }
+
+  *transition_count_p = transition_count;
+  return NULL;
+} /* ecma_shape_find_transition */
+
+/**
+ * Create a new shape by adding a property to a shape.
+ *
+ * @return pointer to the new shape
+ */
+static ecma_shape_t *
+ecma_shape_create_transition (ecma_shape_t *shape_p, /**< shape or NULL for objects without properties */
+                              ecma_string_t *name_p) /**< name of the new property */
+{
+  ecma_shape_t *new_shape_p = (ecma_shape_t *) jmem_pools_alloc (sizeof (ecma_shape_t));
+
+  uint32_t count = 0;
+  ecma_shape_names_t *names_p = NULL;
+
+  if (shape_p != NULL)
+  {
+    count = shape_p->property_count;
+    names_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, shape_p->names_cp);
+  }
+
+  /* The name table is shared with the parent shape when the new name can be appended to its end. */
+  if (names_p == NULL || names_p->count != count || count == names_p->capacity)
+  {
+    names_p = ecma_shape_names_create (names_p, count);
+  }
+
+  ecma_property_t name_type;
+  jmem_cpointer_t name_cp = ecma_string_to_property_name (name_p, &name_type);
+
+  ECMA_SHAPE_GET_NAMES (names_p)[count] = name_cp;
+  ECMA_SHAPE_GET_NAME_TYPES (names_p)[count] = name_type;
+  names_p->count = (uint8_t) (count + 1);
+  names_p->refs++;
+
+  if (names_p->capacity > ECMA_SHAPE_NAMES_HASH_LIMIT)
+  {
+    ecma_shape_names_insert_hash (names_p, count);
+  }
+
+  new_shape_p->refs = 0;
+  new_shape_p->parent_cp = JMEM_CP_NULL;
+  new_shape_p->children_cp = JMEM_CP_NULL;
+  new_shape_p->property_count = (uint8_t) (count + 1);
+  new_shape_p->max_property_count = (uint8_t) (count + 1);
+  ECMA_SET_NON_NULL_POINTER (new_shape_p->names_cp, names_p);
+
+  if (shape_p != NULL)
+  {
+    shape_p->refs++;
+    ECMA_SET_NON_NULL_POINTER (new_shape_p->parent_cp, shape_p);
+    new_shape_p->next_cp = shape_p->children_cp;
+    ECMA_SET_NON_NULL_POINTER (shape_p->children_cp, new_shape_p);
+
+    /* Objects which get the same first properties usually get the same number of properties. */
+    while (shape_p->max_property_count <= count)
+    {
+      shape_p->max_property_count = (uint8_t) (count + 1);
+
+      if (shape_p->parent_cp == JMEM_CP_NULL)
+      {
+        break;
+      }
+
+      shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+    }
+  }
+  else
+  {
+    new_shape_p->next_cp = JERRY_CONTEXT (ecma_root_shapes_cp);
+    ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_root_shapes_cp), new_shape_p);
+  }
+
+  return new_shape_p;
+} /* ecma_shape_create_transition */
+
+/**
+ * Decrease the reference counter of a shape, and free it when it is unused.
+ */
+static void
+ecma_shape_deref (ecma_shape_t *shape_p) /**< shape */
+{
+  do
+  {
+    JERRY_ASSERT (shape_p->refs > 0);
+
+    if (--shape_p->refs > 0)
+    {
+      return;
+    }
+
+    /* Shapes created from this shape hold a reference to it. */
+    JERRY_ASSERT (shape_p->children_cp == JMEM_CP_NULL);
+
+    ecma_shape_t *parent_p = NULL;
+    jmem_cpointer_t *iter_cp_p = &JERRY_CONTEXT (ecma_root_shapes_cp);
+
+    if (shape_p->parent_cp != JMEM_CP_NULL)
+    {
+      parent_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+      iter_cp_p = &parent_p->children_cp;
+    }
+
+    while (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *iter_cp_p) != shape_p)
+    {
+      iter_cp_p = &ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *iter_cp_p)->next_cp;
+    }
+
+    *iter_cp_p = shape_p->next_cp;
+
+    ecma_shape_names_deref (ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, shape_p->names_cp));
+    jmem_pools_free (shape_p, sizeof (ecma_shape_t));
+
+    shape_p = parent_p;
+  } while (shape_p != NULL);
+} /* ecma_shape_deref */
+
+/**
+ * Allocate a shaped property list.
+ *
+ * @return pointer to the property list
+ */
+static ecma_shape_property_list_t *
+ecma_shape_alloc_property_list (uint32_t pair_count) /**< number of property pairs */
+{
+  size_t size = ECMA_SHAPE_PROPERTY_LIST_GET_SIZE (pair_count);
+
+#if JERRY_MEM_STATS
+  jmem_stats_allocate_property_bytes (size);
+#endif /* JERRY_MEM_STATS */
+
+  ecma_shape_property_list_t *list_p = (ecma_shape_property_list_t *) jmem_pools_alloc (size);
+
+  list_p->header.types[0] = ECMA_PROPERTY_TYPE_SHAPE;
+  list_p->header.types[1] = (ecma_property_t) pair_count;
+  return list_p;
+} /* ecma_shape_alloc_property_list */
+
+/**
+ * Free a shaped property list.
+ */
+static void
+ecma_shape_free_property_list (ecma_shape_property_list_t *list_p) /**< property list */
+{
+  size_t size = ECMA_SHAPE_PROPERTY_LIST_GET_SIZE (list_p->header.types[1]);
+
+#if JERRY_MEM_STATS
+  jmem_stats_free_property_bytes (size);
+#endif /* JERRY_MEM_STATS */
+
+  jmem_pools_free (list_p, size);
+} /* ecma_shape_free_property_list */
+
+/**
+ * Invalidate the LCache entries of the properties of a shaped property list.
+ */
+static void
+ecma_shape_invalidate_lcache (ecma_object_t *object_p, /**< object */
+                              ecma_shape_property_list_t *list_p) /**< property list of the object */
+{
+#if JERRY_LCACHE
+  ecma_shape_t *shape_p = ECMA_SHAPE_FROM_LIST (list_p);
+  ecma_shape_names_t *names_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, shape_p->names_cp);
+  ecma_shape_property_pair_t *pairs_p = ECMA_SHAPE_GET_PAIRS (list_p);
+
+  for (uint32_t index = 0; index < shape_p->property_count; index++)
+  {
+    ecma_property_t *property_p = ECMA_SHAPE_GET_PROPERTY (pairs_p, index);
+
+    if (ecma_is_property_lcached (property_p))
+    {
+      ecma_lcache_invalidate (object_p, ECMA_SHAPE_GET_NAMES (names_p)[index], property_p);
+    }
+  }
+#else /* !JERRY_LCACHE */
+  JERRY_UNUSED (object_p);
+  JERRY_UNUSED (list_p);
+#endif /* JERRY_LCACHE */
+} /* ecma_shape_invalidate_lcache */
+
+/**
+ * Create a property in an object which has a shape or has no properties.
+ *
+ * Note:
+ *      when the property cannot be stored in a shaped property list, the
+ *      object is converted to a property list, and NULL is returned
+ *
+ * @return pointer to the newly created property value - if successful
+ *         NULL - otherwise
+ */
+ecma_property_value_t *
+ecma_shape_create_property (ecma_object_t *object_p, /**< the object */
+                            ecma_string_t *name_p, /**< property name */
+                            uint8_t type_and_flags, /**< type and flags, see ecma_property_info_t */
+                            ecma_property_value_t value, /**< property value */
+                            ecma_property_t **out_prop_p) /**< [out] the property is also returned
+                                                           *         if this field is non-NULL */
+{
+  JERRY_ASSERT (ECMA_SHAPE_OBJECT_CAN_HAVE_SHAPE (object_p));
+
+  ecma_shape_property_list_t *list_p = NULL;
+  ecma_shape_t *shape_p = NULL;
+  uint32_t count = 0;
+
+  if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+  {
+    list_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_property_list_t, object_p->u1.property_list_cp);
+
+    if (list_p->header.types[0] != ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      return NULL;
+    }
+
+    shape_p = ECMA_SHAPE_FROM_LIST (list_p);
+    count = shape_p->property_count;
+  }
+
+  /* Internal properties are only stored in property lists. */
+  if (JERRY_UNLIKELY (ECMA_IS_DIRECT_STRING (name_p) && ECMA_GET_DIRECT_STRING_TYPE (name_p) == ECMA_DIRECT_STRING_SPECIAL)
+      || JERRY_UNLIKELY (count >= ECMA_SHAPE_MAX_PROPERTIES))
+  {
+    goto convert;
+  }
+
+  uint32_t transition_count;
+  ecma_shape_t *new_shape_p = ecma_shape_find_transition (shape_p, name_p, &transition_count);
+
+  if (new_shape_p == NULL)
+  {
+    if (JERRY_UNLIKELY (transition_count >= ECMA_SHAPE_MAX_TRANSITIONS))
+    {
+      goto convert;
+    }
+
+    new_shape_p = ecma_shape_create_transition (shape_p, name_p);
+  }
+
+  /* The reference must be taken before any allocation, since the
+   * garbage collector may free the shapes which are not referenced. */
+  new_shape_p->refs++;
+
+  if (list_p == NULL || (count >> 1) >= list_p->header.types[1])
+  {
+    uint32_t pair_count = ((uint32_t) new_shape_p->max_property_count + 1) >> 1;
+    ecma_shape_property_list_t *new_list_p = ecma_shape_alloc_property_list (pair_count);
+
+    if (list_p != NULL)
+    {
+      ecma_shape_invalidate_lcache (object_p, list_p);
+      memcpy (ECMA_SHAPE_GET_PAIRS (new_list_p),
+              ECMA_SHAPE_GET_PAIRS (list_p),
+              list_p->header.types[1] * sizeof (ecma_shape_property_pair_t));
+      ecma_shape_free_property_list (list_p);
+    }
+
+    list_p = new_list_p;
+    ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, list_p);
+  }
+
+  ecma_shape_property_pair_t *pairs_p = ECMA_SHAPE_GET_PAIRS (list_p);
+  ecma_shape_names_t *names_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, new_shape_p->names_cp);
+  ecma_property_t *property_p = ECMA_SHAPE_GET_PROPERTY (pairs_p, count);
+  ecma_property_value_t *property_value_p = ECMA_SHAPE_GET_PROPERTY_VALUE (pairs_p, count);
+
+  if ((count & 0x1) == 0)
+  {
+    pairs_p[count >> 1].header.types[1] = ECMA_PROPERTY_TYPE_DELETED;
+    pairs_p[count >> 1].header.next_property_cp = JMEM_CP_NULL;
+  }
+
+  *property_p = (ecma_property_t) (type_and_flags | ECMA_SHAPE_GET_NAME_TYPES (names_p)[count]);
+  *property_value_p = value;
+
+  JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p) == property_value_p);
+
+  ECMA_SET_NON_NULL_POINTER (list_p->header.next_property_cp, new_shape_p);
+
+  if (shape_p != NULL)
+  {
+    ecma_shape_deref (shape_p);
+  }
+
+  if (out_prop_p != NULL)
+  {
+    *out_prop_p = property_p;
+  }
+
+  return property_value_p;
+
+convert:
+  if (list_p != NULL)
+  {
+    ecma_shape_convert_to_property_list (object_p, NULL);
+  }
+
+  return NULL;
+} /* ecma_shape_create_property */
+
+/**
+ * Find the index of a property in a shape.
+ *
+ * @return index of the property - if found
+ *         ECMA_SHAPE_PROPERTY_NOT_FOUND - otherwise
+ */
+uint32_t
+ecma_shape_find_property_index (ecma_shape_t *shape_p, /**< shape */
+                                ecma_string_t *name_p) /**< property name */
+{
+  ecma_shape_names_t *names_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, shape_p->names_cp);
+  return ecma_shape_names_find (names_p, shape_p->property_count, name_p);
+} /* ecma_shape_find_property_index */
+
+/**
+ * Find a property of an object which has a shape.
+ *
+ * @return pointer to the property - if found
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_shape_find_property (ecma_object_t *object_p, /**< object */
+                          ecma_shape_property_list_t *list_p, /**< property list of the object */
+                          ecma_string_t *name_p) /**< property name */
+{
+  JERRY_UNUSED (object_p);
+
+  ecma_shape_t *shape_p = ECMA_SHAPE_FROM_LIST (list_p);
+  ecma_shape_names_t *names_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, shape_p->names_cp);
+  uint32_t index = ecma_shape_names_find (names_p, shape_p->property_count, name_p);
+
+  if (index == ECMA_SHAPE_PROPERTY_NOT_FOUND)
+  {
+    return NULL;
+  }
+
+  ecma_property_t *property_p = ECMA_SHAPE_GET_PROPERTY (ECMA_SHAPE_GET_PAIRS (list_p), index);
+
+  JERRY_ASSERT (ECMA_PROPERTY_IS_RAW (*property_p));
+
+#if JERRY_LCACHE
+  if (!ecma_is_property_lcached (property_p))
+  {
+    ecma_lcache_insert (object_p, ECMA_SHAPE_GET_NAMES (names_p)[index], property_p);
+  }
+#endif /* JERRY_LCACHE */
+
+  return property_p;
+} /* ecma_shape_find_property */
+
+/**
+ * Convert an object which has a shape to an object which stores its properties in a property list.
+ *
+ * @return the new location of prop_value_p - if prop_value_p is not NULL
+ *         NULL - otherwise
+ */
+ecma_property_value_t *
+ecma_shape_convert_to_property_list (ecma_object_t *object_p, /**< object */
+                                     ecma_property_value_t *prop_value_p) /**< property value of the object
+                                                                           *   or NULL */
+{
+  ecma_shape_property_list_t *list_p =
+    ECMA_GET_NON_NULL_POINTER (ecma_shape_property_list_t, object_p->u1.property_list_cp);
+
+  JERRY_ASSERT (list_p->header.types[0] == ECMA_PROPERTY_TYPE_SHAPE);
+
+  ecma_shape_t *shape_p = ECMA_SHAPE_FROM_LIST (list_p);
+  ecma_shape_names_t *names_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, shape_p->names_cp);
+  jmem_cpointer_t *names_cp_p = ECMA_SHAPE_GET_NAMES (names_p);
+  uint32_t count = shape_p->property_count;
+  jmem_cpointer_t property_list_cp = JMEM_CP_NULL;
+  ecma_property_value_t *result_p = NULL;
+
+  /* The first property of a pair is the newer one, and the newest pair is the first in the list. */
+  for (uint32_t index = 0; index < count; index++)
+  {
+    uint32_t item_index = ECMA_PROPERTY_PAIR_ITEM_COUNT - 1 - (index & 0x1);
+
+    if (item_index == ECMA_PROPERTY_PAIR_ITEM_COUNT - 1)
+    {
+      /* The values are still referenced by the shaped property list if a garbage collection is started. */
+      ecma_property_pair_t *property_pair_p = ecma_alloc_property_pair ();
+
+      list_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_property_list_t, object_p->u1.property_list_cp);
+
+      property_pair_p->header.next_property_cp = property_list_cp;
+      property_pair_p->header.types[0] = ECMA_PROPERTY_TYPE_DELETED;
+      property_pair_p->names_cp[0] = LIT_INTERNAL_MAGIC_STRING_DELETED;
+      ECMA_SET_NON_NULL_POINTER (property_list_cp, property_pair_p);
+    }
+
+    ecma_property_pair_t *property_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_property_pair_t, property_list_cp);
+    ecma_shape_property_pair_t *pairs_p = ECMA_SHAPE_GET_PAIRS (list_p);
+    ecma_property_t property = *ECMA_SHAPE_GET_PROPERTY (pairs_p, index);
+    ecma_property_value_t *value_p = ECMA_SHAPE_GET_PROPERTY_VALUE (pairs_p, index);
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[index]));
+    }
+
+    property_pair_p->header.types[item_index] = (ecma_property_t) (property & ~ECMA_PROPERTY_FLAG_LCACHED);
+    property_pair_p->values[item_index] = *value_p;
+    property_pair_p->names_cp[item_index] = names_cp_p[index];
+
+    if (value_p == prop_value_p)
+    {
+      result_p = property_pair_p->values + item_index;
+    }
+  }
+
+  ecma_shape_invalidate_lcache (object_p, list_p);
+
+  object_p->u1.property_list_cp = property_list_cp;
+
+  ecma_shape_free_property_list (list_p);
+  ecma_shape_deref (shape_p);
+
+  JERRY_ASSERT (prop_value_p == NULL || result_p != NULL);
+  return result_p;
+} /* ecma_shape_convert_to_property_list */
+
+/**
+ * Free the properties of an object which has a shape.
+ */
+void
+ecma_shape_free_properties (ecma_object_t *object_p) /**< object */
+{
+  ecma_shape_property_list_t *list_p =
+    ECMA_GET_NON_NULL_POINTER (ecma_shape_property_list_t, object_p->u1.property_list_cp);
+
+  JERRY_ASSERT (list_p->header.types[0] == ECMA_PROPERTY_TYPE_SHAPE);
+
+  ecma_shape_t *shape_p = ECMA_SHAPE_FROM_LIST (list_p);
+  ecma_shape_property_pair_t *pairs_p = ECMA_SHAPE_GET_PAIRS (list_p);
+
+  ecma_shape_invalidate_lcache (object_p, list_p);
+
+  for (uint32_t index = 0; index < shape_p->property_count; index++)
+  {
+    ecma_property_t property = *ECMA_SHAPE_GET_PROPERTY (pairs_p, index);
+    ecma_property_value_t *value_p = ECMA_SHAPE_GET_PROPERTY_VALUE (pairs_p, index);
+
+    JERRY_ASSERT (ECMA_PROPERTY_IS_RAW (property));
+
+    if (property & ECMA_PROPERTY_FLAG_DATA)
+    {
+      ecma_free_value_if_not_object (value_p->value);
+      continue;
+    }
+
+#if JERRY_CPOINTER_32_BIT
+    ecma_getter_setter_pointers_t *getter_setter_pair_p;
+    getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t, value_p->getter_setter_pair_cp);
+    jmem_pools_free (getter_setter_pair_p, sizeof (ecma_getter_setter_pointers_t));
+#endif /* JERRY_CPOINTER_32_BIT */
+  }
+
+  object_p->u1.property_list_cp = JMEM_CP_NULL;
+
+  ecma_shape_free_property_list (list_p);
+  ecma_shape_deref (shape_p);
+} /* ecma_shape_free_properties */
+
+#endif /* JERRY_OBJECT_SHAPES */
+
+/**
+ * @}
+ * @}
+ */
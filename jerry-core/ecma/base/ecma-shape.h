@@ -0,0 +1,176 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPE_H
+#define ECMA_SHAPE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Object shapes
+ * @{
+ */
+
+#if JERRY_OBJECT_SHAPES
+
+/**
+ * Maximum number of properties of an object with a shape. Objects with
+ * more properties are converted to property lists.
+ */
+#define ECMA_SHAPE_MAX_PROPERTIES 64
+
+/**
+ * Maximum number of shapes which can be created from a single shape.
+ */
+#define ECMA_SHAPE_MAX_TRANSITIONS 64
+
+/**
+ * Name tables with more than this number of names have a hash index.
+ */
+#define ECMA_SHAPE_NAMES_HASH_LIMIT 8
+
+/**
+ * Property index returned when a property is not found.
+ */
+#define ECMA_SHAPE_PROPERTY_NOT_FOUND UINT32_MAX
+
+/**
+ * Shared table of property names.
+ *
+ * Shapes on the same transition path share the same name table: a shape
+ * with n properties uses the first n names of the table. The table is
+ * followed by capacity number of jmem_cpointer_t names, capacity number
+ * of ecma_property_t name types, and a hash index of 2 * capacity bytes
+ * when capacity is greater than ECMA_SHAPE_NAMES_HASH_LIMIT. The hash
+ * index contains property indices increased by one, and zero for unused
+ * entries.
+ */
+typedef struct
+{
+  uint32_t refs; /**< number of shapes which use this table */
+  uint8_t count; /**< number of names in the table */
+  uint8_t capacity; /**< maximum number of names */
+} ecma_shape_names_t;
+
+/**
+ * Node of the shape transition tree.
+ *
+ * A shape describes the property layout of objects: the names of their
+ * properties and the index of each property. Objects created by the same
+ * code usually have the same shape, so the layout is shared between them.
+ */
+typedef struct
+{
+  uint32_t refs; /**< number of objects and child shapes which reference this shape */
+  jmem_cpointer_t parent_cp; /**< shape without the last property,
+                              *   JMEM_CP_NULL for shapes with a single property */
+  jmem_cpointer_t children_cp; /**< first shape which has one more property than this shape */
+  jmem_cpointer_t next_cp; /**< next shape which has the same parent */
+  jmem_cpointer_t names_cp; /**< name table */
+  uint8_t property_count; /**< number of properties */
+  uint8_t max_property_count; /**< maximum number of properties of the shapes created from this shape,
+                               *   used for preallocating the property lists */
+} ecma_shape_t;
+
+/**
+ * Property list of an object with a shape.
+ *
+ * The header is followed by property pairs without property names. The
+ * names are stored in the shape, and only the type bytes and the values
+ * are stored in the object. The layout of the pairs is the same as the
+ * layout of ecma_property_pair_t, so ECMA_PROPERTY_VALUE_PTR can be used
+ * for the properties of the list.
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< types[0]: ECMA_PROPERTY_TYPE_SHAPE,
+                                  *   types[1]: number of allocated property pairs,
+                                  *   next_property_cp: shape of the object */
+} ecma_shape_property_list_t;
+
+/**
+ * Property pair of an object with a shape.
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< types of the properties, next_property_cp is unused */
+  ecma_property_value_t values[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< property value slots */
+} ecma_shape_property_pair_t;
+
+/**
+ * Get the property pairs of a shaped property list.
+ */
+#define ECMA_SHAPE_GET_PAIRS(list_p) \
+  ((ecma_shape_property_pair_t *) (((uint8_t *) (list_p)) + ECMA_SHAPE_PAIRS_OFFSET))
+
+/**
+ * Offset of the first property pair of a shaped property list.
+ */
+#define ECMA_SHAPE_PAIRS_OFFSET JERRY_ALIGNUP (sizeof (ecma_shape_property_list_t), sizeof (ecma_value_t))
+
+/**
+ * Get the shape of a shaped property list.
+ */
+#define ECMA_SHAPE_FROM_LIST(list_p) ECMA_GET_NON_NULL_POINTER (ecma_shape_t, (list_p)->header.next_property_cp)
+
+/**
+ * Get the compressed pointers of the names of a name table.
+ */
+#define ECMA_SHAPE_GET_NAMES(names_p) ((jmem_cpointer_t *) ((names_p) + 1))
+
+/**
+ * Get the name types of a name table.
+ */
+#define ECMA_SHAPE_GET_NAME_TYPES(names_p) ((ecma_property_t *) (ECMA_SHAPE_GET_NAMES (names_p) + (names_p)->capacity))
+
+/**
+ * Get the property of a shaped property list.
+ */
+#define ECMA_SHAPE_GET_PROPERTY(pairs_p, index) ((pairs_p)[(index) >> 1].header.types + ((index) &0x1))
+
+/**
+ * Get the property value of a shaped property list.
+ */
+#define ECMA_SHAPE_GET_PROPERTY_VALUE(pairs_p, index) ((pairs_p)[(index) >> 1].values + ((index) &0x1))
+
+/**
+ * Checks whether the object can have a shape.
+ */
+#define ECMA_SHAPE_OBJECT_CAN_HAVE_SHAPE(object_p) \
+  (!ecma_is_lexical_environment (object_p) && ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL)
+
+ecma_property_value_t *ecma_shape_create_property (ecma_object_t *object_p,
+                                                   ecma_string_t *name_p,
+                                                   uint8_t type_and_flags,
+                                                   ecma_property_value_t value,
+                                                   ecma_property_t **out_prop_p);
+uint32_t ecma_shape_find_property_index (ecma_shape_t *shape_p, ecma_string_t *name_p);
+ecma_property_t *ecma_shape_find_property (ecma_object_t *object_p,
+                                           ecma_shape_property_list_t *list_p,
+                                           ecma_string_t *name_p);
+ecma_property_value_t *ecma_shape_convert_to_property_list (ecma_object_t *object_p,
+                                                            ecma_property_value_t *prop_value_p);
+void ecma_shape_free_properties (ecma_object_t *object_p);
+
+#endif /* JERRY_OBJECT_SHAPES */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_SHAPE_H */
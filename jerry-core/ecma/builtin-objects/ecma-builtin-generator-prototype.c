@@ -181,9 +181,11 @@ ecma_builtin_generator_prototype_object_do (vm_executable_object_t *generator_ob
         ecma_deref_object (ecma_get_object_from_value (iterator));
         generator_object_p->extended_object.u.cls.u2.executable_obj_flags |= ECMA_EXECUTABLE_OBJECT_DO_AWAIT_OR_YIELD;
         generator_object_p->iterator = iterator;
+        ECMA_GC_REMEMBER_VALUE (iterator);
 
         if (generator_object_p->frame_ctx.stack_top_p[0] != ECMA_VALUE_UNDEFINED)
         {
+          ECMA_GC_REMEMBER_VALUE (generator_object_p->frame_ctx.stack_top_p[0]);
           ecma_deref_object (ecma_get_object_from_value (generator_object_p->frame_ctx.stack_top_p[0]));
         }
 
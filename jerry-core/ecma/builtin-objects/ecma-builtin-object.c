@@ -782,6 +782,7 @@ ecma_builtin_object_object_get_own_property_descriptors (ecma_object_t *obj_p) /
                                                                         ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                                         NULL);
       value_p->value = ecma_make_object_value (desc_obj_p);
+      ECMA_GC_REMEMBER_OBJECT (desc_obj_p);
 
       ecma_deref_object (desc_obj_p);
       ecma_free_property_descriptor (&prop_desc);
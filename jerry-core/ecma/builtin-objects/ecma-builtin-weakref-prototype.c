@@ -15,6 +15,7 @@
 
 #include "ecma-container-object.h"
 #include "ecma-exceptions.h"
+#include "ecma-gc.h"
 
 #if JERRY_BUILTIN_WEAKREF
 
@@ -74,6 +75,16 @@ ecma_builtin_weakref_prototype_object_deref (ecma_value_t this_arg) /**< this ar
     return ecma_raise_type_error (ECMA_ERR_TARGET_IS_NOT_WEAKREF);
   }
 
+#if JERRY_GC_INCREMENTAL
+  ecma_value_t target = this_ext_obj->u.cls.u3.target;
+
+  /* The target is freed by the current garbage collection cycle. */
+  if (ecma_is_value_object (target) && ecma_gc_is_object_unreachable (ecma_get_object_from_value (target)))
+  {
+    return ECMA_VALUE_UNDEFINED;
+  }
+#endif /* JERRY_GC_INCREMENTAL */
+
   return ecma_copy_value (this_ext_obj->u.cls.u3.target);
 } /* ecma_builtin_weakref_prototype_object_deref */
 
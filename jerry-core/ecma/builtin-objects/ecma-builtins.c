@@ -462,6 +462,7 @@ ecma_instantiate_builtin (ecma_global_object_t *global_object_p, /**< global obj
     }
   }
 
+  ECMA_GC_REMEMBER_OBJECT (obj_p);
   ECMA_SET_NON_NULL_POINTER (builtin_objects[obj_builtin_id], obj_p);
   ecma_deref_object (obj_p);
   return obj_p;
@@ -520,6 +521,7 @@ ecma_builtin_create_global_object (void)
 
   ecma_object_t *global_lex_env_p = ecma_create_object_lex_env (NULL, object_p);
 
+  ECMA_GC_REMEMBER_OBJECT (global_lex_env_p);
   ECMA_SET_NON_NULL_POINTER (global_object_p->global_env_cp, global_lex_env_p);
   global_object_p->global_scope_cp = global_object_p->global_env_cp;
 
@@ -529,6 +531,7 @@ ecma_builtin_create_global_object (void)
   prototype_object_p = ecma_instantiate_builtin (global_object_p, prototype_builtin_id);
   JERRY_ASSERT (prototype_object_p != NULL);
 
+  ECMA_GC_REMEMBER_OBJECT (prototype_object_p);
   ECMA_SET_NON_NULL_POINTER (object_p->u2.prototype_cp, prototype_object_p);
 
   return global_object_p;
@@ -1117,6 +1120,7 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
     ecma_property_value_t *prop_value_p =
       ecma_create_named_data_property (object_p, property_name_p, curr_property_p->attributes, &prop_p);
     prop_value_p->value = value;
+    ECMA_GC_REMEMBER_VALUE (value);
 
     /* Reference count of objects must be decreased. */
     ecma_deref_if_object (value);
@@ -309,6 +309,7 @@ ecma_op_arguments_object_try_to_lazy_instantiate_property (ecma_object_t *object
                                                           LIT_INTERNAL_MAGIC_STRING_ARRAY_PROTOTYPE_VALUES);
 
     JERRY_ASSERT (ecma_is_value_object (prop_value_p->value));
+    ECMA_GC_REMEMBER_VALUE (prop_value_p->value);
     ecma_deref_object (ecma_get_object_from_value (prop_value_p->value));
     return prop_p;
   }
@@ -245,7 +245,7 @@ ecma_op_new_array_object_from_collection (ecma_collection_t *collection_p, /**<
   const uint32_t old_size = ECMA_COLLECTION_ALLOCATED_SIZE (collection_p->capacity);
   const uint32_t aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (collection_p->item_count);
 
-  jmem_heap_free_block (collection_p, sizeof (ecma_collection_t));
+  jmem_pools_free (collection_p, sizeof (ecma_collection_t));
   buffer_p = jmem_heap_realloc_block (buffer_p, old_size, aligned_length * sizeof (ecma_value_t));
   object_p = ecma_op_alloc_array_object (item_count);
 
@@ -58,6 +58,7 @@ ecma_async_generator_enqueue (vm_executable_object_t *async_generator_object_p,
 
   ecma_value_t result = ecma_op_create_promise_object (ECMA_VALUE_EMPTY, ECMA_VALUE_UNDEFINED, NULL);
   task_p->promise = result;
+  ECMA_GC_REMEMBER_VALUE (result);
 
   ecma_value_t head = async_generator_object_p->extended_object.u.cls.u3.head;
 
@@ -190,7 +190,7 @@ ecma_atomic_read_modify_write (ecma_value_t typedarray, /**< typedArray argument
   uint32_t offset = target_info.offset;
 
   /* 9. */
-  uint32_t indexed_position = ecma_number_to_uint32 (idx) * element_size + offset;
+  uint32_t indexed_position = ecma_number_to_uint32 (ecma_get_number_from_value (idx)) * element_size + offset;
 
   ecma_free_value (idx);
 
@@ -246,7 +246,7 @@ ecma_atomic_load (ecma_value_t typedarray, /**< typedArray argument */
   uint32_t offset = target_info.offset;
 
   /* 7. */
-  uint32_t indexed_position = ecma_number_to_uint32 (idx) * element_size + offset;
+  uint32_t indexed_position = ecma_number_to_uint32 (ecma_get_number_from_value (idx)) * element_size + offset;
 
   JERRY_UNUSED (indexed_position);
   JERRY_UNUSED (element_type);
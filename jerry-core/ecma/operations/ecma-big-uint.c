@@ -88,7 +88,7 @@ ecma_big_uint_extend (ecma_extended_primitive_t *value_p, /**< BigUInt value */
     return NULL;
   }
 
-  memcpy (result_p + 1, value_p + 1, old_size);
+  memcpy (ECMA_BIGINT_GET_DIGITS (result_p, 0), ECMA_BIGINT_GET_DIGITS (value_p, 0), old_size);
   ecma_deref_bigint (value_p);
 
   *ECMA_BIGINT_GET_DIGITS (result_p, old_size) = digit;
@@ -369,7 +369,7 @@ ecma_big_uint_to_string (ecma_extended_primitive_t *value_p, /**< BigUInt value
     return NULL;
   }
 
-  memcpy (result_p, value_p + 1, size);
+  memcpy (result_p, ECMA_BIGINT_GET_DIGITS (value_p, 0), size);
 
   ecma_bigint_digit_t *start_p = (ecma_bigint_digit_t *) (result_p + size);
   ecma_bigint_digit_t *end_p = (ecma_bigint_digit_t *) result_p;
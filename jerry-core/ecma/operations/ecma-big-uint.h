@@ -37,9 +37,12 @@ typedef uint64_t ecma_bigint_two_digits_t;
 
 /**
  * Return with the digits of a BigInt value.
+ *
+ * Note: the digits must directly follow the bigint_sign_and_size field, even if
+ *       the size of the value field of ecma_extended_primitive_t is 64 bit
  */
-#define ECMA_BIGINT_GET_DIGITS(value_p, offset) \
-  ((ecma_bigint_digit_t *) (((uint8_t *) (value_p)) + sizeof (ecma_extended_primitive_t) + (offset)))
+#define ECMA_BIGINT_GET_DIGITS(value_p, offset)                                                          \
+  ((ecma_bigint_digit_t *) (((uint8_t *) &(value_p)->u.bigint_sign_and_size) + sizeof (uint32_t) + (offset)))
 
 /**
  * Return with the digits of a BigInt value.
@@ -1077,7 +1077,7 @@ ecma_bigint_negate (ecma_extended_primitive_t *value_p) /**< BigInt value */
     return ecma_bigint_raise_memory_error ();
   }
 
-  memcpy (result_p + 1, value_p + 1, size);
+  memcpy (ECMA_BIGINT_GET_DIGITS (result_p, 0), ECMA_BIGINT_GET_DIGITS (value_p, 0), size);
   result_p->refs_and_type = ECMA_EXTENDED_PRIMITIVE_REF_ONE | ECMA_TYPE_BIGINT;
   result_p->u.bigint_sign_and_size = value_p->u.bigint_sign_and_size ^ ECMA_BIGINT_SIGN;
 
@@ -16,11 +16,13 @@
 
 #include "ecma-alloc.h"
 #include "ecma-array-object.h"
+#include "ecma-big-uint.h"
 #include "ecma-builtin-helpers.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
+#include "ecma-helpers-number.h"
 #include "ecma-helpers.h"
 #include "ecma-iterator-object.h"
 #include "ecma-objects.h"
@@ -50,11 +52,247 @@ static inline ecma_collection_t *
 ecma_op_create_internal_buffer (void)
 {
   ecma_collection_t *collection_p = ecma_new_collection ();
-  ecma_collection_push_back (collection_p, (ecma_value_t) 0);
+  ecma_value_t header[] = { (ecma_value_t) 0, (ecma_value_t) 0 };
+  ecma_collection_append (collection_p, header, ECMA_CONTAINER_HEADER_SIZE);
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (ECMA_CONTAINER_INDEX (collection_p), NULL);
 
   return collection_p;
 } /* ecma_op_create_internal_buffer */
 
+/**
+ * Minimum number of live entries before a hash index is created for the internal buffer.
+ */
+#define ECMA_CONTAINER_INDEX_MINIMUM_SIZE 8
+
+/**
+ * Hash index slot which has never been used.
+ */
+#define ECMA_CONTAINER_INDEX_FREE_SLOT 0
+
+/**
+ * Hash index slot whose entry has been deleted.
+ */
+#define ECMA_CONTAINER_INDEX_DELETED_SLOT UINT32_MAX
+
+/**
+ * Compute the total size of the hash index.
+ */
+#define ECMA_CONTAINER_INDEX_GET_TOTAL_SIZE(slot_count) \
+  (sizeof (ecma_container_index_t) + (slot_count) * sizeof (uint32_t))
+
+/**
+ * Get the slots of the hash index.
+ */
+#define ECMA_CONTAINER_INDEX_GET_SLOTS(index_p) ((uint32_t *) ((index_p) + 1))
+
+/**
+ * Get the hash index of the internal buffer.
+ *
+ * @return pointer to the hash index - if the index exists
+ *         NULL - otherwise
+ */
+static inline ecma_container_index_t *
+ecma_op_internal_buffer_get_index (ecma_collection_t *container_p) /**< internal container pointer */
+{
+  return ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_container_index_t, ECMA_CONTAINER_INDEX (container_p));
+} /* ecma_op_internal_buffer_get_index */
+
+/**
+ * Compute the hash of a key.
+ *
+ * Note:
+ *   keys which are equal according to SameValueZero must have the same hash
+ *
+ * @return hash of the key
+ */
+static uint32_t
+ecma_op_internal_buffer_hash_key (ecma_value_t key_arg) /**< key argument */
+{
+  uint32_t hash;
+
+  if (ecma_is_value_string (key_arg))
+  {
+    hash = ecma_string_hash (ecma_get_string_from_value (key_arg));
+  }
+  else if (ecma_is_value_number (key_arg))
+  {
+    ecma_number_t number = ecma_get_number_from_value (key_arg);
+
+    if (ecma_number_is_zero (number))
+    {
+      /* +0 and -0 are the same keys. */
+      hash = 0;
+    }
+    else if (ecma_number_is_nan (number))
+    {
+      /* All NaN values are the same keys. */
+      hash = 1;
+    }
+    else
+    {
+      uint64_t binary = (uint64_t) ecma_number_to_binary (number);
+      hash = (uint32_t) binary ^ (uint32_t) (binary >> 32);
+    }
+  }
+#if JERRY_BUILTIN_BIGINT
+  else if (ecma_is_value_bigint (key_arg) && key_arg != ECMA_BIGINT_ZERO)
+  {
+    ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (key_arg);
+    const lit_utf8_byte_t *digits_p = (const lit_utf8_byte_t *) ECMA_BIGINT_GET_DIGITS (bigint_p, 0);
+
+    hash = lit_utf8_string_calc_hash (digits_p, ECMA_BIGINT_GET_SIZE (bigint_p));
+    hash ^= bigint_p->u.bigint_sign_and_size;
+  }
+#endif /* JERRY_BUILTIN_BIGINT */
+  else
+  {
+    /* Objects, symbols and simple values are compared by identity. */
+    hash = (uint32_t) key_arg;
+  }
+
+  /* Spread the low bits, since compressed pointers and small integers are mostly sequential. */
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+
+  return hash;
+} /* ecma_op_internal_buffer_hash_key */
+
+/**
+ * Insert the position of an entry into the hash index.
+ *
+ * Note:
+ *   the index must have at least one free slot
+ */
+static void
+ecma_op_internal_buffer_index_insert (ecma_container_index_t *index_p, /**< hash index */
+                                      ecma_value_t key_arg, /**< key of the entry */
+                                      uint32_t position) /**< position of the entry + 1 */
+{
+  uint32_t *slots_p = ECMA_CONTAINER_INDEX_GET_SLOTS (index_p);
+  uint32_t mask = index_p->mask;
+  uint32_t slot = ecma_op_internal_buffer_hash_key (key_arg) & mask;
+
+  while (slots_p[slot] != ECMA_CONTAINER_INDEX_FREE_SLOT && slots_p[slot] != ECMA_CONTAINER_INDEX_DELETED_SLOT)
+  {
+    slot = (slot + 1) & mask;
+  }
+
+  if (slots_p[slot] == ECMA_CONTAINER_INDEX_FREE_SLOT)
+  {
+    JERRY_ASSERT (index_p->free_count > 1);
+    index_p->free_count--;
+  }
+
+  slots_p[slot] = position;
+} /* ecma_op_internal_buffer_index_insert */
+
+/**
+ * Free the hash index of the internal buffer.
+ */
+static void
+ecma_op_internal_buffer_free_index (ecma_collection_t *container_p) /**< internal container pointer */
+{
+  ecma_container_index_t *index_p = ecma_op_internal_buffer_get_index (container_p);
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (ECMA_CONTAINER_INDEX (container_p), NULL);
+  jmem_heap_free_block (index_p, ECMA_CONTAINER_INDEX_GET_TOTAL_SIZE (index_p->mask + 1));
+} /* ecma_op_internal_buffer_free_index */
+
+/**
+ * Create (or recreate) the hash index of the internal buffer from its live entries.
+ *
+ * Note:
+ *   the index is an optional acceleration structure, the buffer is
+ *   searched linearly when there is not enough memory to create it
+ */
+static void
+ecma_op_internal_buffer_create_index (ecma_collection_t *container_p, /**< internal container pointer */
+                                      lit_magic_string_id_t lit_id) /**< class id */
+{
+  /* The old index is released first, since the allocation below may trigger a garbage collection. */
+  ecma_op_internal_buffer_free_index (container_p);
+
+  uint32_t size = ECMA_CONTAINER_GET_SIZE (container_p);
+
+  if (size < ECMA_CONTAINER_INDEX_MINIMUM_SIZE)
+  {
+    return;
+  }
+
+  /* The max load factor of the index is 3/4, so at least half of the slots are free after creation. */
+  uint32_t slot_count = 2 * ECMA_CONTAINER_INDEX_MINIMUM_SIZE;
+
+  while (slot_count < 2 * size)
+  {
+    slot_count <<= 1;
+  }
+
+  size_t total_size = ECMA_CONTAINER_INDEX_GET_TOTAL_SIZE (slot_count);
+  ecma_container_index_t *index_p = (ecma_container_index_t *) jmem_heap_alloc_block_null_on_error (total_size);
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  index_p->mask = slot_count - 1;
+  index_p->free_count = slot_count;
+  memset (ECMA_CONTAINER_INDEX_GET_SLOTS (index_p), 0, slot_count * sizeof (uint32_t));
+
+  uint8_t entry_size = ecma_op_container_entry_size (lit_id);
+  uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+
+  for (uint32_t i = 0; i < entry_count; i += entry_size)
+  {
+    if (!ecma_is_value_empty (start_p[i]))
+    {
+      ecma_op_internal_buffer_index_insert (index_p, start_p[i], i + 1);
+    }
+  }
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (ECMA_CONTAINER_INDEX (container_p), index_p);
+} /* ecma_op_internal_buffer_create_index */
+
+/**
+ * Register the last entry of the internal buffer in the hash index.
+ */
+static void
+ecma_op_internal_buffer_index_last_entry (ecma_collection_t *container_p, /**< internal container pointer */
+                                          lit_magic_string_id_t lit_id) /**< class id */
+{
+  ecma_container_index_t *index_p = ecma_op_internal_buffer_get_index (container_p);
+
+  if (index_p == NULL)
+  {
+    uint32_t size = ECMA_CONTAINER_GET_SIZE (container_p);
+
+    /* Creation is retried only when the size is doubled, which keeps appends
+     * amortized constant time even if the index cannot be allocated. */
+    if (size >= ECMA_CONTAINER_INDEX_MINIMUM_SIZE && (size & (size - 1)) == 0)
+    {
+      ecma_op_internal_buffer_create_index (container_p, lit_id);
+    }
+    return;
+  }
+
+  if ((index_p->free_count - 1) * 4 <= index_p->mask + 1)
+  {
+    ecma_op_internal_buffer_create_index (container_p, lit_id);
+    return;
+  }
+
+  uint32_t position = ECMA_CONTAINER_ENTRY_COUNT (container_p) - ecma_op_container_entry_size (lit_id);
+  ecma_op_internal_buffer_index_insert (index_p, ECMA_CONTAINER_START (container_p)[position], position + 1);
+} /* ecma_op_internal_buffer_index_last_entry */
+
 /**
  * Append values to the internal buffer.
  */
@@ -77,6 +315,7 @@ ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal co
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, ECMA_CONTAINER_GET_SIZE (container_p) + 1);
+  ecma_op_internal_buffer_index_last_entry (container_p, lit_id);
 } /* ecma_op_internal_buffer_append */
 
 /**
@@ -108,6 +347,23 @@ ecma_op_internal_buffer_delete (ecma_collection_t *container_p, /**< internal co
   JERRY_ASSERT (container_p != NULL);
   JERRY_ASSERT (entry_p != NULL);
 
+  ecma_container_index_t *index_p = ecma_op_internal_buffer_get_index (container_p);
+
+  if (index_p != NULL)
+  {
+    uint32_t *slots_p = ECMA_CONTAINER_INDEX_GET_SLOTS (index_p);
+    uint32_t position = (uint32_t) ((ecma_value_t *) entry_p - ECMA_CONTAINER_START (container_p)) + 1;
+    uint32_t slot = ecma_op_internal_buffer_hash_key (entry_p->key) & index_p->mask;
+
+    while (slots_p[slot] != position)
+    {
+      JERRY_ASSERT (slots_p[slot] != ECMA_CONTAINER_INDEX_FREE_SLOT);
+      slot = (slot + 1) & index_p->mask;
+    }
+
+    slots_p[slot] = ECMA_CONTAINER_INDEX_DELETED_SLOT;
+  }
+
   ecma_free_value_if_not_object (entry_p->key);
   entry_p->key = ECMA_VALUE_EMPTY;
 
@@ -132,9 +388,34 @@ ecma_op_internal_buffer_find (ecma_collection_t *container_p, /**< internal cont
 {
   JERRY_ASSERT (container_p != NULL);
 
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+  ecma_container_index_t *index_p = ecma_op_internal_buffer_get_index (container_p);
+
+  if (index_p != NULL)
+  {
+    uint32_t *slots_p = ECMA_CONTAINER_INDEX_GET_SLOTS (index_p);
+    uint32_t slot = ecma_op_internal_buffer_hash_key (key_arg) & index_p->mask;
+
+    while (slots_p[slot] != ECMA_CONTAINER_INDEX_FREE_SLOT)
+    {
+      if (slots_p[slot] != ECMA_CONTAINER_INDEX_DELETED_SLOT)
+      {
+        ecma_value_t *entry_p = start_p + slots_p[slot] - 1;
+
+        if (ecma_op_same_value_zero (*entry_p, key_arg, false))
+        {
+          return entry_p;
+        }
+      }
+
+      slot = (slot + 1) & index_p->mask;
+    }
+
+    return NULL;
+  }
+
   uint8_t entry_size = ecma_op_container_entry_size (lit_id);
   uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
-  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
 
   for (uint32_t i = 0; i < entry_count; i += entry_size)
   {
@@ -340,8 +621,26 @@ ecma_op_container_free_entries (ecma_object_t *object_p) /**< collection object
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, 0);
+  ecma_op_internal_buffer_free_index (container_p);
 } /* ecma_op_container_free_entries */
 
+/**
+ * Release the hash index of the internal buffer to reduce memory consumption.
+ *
+ * Note:
+ *   the index is recreated when the container grows
+ */
+void
+ecma_op_container_free_index (ecma_object_t *object_p) /**< collection object pointer */
+{
+  JERRY_ASSERT (ecma_object_class_is (object_p, ECMA_OBJECT_CLASS_CONTAINER));
+
+  ecma_extended_object_t *map_object_p = (ecma_extended_object_t *) object_p;
+  ecma_collection_t *container_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_collection_t, map_object_p->u.cls.u3.value);
+
+  ecma_op_internal_buffer_free_index (container_p);
+} /* ecma_op_container_free_index */
+
 /**
  * Handle calling [[Construct]] of built-in Map/Set like objects
  *
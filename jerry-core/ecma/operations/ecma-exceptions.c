@@ -161,6 +161,7 @@ ecma_new_standard_error (jerry_error_t error_type, /**< native error type */
     ecma_value_t backtrace_value = vm_get_backtrace (0);
 
     prop_value_p->value = backtrace_value;
+    ECMA_GC_REMEMBER_VALUE (backtrace_value);
     ecma_deref_object (ecma_get_object_from_value (backtrace_value));
 #endif /* JERRY_LINE_INFO */
   }
@@ -265,6 +266,7 @@ ecma_new_aggregate_error (ecma_value_t error_list_val, /**< errors list */
                                                     ECMA_PROPERTY_CONFIGURABLE_WRITABLE,
                                                     NULL);
     prop_value_p->value = error_list_arr;
+    ECMA_GC_REMEMBER_VALUE (error_list_arr);
     ecma_free_value (error_list_arr);
   }
 
@@ -484,7 +486,7 @@ ecma_raise_uri_error (ecma_error_msg_t msg) /**< error message */
   return ecma_raise_standard_error (JERRY_ERROR_URI, msg);
 } /* ecma_raise_uri_error */
 
-#if (JERRY_STACK_LIMIT != 0)
+#if (JERRY_STACK_LIMIT != 0) || JERRY_VM_STACKLESS
 /**
  * Raise a RangeError with "Maximum call stack size exceeded" message.
  *
@@ -496,7 +498,7 @@ ecma_raise_maximum_callstack_error (void)
 {
   return ecma_raise_range_error (ECMA_ERR_MAXIMUM_CALL_STACK_SIZE_EXCEEDED);
 } /* ecma_raise_maximum_callstack_error */
-#endif /* (JERRY_STACK_LIMIT != 0) */
+#endif /* (JERRY_STACK_LIMIT != 0) || JERRY_VM_STACKLESS */
 
 /**
  * Raise a AggregateError with the given errors and message.
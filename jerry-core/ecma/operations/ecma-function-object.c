@@ -31,6 +31,7 @@
 #include "ecma-symbol-object.h"
 
 #include "jcontext.h"
+#include "js-parser.h"
 #include "lit-char-helpers.h"
 #include "opcodes.h"
 
@@ -1068,27 +1069,25 @@ exit:
 } /* ecma_op_function_call_constructor */
 
 /**
- * Perform a JavaScript function object method call.
+ * Prepare the call of a JavaScript function: initialize the shared data of the call,
+ * create the local lexical environment and resolve the 'this' binding.
  *
- * The input function object should be a pure JavaScript method
+ * Note:
+ *      the argument list of the shared data must be set by the caller, and the
+ *      ecma_op_function_finish_simple_call must be called after the function is executed
  *
- * @return the result of the function call.
+ * @return 'this' binding of the call
  */
-static ecma_value_t
-ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
-                              ecma_value_t this_binding, /**< 'this' argument's value */
-                              const ecma_value_t *arguments_list_p, /**< arguments list */
-                              uint32_t arguments_list_len) /**< length of arguments list */
+ecma_value_t
+ecma_op_function_prepare_simple_call (ecma_object_t *func_obj_p, /**< Function object */
+                                      ecma_value_t this_binding, /**< 'this' argument's value */
+                                      vm_frame_ctx_shared_args_t *shared_args_p, /**< [out] shared data */
+                                      ecma_object_t **scope_p_p) /**< [out] lexical environment */
 {
   JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION);
 
-  ECMA_CHECK_STACK_USAGE ();
-
-  vm_frame_ctx_shared_args_t shared_args;
-  shared_args.header.status_flags = VM_FRAME_CTX_SHARED_HAS_ARG_LIST;
-  shared_args.header.function_object_p = func_obj_p;
-  shared_args.arg_list_p = arguments_list_p;
-  shared_args.arg_list_len = arguments_list_len;
+  shared_args_p->header.status_flags = VM_FRAME_CTX_SHARED_HAS_ARG_LIST;
+  shared_args_p->header.function_object_p = func_obj_p;
 
   /* Entering Function Code (ECMA-262 v5, 10.4.3) */
   ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) func_obj_p;
@@ -1099,25 +1098,24 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
   const ecma_compiled_code_t *bytecode_data_p = ecma_op_function_get_compiled_code (ext_func_p);
   uint16_t status_flags = bytecode_data_p->status_flags;
 
-  shared_args.header.bytecode_header_p = bytecode_data_p;
-
-#if JERRY_BUILTIN_REALMS
-  ecma_global_object_t *realm_p = ecma_op_function_get_realm (bytecode_data_p);
-#endif /* JERRY_BUILTIN_REALMS */
+  shared_args_p->header.bytecode_header_p = bytecode_data_p;
 
   /* 5. */
   if (!(status_flags & CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED))
   {
-    shared_args.header.status_flags |= VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV;
+    shared_args_p->header.status_flags |= VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV;
     scope_p = ecma_create_decl_lex_env (scope_p);
   }
 
+  *scope_p_p = scope_p;
+
   /* 1. */
   switch (CBC_FUNCTION_GET_TYPE (status_flags))
   {
     case CBC_FUNCTION_CONSTRUCTOR:
     {
-      return ecma_op_function_call_constructor (&shared_args, scope_p, this_binding);
+      /* Resolved by ecma_op_function_call_constructor. */
+      break;
     }
     case CBC_FUNCTION_ARROW:
     {
@@ -1144,7 +1142,7 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
     }
     default:
     {
-      shared_args.header.status_flags |= VM_FRAME_CTX_SHARED_NON_ARROW_FUNC;
+      shared_args_p->header.status_flags |= VM_FRAME_CTX_SHARED_NON_ARROW_FUNC;
 
       if (status_flags & CBC_CODE_FLAGS_STRICT_MODE)
       {
@@ -1155,7 +1153,7 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
       {
         /* 2. */
 #if JERRY_BUILTIN_REALMS
-        this_binding = realm_p->this_binding;
+        this_binding = ecma_op_function_get_realm (bytecode_data_p)->this_binding;
 #else /* !JERRY_BUILTIN_REALMS */
         this_binding = ecma_make_object_value (ecma_builtin_get_global ());
 #endif /* JERRY_BUILTIN_REALMS */
@@ -1164,7 +1162,7 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
       {
         /* 3., 4. */
         this_binding = ecma_op_to_object (this_binding);
-        shared_args.header.status_flags |= VM_FRAME_CTX_SHARED_FREE_THIS;
+        shared_args_p->header.status_flags |= VM_FRAME_CTX_SHARED_FREE_THIS;
 
         JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (this_binding));
       }
@@ -1172,9 +1170,97 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
     }
   }
 
+  return this_binding;
+} /* ecma_op_function_prepare_simple_call */
+
+/**
+ * Release the resources allocated by ecma_op_function_prepare_simple_call.
+ */
+void
+ecma_op_function_finish_simple_call (vm_frame_ctx_shared_t *shared_p, /**< shared data */
+                                     ecma_object_t *scope_p, /**< lexical environment */
+                                     ecma_value_t this_binding) /**< 'this' binding of the call */
+{
+  if (JERRY_UNLIKELY (shared_p->status_flags & VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV))
+  {
+    ecma_deref_object (scope_p);
+  }
+
+  if (JERRY_UNLIKELY (shared_p->status_flags & VM_FRAME_CTX_SHARED_FREE_THIS))
+  {
+    ecma_free_value (this_binding);
+  }
+} /* ecma_op_function_finish_simple_call */
+
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Replace the lazy function of a function object with its compiled code.
+ *
+ * @return ECMA_VALUE_EMPTY - if the function body is compiled successfully
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+static ecma_value_t
+ecma_op_function_compile_lazy (ecma_extended_object_t *ext_func_p) /**< function object */
+{
+  ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) ecma_op_function_get_compiled_code (ext_func_p);
+  ecma_compiled_code_t *compiled_code_p = parser_compile_lazy_function (bytecode_p);
+
+  if (JERRY_UNLIKELY (compiled_code_p == NULL))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+
+  ecma_bytecode_ref (compiled_code_p);
+  ECMA_SET_INTERNAL_VALUE_POINTER (ext_func_p->u.function.bytecode_cp, compiled_code_p);
+  ecma_bytecode_deref (bytecode_p);
+  return ECMA_VALUE_EMPTY;
+} /* ecma_op_function_compile_lazy */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+/**
+ * Perform a JavaScript function object method call.
+ *
+ * The input function object should be a pure JavaScript method
+ *
+ * @return the result of the function call.
+ */
+static ecma_value_t
+ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
+                              ecma_value_t this_binding, /**< 'this' argument's value */
+                              const ecma_value_t *arguments_list_p, /**< arguments list */
+                              uint32_t arguments_list_len) /**< length of arguments list */
+{
+  ECMA_CHECK_STACK_USAGE ();
+
+#if JERRY_LAZY_FUNCTIONS
+  ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) func_obj_p;
+
+  if (JERRY_UNLIKELY (ecma_op_function_get_compiled_code (ext_func_p)->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+      && ECMA_IS_VALUE_ERROR (ecma_op_function_compile_lazy (ext_func_p)))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+  vm_frame_ctx_shared_args_t shared_args;
+  ecma_object_t *scope_p;
+
+  this_binding = ecma_op_function_prepare_simple_call (func_obj_p, this_binding, &shared_args, &scope_p);
+  shared_args.arg_list_p = arguments_list_p;
+  shared_args.arg_list_len = arguments_list_len;
+
+  const ecma_compiled_code_t *bytecode_data_p = shared_args.header.bytecode_header_p;
+
+  if (CBC_FUNCTION_GET_TYPE (bytecode_data_p->status_flags) == CBC_FUNCTION_CONSTRUCTOR)
+  {
+    return ecma_op_function_call_constructor (&shared_args, scope_p, this_binding);
+  }
+
 #if JERRY_BUILTIN_REALMS
   ecma_global_object_t *saved_global_object_p = JERRY_CONTEXT (global_object_p);
-  JERRY_CONTEXT (global_object_p) = realm_p;
+  JERRY_CONTEXT (global_object_p) = ecma_op_function_get_realm (bytecode_data_p);
 #endif /* JERRY_BUILTIN_REALMS */
 
   ecma_value_t ret_value = vm_run (&shared_args.header, this_binding, scope_p);
@@ -1183,16 +1269,7 @@ ecma_op_function_call_simple (ecma_object_t *func_obj_p, /**< Function object */
   JERRY_CONTEXT (global_object_p) = saved_global_object_p;
 #endif /* JERRY_BUILTIN_REALMS */
 
-  if (JERRY_UNLIKELY (shared_args.header.status_flags & VM_FRAME_CTX_SHARED_FREE_LOCAL_ENV))
-  {
-    ecma_deref_object (scope_p);
-  }
-
-  if (JERRY_UNLIKELY (shared_args.header.status_flags & VM_FRAME_CTX_SHARED_FREE_THIS))
-  {
-    ecma_free_value (this_binding);
-  }
-
+  ecma_op_function_finish_simple_call (&shared_args.header, scope_p, this_binding);
   return ret_value;
 } /* ecma_op_function_call_simple */
 
@@ -1846,6 +1923,7 @@ ecma_op_lazy_instantiate_prototype_object (ecma_object_t *object_p) /**< the fun
                                                                 NULL);
 
     constructor_prop_value_p->value = ecma_make_object_value (object_p);
+    ECMA_GC_REMEMBER_OBJECT (object_p);
   }
 
   /* 18. */
@@ -1857,6 +1935,7 @@ ecma_op_lazy_instantiate_prototype_object (ecma_object_t *object_p) /**< the fun
                                                             &prototype_prop_p);
 
   prototype_prop_value_p->value = ecma_make_object_value (proto_object_p);
+  ECMA_GC_REMEMBER_OBJECT (proto_object_p);
 
   ecma_deref_object (proto_object_p);
 
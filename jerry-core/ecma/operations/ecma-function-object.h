@@ -61,6 +61,14 @@ ecma_global_object_t *ecma_op_function_get_realm (const ecma_compiled_code_t *by
 ecma_global_object_t *ecma_op_function_get_function_realm (ecma_object_t *func_obj_p);
 #endif /* JERRY_BUILTIN_REALMS */
 
+ecma_value_t ecma_op_function_prepare_simple_call (ecma_object_t *func_obj_p,
+                                                   ecma_value_t this_binding,
+                                                   vm_frame_ctx_shared_args_t *shared_args_p,
+                                                   ecma_object_t **scope_p_p);
+void ecma_op_function_finish_simple_call (vm_frame_ctx_shared_t *shared_p,
+                                          ecma_object_t *scope_p,
+                                          ecma_value_t this_binding);
+
 ecma_value_t ecma_op_create_dynamic_function (const ecma_value_t *arguments_list_p,
                                               uint32_t arguments_list_len,
                                               ecma_parse_opts_t opts);
@@ -123,7 +123,7 @@ ecma_free_promise_reaction_job (ecma_job_promise_reaction_t *job_p) /**< points
   ecma_free_value (job_p->handler);
   ecma_free_value (job_p->argument);
 
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_reaction_t));
+  jmem_pools_free (job_p, sizeof (ecma_job_promise_reaction_t));
 } /* ecma_free_promise_reaction_job */
 
 /**
@@ -138,7 +138,7 @@ ecma_free_promise_async_reaction_job (ecma_job_promise_async_reaction_t *job_p)
   ecma_free_value (job_p->executable_object);
   ecma_free_value (job_p->argument);
 
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_async_reaction_t));
+  jmem_pools_free (job_p, sizeof (ecma_job_promise_async_reaction_t));
 } /* ecma_free_promise_async_reaction_job */
 
 /**
@@ -152,7 +152,7 @@ ecma_free_promise_async_generator_job (ecma_job_promise_async_generator_t *job_p
 
   ecma_free_value (job_p->executable_object);
 
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_async_generator_t));
+  jmem_pools_free (job_p, sizeof (ecma_job_promise_async_generator_t));
 } /* ecma_free_promise_async_generator_job */
 
 /**
@@ -168,7 +168,7 @@ ecma_free_promise_resolve_thenable_job (ecma_job_promise_resolve_thenable_t *job
   ecma_free_value (job_p->thenable);
   ecma_free_value (job_p->then);
 
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_resolve_thenable_t));
+  jmem_pools_free (job_p, sizeof (ecma_job_promise_resolve_thenable_t));
 } /* ecma_free_promise_resolve_thenable_job */
 
 /**
@@ -407,7 +407,7 @@ ecma_process_promise_async_generator_job (ecma_job_promise_async_generator_t *jo
   ecma_value_t result = ecma_async_generator_run ((vm_executable_object_t *) object_p);
 
   ecma_free_value (job_p->executable_object);
-  jmem_heap_free_block (job_p, sizeof (ecma_job_promise_async_generator_t));
+  jmem_pools_free (job_p, sizeof (ecma_job_promise_async_generator_t));
   return result;
 } /* ecma_process_promise_async_generator_job */
 
@@ -472,7 +472,7 @@ ecma_enqueue_promise_reaction_job (ecma_value_t capability, /**< capability obje
                                    ecma_value_t argument) /**< argument for the reaction */
 {
   ecma_job_promise_reaction_t *job_p;
-  job_p = (ecma_job_promise_reaction_t *) jmem_heap_alloc_block (sizeof (ecma_job_promise_reaction_t));
+  job_p = (ecma_job_promise_reaction_t *) jmem_pools_alloc (sizeof (ecma_job_promise_reaction_t));
   job_p->header.next_and_type = ECMA_JOB_PROMISE_REACTION;
   job_p->capability = ecma_copy_value (capability);
   job_p->handler = ecma_copy_value (handler);
@@ -490,7 +490,7 @@ ecma_enqueue_promise_async_reaction_job (ecma_value_t executable_object, /**< ex
                                          bool is_rejected) /**< is_fulfilled */
 {
   ecma_job_promise_async_reaction_t *job_p;
-  job_p = (ecma_job_promise_async_reaction_t *) jmem_heap_alloc_block (sizeof (ecma_job_promise_async_reaction_t));
+  job_p = (ecma_job_promise_async_reaction_t *) jmem_pools_alloc (sizeof (ecma_job_promise_async_reaction_t));
   job_p->header.next_and_type =
     (is_rejected ? ECMA_JOB_PROMISE_ASYNC_REACTION_REJECTED : ECMA_JOB_PROMISE_ASYNC_REACTION_FULFILLED);
   job_p->executable_object = ecma_copy_value (executable_object);
@@ -506,7 +506,7 @@ void
 ecma_enqueue_promise_async_generator_job (ecma_value_t executable_object) /**< executable object */
 {
   ecma_job_promise_async_generator_t *job_p;
-  job_p = (ecma_job_promise_async_generator_t *) jmem_heap_alloc_block (sizeof (ecma_job_promise_async_generator_t));
+  job_p = (ecma_job_promise_async_generator_t *) jmem_pools_alloc (sizeof (ecma_job_promise_async_generator_t));
   job_p->header.next_and_type = ECMA_JOB_PROMISE_ASYNC_GENERATOR;
   job_p->executable_object = ecma_copy_value (executable_object);
 
@@ -526,7 +526,7 @@ ecma_enqueue_promise_resolve_thenable_job (ecma_value_t promise, /**< promise to
   JERRY_ASSERT (ecma_op_is_callable (then));
 
   ecma_job_promise_resolve_thenable_t *job_p;
-  job_p = (ecma_job_promise_resolve_thenable_t *) jmem_heap_alloc_block (sizeof (ecma_job_promise_resolve_thenable_t));
+  job_p = (ecma_job_promise_resolve_thenable_t *) jmem_pools_alloc (sizeof (ecma_job_promise_resolve_thenable_t));
   job_p->header.next_and_type = ECMA_JOB_PROMISE_THENABLE;
   job_p->promise = ecma_copy_value (promise);
   job_p->thenable = ecma_copy_value (thenable);
@@ -83,6 +83,7 @@ ecma_create_global_lexical_block (ecma_object_t *global_object_p) /**< global ob
   {
     ecma_object_t *global_scope_p = ecma_create_decl_lex_env (ecma_get_global_environment (global_object_p));
     global_scope_p->type_flags_refs |= ECMA_OBJECT_FLAG_BLOCK;
+    ECMA_GC_REMEMBER_OBJECT (global_scope_p);
     ECMA_SET_NON_NULL_POINTER (real_global_object_p->global_scope_cp, global_scope_p);
     ecma_deref_object (global_scope_p);
   }
@@ -531,6 +532,9 @@ ecma_op_create_environment_record (ecma_object_t *lex_env_p, /**< lexical enviro
   environment_record_p->this_binding = this_binding;
   environment_record_p->function_object = ecma_make_object_value (func_obj_p);
 
+  ECMA_GC_REMEMBER_VALUE (this_binding);
+  ECMA_GC_REMEMBER_OBJECT (func_obj_p);
+
   ecma_string_t *property_name_p = ecma_get_internal_string (LIT_INTERNAL_MAGIC_STRING_ENVIRONMENT_RECORD);
 
   ecma_property_t *property_p;
@@ -607,6 +611,7 @@ ecma_op_bind_this_value (ecma_environment_record_t *environment_record_p, /**< e
   JERRY_ASSERT (!ecma_op_this_binding_is_initialized (environment_record_p));
 
   environment_record_p->this_binding = this_binding;
+  ECMA_GC_REMEMBER_VALUE (this_binding);
 } /* ecma_op_bind_this_value */
 
 /**
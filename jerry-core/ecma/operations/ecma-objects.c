@@ -29,6 +29,7 @@
 #include "ecma-lex-env.h"
 #include "ecma-objects-general.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "ecma-string-object.h"
 
 #include "jcontext.h"
@@ -2258,6 +2259,105 @@ ecma_op_object_heap_sort_shift_down (ecma_value_t *buffer_p, /**< array of items
   }
 } /* ecma_op_object_heap_sort_shift_down */
 
+/**
+ * Iterator of the property list of an object.
+ */
+typedef struct
+{
+  ecma_property_header_t *prop_iter_p; /**< current property pair or shaped property list */
+  uint32_t index; /**< index of the next property of the current property pair,
+                   *   or the number of remaining properties of a shaped property list */
+} ecma_op_object_property_iterator_t;
+
+/**
+ * Initialize a property list iterator.
+ */
+static void
+ecma_op_object_property_iterator_init (ecma_object_t *obj_p, /**< object */
+                                       ecma_op_object_property_iterator_t *iterator_p) /**< [out] iterator */
+{
+  iterator_p->prop_iter_p = NULL;
+  iterator_p->index = 0;
+
+  jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
+
+  if (prop_iter_cp == JMEM_CP_NULL)
+  {
+    return;
+  }
+
+  ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+#if JERRY_OBJECT_SHAPES
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+  {
+    iterator_p->prop_iter_p = prop_iter_p;
+    iterator_p->index = ECMA_SHAPE_FROM_LIST ((ecma_shape_property_list_t *) prop_iter_p)->property_count;
+    return;
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
+#if JERRY_PROPERTY_HASHMAP
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+#endif /* JERRY_PROPERTY_HASHMAP */
+
+  iterator_p->prop_iter_p = prop_iter_p;
+} /* ecma_op_object_property_iterator_init */
+
+/**
+ * Get the next property of a property list iterator. The properties
+ * are returned in reverse creation order.
+ *
+ * @return pointer to the property - if the iteration is not finished
+ *         NULL - otherwise
+ */
+static ecma_property_t *
+ecma_op_object_property_iterator_next (ecma_op_object_property_iterator_t *iterator_p, /**< iterator */
+                                       jmem_cpointer_t *name_cp_p) /**< [out] name of the property */
+{
+  while (iterator_p->prop_iter_p != NULL)
+  {
+    ecma_property_header_t *prop_iter_p = iterator_p->prop_iter_p;
+
+#if JERRY_OBJECT_SHAPES
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      if (iterator_p->index == 0)
+      {
+        iterator_p->prop_iter_p = NULL;
+        return NULL;
+      }
+
+      ecma_shape_property_list_t *list_p = (ecma_shape_property_list_t *) prop_iter_p;
+      ecma_shape_names_t *names_p =
+        ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, ECMA_SHAPE_FROM_LIST (list_p)->names_cp);
+      uint32_t index = --iterator_p->index;
+
+      *name_cp_p = ECMA_SHAPE_GET_NAMES (names_p)[index];
+      return ECMA_SHAPE_GET_PROPERTY (ECMA_SHAPE_GET_PAIRS (list_p), index);
+    }
+#endif /* JERRY_OBJECT_SHAPES */
+
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    if (iterator_p->index < ECMA_PROPERTY_PAIR_ITEM_COUNT)
+    {
+      uint32_t index = iterator_p->index++;
+
+      *name_cp_p = ((ecma_property_pair_t *) prop_iter_p)->names_cp[index];
+      return prop_iter_p->types + index;
+    }
+
+    iterator_p->prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+    iterator_p->index = 0;
+  }
+
+  return NULL;
+} /* ecma_op_object_property_iterator_next */
+
 /**
  * Object's [[OwnPropertyKeys]] internal method
  *
@@ -2294,71 +2394,49 @@ ecma_op_object_own_property_keys (ecma_object_t *obj_p, /**< object */
 
   ecma_object_list_lazy_property_names (obj_p, prop_names_p, &prop_counter, filter);
 
-  jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
-
-#if JERRY_PROPERTY_HASHMAP
-  if (prop_iter_cp != JMEM_CP_NULL)
-  {
-    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
-
-    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
-    {
-      prop_iter_cp = prop_iter_p->next_property_cp;
-    }
-  }
-#endif /* JERRY_PROPERTY_HASHMAP */
+  ecma_op_object_property_iterator_t start_iterator;
+  ecma_op_object_property_iterator_init (obj_p, &start_iterator);
 
-  jmem_cpointer_t counter_prop_iter_cp = prop_iter_cp;
+  ecma_op_object_property_iterator_t iterator = start_iterator;
+  ecma_property_t *property_p;
+  jmem_cpointer_t name_cp;
 
   uint32_t array_index_named_props = 0;
   uint32_t string_named_props = 0;
   uint32_t symbol_named_props = 0;
 
-  while (counter_prop_iter_cp != JMEM_CP_NULL)
+  while ((property_p = ecma_op_object_property_iterator_next (&iterator, &name_cp)) != NULL)
   {
-    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, counter_prop_iter_cp);
-    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
-
-    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    if (!ECMA_PROPERTY_IS_RAW (*property_p) || (*property_p & ECMA_PROPERTY_FLAG_BUILT_IN))
     {
-      ecma_property_t *property_p = prop_iter_p->types + i;
-
-      if (!ECMA_PROPERTY_IS_RAW (*property_p) || (*property_p & ECMA_PROPERTY_FLAG_BUILT_IN))
-      {
-        continue;
-      }
-
-      ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+      continue;
+    }
 
-      if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
-          && prop_pair_p->names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
-          && prop_pair_p->names_cp[i] < LIT_MAGIC_STRING__COUNT)
-      {
-        continue;
-      }
+    if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
+        && name_cp >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT && name_cp < LIT_MAGIC_STRING__COUNT)
+    {
+      continue;
+    }
 
-      ecma_string_t *name_p = ecma_string_from_property_name (*property_p, prop_pair_p->names_cp[i]);
+    ecma_string_t *name_p = ecma_string_from_property_name (*property_p, name_cp);
 
-      if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
-      {
-        array_index_named_props++;
-      }
-      else if (ecma_prop_name_is_symbol (name_p))
-      {
-        if (!(name_p->u.hash & ECMA_SYMBOL_FLAG_PRIVATE_KEY))
-        {
-          symbol_named_props++;
-        }
-      }
-      else
+    if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
+    {
+      array_index_named_props++;
+    }
+    else if (ecma_prop_name_is_symbol (name_p))
+    {
+      if (!(name_p->u.hash & ECMA_SYMBOL_FLAG_PRIVATE_KEY))
       {
-        string_named_props++;
+        symbol_named_props++;
       }
-
-      ecma_deref_ecma_string (name_p);
+    }
+    else
+    {
+      string_named_props++;
     }
 
-    counter_prop_iter_cp = prop_iter_p->next_property_cp;
+    ecma_deref_ecma_string (name_p);
   }
 
   if (filter & JERRY_PROPERTY_FILTER_EXCLUDE_INTEGER_INDICES)
@@ -2409,60 +2487,49 @@ ecma_op_object_own_property_keys (ecma_object_t *obj_p, /**< object */
              prop_counter.string_named_props * sizeof (ecma_value_t));
   }
 
-  while (prop_iter_cp != JMEM_CP_NULL)
-  {
-    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
-    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+  iterator = start_iterator;
 
-    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+  while ((property_p = ecma_op_object_property_iterator_next (&iterator, &name_cp)) != NULL)
+  {
+    if (!ECMA_PROPERTY_IS_RAW (*property_p) || (*property_p & ECMA_PROPERTY_FLAG_BUILT_IN))
     {
-      ecma_property_t *property_p = prop_iter_p->types + i;
+      continue;
+    }
 
-      if (!ECMA_PROPERTY_IS_RAW (*property_p) || (*property_p & ECMA_PROPERTY_FLAG_BUILT_IN))
-      {
-        continue;
-      }
+    if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
+        && name_cp >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT && name_cp < LIT_MAGIC_STRING__COUNT)
+    {
+      continue;
+    }
 
-      ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+    ecma_string_t *name_p = ecma_string_from_property_name (*property_p, name_cp);
 
-      if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
-          && prop_pair_p->names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
-          && prop_pair_p->names_cp[i] < LIT_MAGIC_STRING__COUNT)
+    if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
+    {
+      if (!(filter & JERRY_PROPERTY_FILTER_EXCLUDE_INTEGER_INDICES))
       {
+        *(--array_index_current_p) = ecma_make_string_value (name_p);
         continue;
       }
-
-      ecma_string_t *name_p = ecma_string_from_property_name (*property_p, prop_pair_p->names_cp[i]);
-
-      if (ecma_string_get_array_index (name_p) != ECMA_STRING_NOT_ARRAY_INDEX)
-      {
-        if (!(filter & JERRY_PROPERTY_FILTER_EXCLUDE_INTEGER_INDICES))
-        {
-          *(--array_index_current_p) = ecma_make_string_value (name_p);
-          continue;
-        }
-      }
-      else if (ecma_prop_name_is_symbol (name_p))
+    }
+    else if (ecma_prop_name_is_symbol (name_p))
+    {
+      if (!(filter & JERRY_PROPERTY_FILTER_EXCLUDE_SYMBOLS) && !(name_p->u.hash & ECMA_SYMBOL_FLAG_PRIVATE_KEY))
       {
-        if (!(filter & JERRY_PROPERTY_FILTER_EXCLUDE_SYMBOLS) && !(name_p->u.hash & ECMA_SYMBOL_FLAG_PRIVATE_KEY))
-        {
-          *(--symbol_current_p) = ecma_make_symbol_value (name_p);
-          continue;
-        }
+        *(--symbol_current_p) = ecma_make_symbol_value (name_p);
+        continue;
       }
-      else
+    }
+    else
+    {
+      if (!(filter & JERRY_PROPERTY_FILTER_EXCLUDE_STRINGS))
       {
-        if (!(filter & JERRY_PROPERTY_FILTER_EXCLUDE_STRINGS))
-        {
-          *(--string_current_p) = ecma_make_string_value (name_p);
-          continue;
-        }
+        *(--string_current_p) = ecma_make_string_value (name_p);
+        continue;
       }
-
-      ecma_deref_ecma_string (name_p);
     }
 
-    prop_iter_cp = prop_iter_p->next_property_cp;
+    ecma_deref_ecma_string (name_p);
   }
 
   if (array_index_named_props > 1 || (array_index_named_props == 1 && prop_counter.array_index_named_props > 0))
@@ -3238,6 +3305,13 @@ ecma_op_ordinary_object_set_prototype_of (ecma_object_t *obj_p, /**< base object
   }
 
   /* 9. */
+#if JERRY_GC_GENERATIONAL
+  if (new_proto_p != NULL)
+  {
+    ecma_gc_remember_object (new_proto_p);
+  }
+#endif /* JERRY_GC_GENERATIONAL */
+
   ECMA_SET_POINTER (obj_p->u2.prototype_cp, new_proto_p);
 
   /* 10. */
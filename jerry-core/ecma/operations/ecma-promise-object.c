@@ -711,6 +711,9 @@ ecma_op_get_capabilities_executor_cb (ecma_object_t *function_obj_p, /**< functi
   /* 7. */
   capability_p->reject = (args_count > 1) ? args_p[1] : ECMA_VALUE_UNDEFINED;
 
+  ECMA_GC_REMEMBER_VALUE (capability_p->resolve);
+  ECMA_GC_REMEMBER_VALUE (capability_p->reject);
+
   /* 8. */
   return ECMA_VALUE_UNDEFINED;
 } /* ecma_op_get_capabilities_executor_cb */
@@ -796,6 +799,7 @@ ecma_promise_new_capability (ecma_value_t constructor, /**< constructor function
 
   /* 10. */
   capability_p->header.u.cls.u3.promise = promise;
+  ECMA_GC_REMEMBER_VALUE (promise);
 
   ecma_free_value (promise);
 
@@ -1144,6 +1148,7 @@ ecma_promise_async_then (ecma_value_t promise, /**< promise object */
     ecma_value_t executable_object_with_tag;
     ECMA_SET_NON_NULL_POINTER_TAG (executable_object_with_tag, ecma_get_object_from_value (executable_object), 0);
     ECMA_SET_THIRD_BIT_TO_POINTER_TAG (executable_object_with_tag);
+    ECMA_GC_REMEMBER_VALUE (executable_object);
 
     ecma_collection_push_back (((ecma_promise_object_t *) promise_obj_p)->reactions, executable_object_with_tag);
     return;
@@ -1289,6 +1294,9 @@ ecma_promise_perform_then (ecma_value_t promise, /**< the promise which call 'th
     }
 
     ECMA_SET_NON_NULL_POINTER_TAG (reaction_values[0], result_capability_obj_p, tag);
+    ECMA_GC_REMEMBER_OBJECT (result_capability_obj_p);
+    ECMA_GC_REMEMBER_VALUE (on_fulfilled);
+    ECMA_GC_REMEMBER_VALUE (on_rejected);
 
     uint32_t value_count = (uint32_t) (reactions_p - reaction_values);
     ecma_collection_append (promise_p->reactions, reaction_values, value_count);
@@ -183,6 +183,7 @@ ecma_proxy_create_revocable (ecma_value_t target, /**< target argument */
                                                   ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                   NULL);
   prop_value_p->value = proxy_value;
+  ECMA_GC_REMEMBER_VALUE (proxy_value);
 
   /* 7. */
   prop_value_p = ecma_create_named_data_property (obj_p,
@@ -190,6 +191,7 @@ ecma_proxy_create_revocable (ecma_value_t target, /**< target argument */
                                                   ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                   NULL);
   prop_value_p->value = revoker;
+  ECMA_GC_REMEMBER_VALUE (revoker);
 
   ecma_deref_object (proxy_p);
   ecma_deref_object (func_obj_p);
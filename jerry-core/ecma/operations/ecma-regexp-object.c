@@ -519,6 +519,105 @@ ecma_regexp_is_word_boundary (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context *
   return lit_char_is_word_char (left_cp) != lit_char_is_word_char (right_cp);
 } /* ecma_regexp_is_word_boundary */
 
+/**
+ * Check whether a character is in a character class, and skip the class data in the byte code.
+ *
+ * @return true, if the character is matched by the class
+ *         false - otherwise
+ */
+static bool
+ecma_regexp_check_char_class (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context */
+                              const uint8_t **bc_p, /**< [in, out] pointer to the class data */
+                              lit_code_point_t cp) /**< character */
+{
+  const uint8_t flags = re_get_byte (bc_p);
+  uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (bc_p) : 0;
+  uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (bc_p) : 0;
+  uint8_t escape_count = flags & RE_CLASS_ESCAPE_COUNT_MASK;
+  const bool is_unicode = (re_ctx_p->flags & RE_FLAG_UNICODE) != 0;
+  bool is_found = false;
+
+  while (escape_count > 0)
+  {
+    escape_count--;
+    const ecma_class_escape_t escape = re_get_byte (bc_p);
+    if (ecma_regexp_check_class_escape (cp, escape))
+    {
+      is_found = true;
+      goto class_found;
+    }
+  }
+
+  while (char_count > 0)
+  {
+    char_count--;
+    const lit_code_point_t curr = re_get_char (bc_p, is_unicode);
+    if (cp == curr)
+    {
+      is_found = true;
+      goto class_found;
+    }
+  }
+
+  while (range_count > 0)
+  {
+    range_count--;
+    const lit_code_point_t begin = re_get_char (bc_p, is_unicode);
+
+    if (cp < begin)
+    {
+      *bc_p += re_ctx_p->char_size;
+      continue;
+    }
+
+    const lit_code_point_t end = re_get_char (bc_p, is_unicode);
+    if (cp <= end)
+    {
+      is_found = true;
+      goto class_found;
+    }
+  }
+
+class_found:
+  *bc_p += escape_count + (char_count + range_count * 2) * re_ctx_p->char_size;
+  return is_found != ((flags & RE_CLASS_INVERT) != 0);
+} /* ecma_regexp_check_char_class */
+
+/**
+ * Check a zero-width assertion at the current position.
+ *
+ * @return true, if the assertion holds
+ *         false - otherwise
+ */
+static bool
+ecma_regexp_check_assertion (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context */
+                             re_opcode_t op, /**< assertion opcode */
+                             const lit_utf8_byte_t *str_p) /**< string pointer */
+{
+  switch (op)
+  {
+    case RE_OP_ASSERT_LINE_START:
+    {
+      return (str_p <= re_ctx_p->input_start_p
+              || ((re_ctx_p->flags & RE_FLAG_MULTILINE) && lit_char_is_line_terminator (lit_cesu8_peek_prev (str_p))));
+    }
+    case RE_OP_ASSERT_LINE_END:
+    {
+      return (str_p >= re_ctx_p->input_end_p
+              || ((re_ctx_p->flags & RE_FLAG_MULTILINE) && lit_char_is_line_terminator (lit_cesu8_peek_next (str_p))));
+    }
+    case RE_OP_ASSERT_WORD_BOUNDARY:
+    {
+      return ecma_regexp_is_word_boundary (re_ctx_p, str_p);
+    }
+    default:
+    {
+      JERRY_ASSERT (op == RE_OP_ASSERT_NOT_WORD_BOUNDARY);
+      return !ecma_regexp_is_word_boundary (re_ctx_p, str_p);
+    }
+  }
+} /* ecma_regexp_check_assertion */
+
 /**
  * Recursive function for executing RegExp bytecode.
  *
@@ -536,10 +635,17 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
 #if (JERRY_STACK_LIMIT != 0)
   if (JERRY_UNLIKELY (ecma_get_current_stack_usage () > CONFIG_MEM_STACK_LIMIT))
   {
-    return ECMA_RE_OUT_OF_STACK;
+    return ECMA_RE_LIMIT_EXCEEDED;
   }
 #endif /* JERRY_STACK_LIMIT != 0 */
 
+  if (JERRY_UNLIKELY (re_ctx_p->steps_left == 0))
+  {
+    return ECMA_RE_LIMIT_EXCEEDED;
+  }
+
+  re_ctx_p->steps_left--;
+
   const lit_utf8_byte_t *str_start_p = str_curr_p;
   const uint8_t *next_alternative_p = NULL;
 
@@ -1026,7 +1132,7 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
             goto fail;
           }
 
-          if (ECMA_RE_STACK_LIMIT_REACHED (str_curr_p))
+          if (ECMA_RE_LIMIT_REACHED (str_curr_p))
           {
             return str_curr_p;
           }
@@ -1043,9 +1149,9 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
             break;
           }
 
-          if (ECMA_RE_STACK_LIMIT_REACHED (str_curr_p))
+          if (ECMA_RE_LIMIT_REACHED (matched_p))
           {
-            return str_curr_p;
+            return matched_p;
           }
 
           str_curr_p = matched_p;
@@ -1090,7 +1196,7 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
             goto fail;
           }
 
-          if (ECMA_RE_STACK_LIMIT_REACHED (str_curr_p))
+          if (ECMA_RE_LIMIT_REACHED (str_curr_p))
           {
             return str_curr_p;
           }
@@ -1120,7 +1226,7 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
             goto fail;
           }
 
-          if (ECMA_RE_STACK_LIMIT_REACHED (matched_p))
+          if (ECMA_RE_LIMIT_REACHED (matched_p))
           {
             return matched_p;
           }
@@ -1154,45 +1260,11 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
         continue;
       }
       case RE_OP_ASSERT_LINE_START:
-      {
-        if (str_curr_p <= re_ctx_p->input_start_p)
-        {
-          continue;
-        }
-
-        if (!(re_ctx_p->flags & RE_FLAG_MULTILINE) || !lit_char_is_line_terminator (lit_cesu8_peek_prev (str_curr_p)))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_LINE_END:
-      {
-        if (str_curr_p >= re_ctx_p->input_end_p)
-        {
-          continue;
-        }
-
-        if (!(re_ctx_p->flags & RE_FLAG_MULTILINE) || !lit_char_is_line_terminator (lit_cesu8_peek_next (str_curr_p)))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_WORD_BOUNDARY:
-      {
-        if (!ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
       {
-        if (ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p))
+        if (!ecma_regexp_check_assertion (re_ctx_p, op, str_curr_p))
         {
           goto fail;
         }
@@ -1225,7 +1297,7 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
          * the iteration matched or not. */
         const lit_utf8_byte_t *const matched_p = ecma_regexp_run (re_ctx_p, bc_p, str_curr_p);
 
-        if (ECMA_RE_STACK_LIMIT_REACHED (matched_p))
+        if (ECMA_RE_LIMIT_REACHED (matched_p))
         {
           return matched_p;
         }
@@ -1265,7 +1337,7 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
            * the iteration matched or not. */
           const lit_utf8_byte_t *const matched_p = ecma_regexp_run (re_ctx_p, bc_p, str_curr_p);
 
-          if (ECMA_RE_STACK_LIMIT_REACHED (matched_p))
+          if (ECMA_RE_LIMIT_REACHED (matched_p))
           {
             return matched_p;
           }
@@ -1310,68 +1382,13 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
           goto fail;
         }
 
-        uint8_t flags = re_get_byte (&bc_p);
-        uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
-        uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
-
         const lit_code_point_t cp = ecma_regexp_advance (re_ctx_p, &str_curr_p);
 
-        uint8_t escape_count = flags & RE_CLASS_ESCAPE_COUNT_MASK;
-        while (escape_count > 0)
-        {
-          escape_count--;
-          const ecma_class_escape_t escape = re_get_byte (&bc_p);
-          if (ecma_regexp_check_class_escape (cp, escape))
-          {
-            goto class_found;
-          }
-        }
-
-        while (char_count > 0)
-        {
-          char_count--;
-          const lit_code_point_t curr = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-          if (cp == curr)
-          {
-            goto class_found;
-          }
-        }
-
-        while (range_count > 0)
-        {
-          range_count--;
-          const lit_code_point_t begin = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-
-          if (cp < begin)
-          {
-            bc_p += re_ctx_p->char_size;
-            continue;
-          }
-
-          const lit_code_point_t end = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-          if (cp <= end)
-          {
-            goto class_found;
-          }
-        }
-
-        /* Not found */
-        if (flags & RE_CLASS_INVERT)
-        {
-          continue;
-        }
-
-        goto fail;
-
-class_found:
-        if (flags & RE_CLASS_INVERT)
+        if (!ecma_regexp_check_char_class (re_ctx_p, &bc_p, cp))
         {
           goto fail;
         }
 
-        const uint32_t chars_size = char_count * re_ctx_p->char_size;
-        const uint32_t ranges_size = range_count * re_ctx_p->char_size * 2;
-        bc_p = bc_p + escape_count + chars_size + ranges_size;
         continue;
       }
       case RE_OP_UNICODE_PERIOD:
@@ -1454,6 +1471,445 @@ fail:
   }
 } /* ecma_regexp_run */
 
+/**
+ * Flag of automaton stack entries which refer to instructions rather than saved capture slots
+ */
+#define ECMA_RE_NFA_VISIT_FLAG 0x80000000u
+
+/**
+ * Entry of the automaton stack
+ */
+typedef struct
+{
+  const lit_utf8_byte_t *value_p; /**< saved value of a capture slot */
+  uint32_t index; /**< index of the capture slot, or index of an instruction
+                   *   combined with ECMA_RE_NFA_VISIT_FLAG */
+} ecma_regexp_nfa_stack_entry_t;
+
+/**
+ * List of automaton threads in priority order
+ */
+typedef struct
+{
+  const lit_utf8_byte_t **slots_p; /**< capture slots of the threads */
+  uint16_t *pcs_p; /**< instruction indices of the threads */
+  uint32_t count; /**< number of threads */
+  uint32_t generation; /**< marker of the instructions which are in the list */
+} ecma_regexp_nfa_list_t;
+
+/**
+ * Automaton executor state
+ */
+typedef struct
+{
+  const re_nfa_header_t *nfa_p; /**< automaton */
+  const uint8_t *bytecode_p; /**< start of the compiled code */
+  ecma_regexp_nfa_list_t lists[2]; /**< current and next thread lists */
+  const lit_utf8_byte_t **slots_p; /**< capture slots of the thread which is currently added */
+  ecma_regexp_nfa_stack_entry_t *stack_p; /**< stack for following the epsilon transitions */
+  uint32_t *generations_p; /**< last list generation of each instruction */
+  uint32_t slot_count; /**< number of capture slots */
+  size_t size; /**< size of the allocated memory */
+} ecma_regexp_nfa_t;
+
+/**
+ * Match a single character with a character atom.
+ *
+ * @return pointer after the matched character
+ *         NULL, if the atom did not match
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_nfa_match_char (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context */
+                            const uint8_t *bc_p, /**< pointer to the atom */
+                            const lit_utf8_byte_t *str_p) /**< input string pointer */
+{
+  JERRY_ASSERT (str_p < re_ctx_p->input_end_p);
+
+  switch (re_get_opcode (&bc_p))
+  {
+    case RE_OP_CLASS_ESCAPE:
+    {
+      const lit_code_point_t cp = ecma_regexp_advance (re_ctx_p, &str_p);
+      return ecma_regexp_check_class_escape (cp, (ecma_class_escape_t) re_get_byte (&bc_p)) ? str_p : NULL;
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      const lit_code_point_t cp = ecma_regexp_advance (re_ctx_p, &str_p);
+      return ecma_regexp_check_char_class (re_ctx_p, &bc_p, cp) ? str_p : NULL;
+    }
+    case RE_OP_UNICODE_PERIOD:
+    {
+      const lit_code_point_t cp = ecma_regexp_unicode_advance (&str_p, re_ctx_p->input_end_p);
+
+      if (!(re_ctx_p->flags & RE_FLAG_DOTALL)
+          && JERRY_UNLIKELY (cp <= LIT_UTF16_CODE_UNIT_MAX && lit_char_is_line_terminator ((ecma_char_t) cp)))
+      {
+        return NULL;
+      }
+
+      return str_p;
+    }
+    case RE_OP_PERIOD:
+    {
+      const ecma_char_t ch = lit_cesu8_read_next (&str_p);
+
+      if (!(re_ctx_p->flags & RE_FLAG_DOTALL) && lit_char_is_line_terminator (ch))
+      {
+        return NULL;
+      }
+
+      return str_p;
+    }
+    case RE_OP_CHAR:
+    {
+      const lit_code_point_t ch = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
+      return (ch == ecma_regexp_advance (re_ctx_p, &str_p)) ? str_p : NULL;
+    }
+    default:
+    {
+      JERRY_ASSERT (bc_p[-1] == RE_OP_BYTE);
+      return (*bc_p == *str_p) ? str_p + 1 : NULL;
+    }
+  }
+} /* ecma_regexp_nfa_match_char */
+
+/**
+ * Add a thread and all threads reachable from it by epsilon transitions to a thread list.
+ *
+ * The threads are added in priority order, and instructions which are already in the list
+ * are skipped, since the thread which reached them first has higher priority.
+ */
+static void
+ecma_regexp_nfa_add_thread (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context */
+                            ecma_regexp_nfa_t *nfa_p, /**< automaton executor state */
+                            ecma_regexp_nfa_list_t *list_p, /**< thread list */
+                            uint32_t pc, /**< instruction index */
+                            const lit_utf8_byte_t *str_p) /**< current position */
+{
+  const re_nfa_instruction_t *instructions_p = RE_NFA_GET_INSTRUCTIONS (nfa_p->nfa_p);
+  const lit_utf8_byte_t **slots_p = nfa_p->slots_p;
+  ecma_regexp_nfa_stack_entry_t *stack_p = nfa_p->stack_p;
+  uint32_t stack_top = 0;
+
+  stack_p[stack_top++].index = pc | ECMA_RE_NFA_VISIT_FLAG;
+
+  while (stack_top > 0)
+  {
+    const ecma_regexp_nfa_stack_entry_t *entry_p = stack_p + --stack_top;
+
+    if (!(entry_p->index & ECMA_RE_NFA_VISIT_FLAG))
+    {
+      slots_p[entry_p->index] = entry_p->value_p;
+      continue;
+    }
+
+    pc = entry_p->index & ~ECMA_RE_NFA_VISIT_FLAG;
+
+    if (nfa_p->generations_p[pc] == list_p->generation)
+    {
+      continue;
+    }
+
+    nfa_p->generations_p[pc] = list_p->generation;
+    const re_nfa_instruction_t *instruction_p = instructions_p + pc;
+
+    switch (instruction_p->opcode)
+    {
+      case RE_NFA_OP_CHAR:
+      case RE_NFA_OP_MATCH:
+      {
+        JERRY_ASSERT (list_p->count < nfa_p->nfa_p->thread_count);
+        list_p->pcs_p[list_p->count] = (uint16_t) pc;
+        memcpy (list_p->slots_p + list_p->count * nfa_p->slot_count,
+                slots_p,
+                nfa_p->slot_count * sizeof (const lit_utf8_byte_t *));
+        list_p->count++;
+        break;
+      }
+      case RE_NFA_OP_SPLIT:
+      {
+        stack_p[stack_top++].index = instruction_p->arg2 | ECMA_RE_NFA_VISIT_FLAG;
+        stack_p[stack_top++].index = instruction_p->arg1 | ECMA_RE_NFA_VISIT_FLAG;
+        break;
+      }
+      case RE_NFA_OP_JUMP:
+      {
+        stack_p[stack_top++].index = instruction_p->arg1 | ECMA_RE_NFA_VISIT_FLAG;
+        break;
+      }
+      case RE_NFA_OP_SAVE:
+      {
+        /* The original value is restored when the threads of the next instruction are added. */
+        stack_p[stack_top].index = instruction_p->arg1;
+        stack_p[stack_top++].value_p = slots_p[instruction_p->arg1];
+        slots_p[instruction_p->arg1] = str_p;
+        stack_p[stack_top++].index = (pc + 1) | ECMA_RE_NFA_VISIT_FLAG;
+        break;
+      }
+      case RE_NFA_OP_CLEAR:
+      {
+        const uint32_t slot_end = instruction_p->arg1 + instruction_p->arg2;
+
+        for (uint32_t slot = instruction_p->arg1; slot < slot_end; slot++)
+        {
+          stack_p[stack_top].index = slot;
+          stack_p[stack_top++].value_p = slots_p[slot];
+          slots_p[slot] = NULL;
+        }
+
+        stack_p[stack_top++].index = (pc + 1) | ECMA_RE_NFA_VISIT_FLAG;
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (instruction_p->opcode == RE_NFA_OP_ASSERT);
+
+        if (ecma_regexp_check_assertion (re_ctx_p, (re_opcode_t) instruction_p->arg1, str_p))
+        {
+          stack_p[stack_top++].index = (pc + 1) | ECMA_RE_NFA_VISIT_FLAG;
+        }
+        break;
+      }
+    }
+
+    JERRY_ASSERT (stack_top <= nfa_p->nfa_p->stack_size);
+  }
+} /* ecma_regexp_nfa_add_thread */
+
+/**
+ * Allocate the state of the automaton executor.
+ *
+ * @return true - if the memory is allocated
+ *         false - otherwise
+ */
+static bool
+ecma_regexp_nfa_init (ecma_regexp_nfa_t *nfa_p, /**< [out] automaton executor state */
+                      const re_compiled_code_t *bc_p, /**< RegExp bytecode */
+                      uint32_t captures_count) /**< number of capture groups */
+{
+  const re_nfa_header_t *header_p = (const re_nfa_header_t *) (((const uint8_t *) bc_p) + bc_p->nfa_offset);
+  const uint32_t slot_count = captures_count * 2;
+  const size_t slots_size = slot_count * sizeof (const lit_utf8_byte_t *);
+  const size_t list_slots_size = header_p->thread_count * slots_size;
+  const size_t stack_size = header_p->stack_size * sizeof (ecma_regexp_nfa_stack_entry_t);
+  const size_t generations_size = header_p->instruction_count * sizeof (uint32_t);
+  const size_t pcs_size = header_p->thread_count * sizeof (uint16_t);
+
+  nfa_p->size = 2 * list_slots_size + slots_size + stack_size + generations_size + 2 * pcs_size;
+  uint8_t *memory_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (nfa_p->size);
+
+  if (memory_p == NULL)
+  {
+    return false;
+  }
+
+  nfa_p->nfa_p = header_p;
+  nfa_p->bytecode_p = (const uint8_t *) bc_p;
+  nfa_p->slot_count = slot_count;
+  nfa_p->stack_p = (ecma_regexp_nfa_stack_entry_t *) memory_p;
+  memory_p += stack_size;
+  nfa_p->lists[0].slots_p = (const lit_utf8_byte_t **) memory_p;
+  memory_p += list_slots_size;
+  nfa_p->lists[1].slots_p = (const lit_utf8_byte_t **) memory_p;
+  memory_p += list_slots_size;
+  nfa_p->slots_p = (const lit_utf8_byte_t **) memory_p;
+  memory_p += slots_size;
+  nfa_p->generations_p = (uint32_t *) memory_p;
+  memory_p += generations_size;
+  nfa_p->lists[0].pcs_p = (uint16_t *) memory_p;
+  memory_p += pcs_size;
+  nfa_p->lists[1].pcs_p = (uint16_t *) memory_p;
+
+  memset (nfa_p->generations_p, 0, generations_size);
+  nfa_p->lists[0].count = 0;
+  nfa_p->lists[0].generation = 1;
+  nfa_p->lists[1].count = 0;
+  nfa_p->lists[1].generation = 2;
+  return true;
+} /* ecma_regexp_nfa_init */
+
+/**
+ * Find the next position where a match of a RegExp can start.
+ *
+ * @return pointer to the position
+ *         NULL, if a match cannot start at any of the remaining positions
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_scan (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                  const re_compiled_code_t *bc_p, /**< RegExp bytecode */
+                  const lit_utf8_byte_t *str_p) /**< input string pointer */
+{
+  const lit_utf8_byte_t *const end_p = re_ctx_p->input_end_p;
+
+  switch (bc_p->scan_type)
+  {
+    case RE_SCAN_INPUT_START:
+    {
+      return (str_p == re_ctx_p->input_start_p) ? str_p : NULL;
+    }
+    case RE_SCAN_PREFIX:
+    {
+      const uint8_t *prefix_p = RE_GET_SCAN_DATA (bc_p);
+      const size_t prefix_size = bc_p->prefix_size;
+
+      while ((size_t) (end_p - str_p) >= prefix_size)
+      {
+        str_p = (const lit_utf8_byte_t *) memchr (str_p, prefix_p[0], (size_t) (end_p - str_p) - prefix_size + 1);
+
+        if (str_p == NULL || memcmp (str_p + 1, prefix_p + 1, prefix_size - 1) == 0)
+        {
+          return str_p;
+        }
+
+        str_p++;
+      }
+
+      return NULL;
+    }
+    case RE_SCAN_FIRST_BYTES:
+    {
+      const uint8_t *bitmap_p = RE_GET_SCAN_DATA (bc_p);
+
+      while (str_p < end_p)
+      {
+        if (bitmap_p[*str_p >> 3] & (1u << (*str_p & 0x7)))
+        {
+          return str_p;
+        }
+
+        str_p++;
+      }
+
+      return NULL;
+    }
+    default:
+    {
+      JERRY_ASSERT (bc_p->scan_type == RE_SCAN_ANY);
+      return str_p;
+    }
+  }
+} /* ecma_regexp_scan */
+
+/**
+ * Find the first match of a RegExp with its automaton.
+ *
+ * All threads are executed in lockstep, and a new thread is started at each position
+ * until a match is found, so the input is processed only once. Sticky patterns only
+ * start a thread at the initial position.
+ *
+ * @return pointer to the end of the matched substring
+ *         NULL, if pattern did not match
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_nfa_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                     ecma_regexp_nfa_t *nfa_p, /**< automaton executor state */
+                     const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  const re_nfa_instruction_t *instructions_p = RE_NFA_GET_INSTRUCTIONS (nfa_p->nfa_p);
+  const size_t slots_size = nfa_p->slot_count * sizeof (const lit_utf8_byte_t *);
+  const lit_utf8_byte_t *const start_p = str_curr_p;
+  const lit_utf8_byte_t *matched_p = NULL;
+  ecma_regexp_nfa_list_t *current_list_p = nfa_p->lists + 0;
+  ecma_regexp_nfa_list_t *next_list_p = nfa_p->lists + 1;
+  uint32_t generation = next_list_p->generation;
+
+  while (true)
+  {
+    if (current_list_p->count == 0 && matched_p == NULL && !(re_ctx_p->flags & RE_FLAG_STICKY))
+    {
+      /* There are no running threads, so the positions where a match cannot start are skipped. */
+      str_curr_p = ecma_regexp_scan (re_ctx_p, (const re_compiled_code_t *) nfa_p->bytecode_p, str_curr_p);
+
+      if (str_curr_p == NULL)
+      {
+        break;
+      }
+    }
+
+    if (matched_p == NULL && (str_curr_p == start_p || !(re_ctx_p->flags & RE_FLAG_STICKY)))
+    {
+      /* The new thread has the lowest priority. */
+      memset (nfa_p->slots_p, 0, slots_size);
+      ecma_regexp_nfa_add_thread (re_ctx_p, nfa_p, current_list_p, 0, str_curr_p);
+    }
+    else if (current_list_p->count == 0)
+    {
+      break;
+    }
+
+    next_list_p->count = 0;
+    next_list_p->generation = ++generation;
+
+    const lit_utf8_byte_t *next_p = NULL;
+
+    for (uint32_t i = 0; i < current_list_p->count; i++)
+    {
+      const uint32_t pc = current_list_p->pcs_p[i];
+      const lit_utf8_byte_t **thread_slots_p = current_list_p->slots_p + i * nfa_p->slot_count;
+
+      if (instructions_p[pc].opcode == RE_NFA_OP_MATCH)
+      {
+        for (uint32_t j = 0; j < re_ctx_p->captures_count; j++)
+        {
+          re_ctx_p->captures_p[j].begin_p = thread_slots_p[j * 2];
+          re_ctx_p->captures_p[j].end_p = thread_slots_p[j * 2 + 1];
+        }
+
+        /* The threads with lower priority are discarded. */
+        matched_p = str_curr_p;
+        break;
+      }
+
+      JERRY_ASSERT (instructions_p[pc].opcode == RE_NFA_OP_CHAR);
+
+      if (str_curr_p >= re_ctx_p->input_end_p)
+      {
+        continue;
+      }
+
+      const lit_utf8_byte_t *char_end_p =
+        ecma_regexp_nfa_match_char (re_ctx_p, nfa_p->bytecode_p + instructions_p[pc].arg2, str_curr_p);
+
+      if (char_end_p != NULL)
+      {
+        JERRY_ASSERT (next_p == NULL || next_p == char_end_p);
+        next_p = char_end_p;
+
+        memcpy (nfa_p->slots_p, thread_slots_p, slots_size);
+        ecma_regexp_nfa_add_thread (re_ctx_p, nfa_p, next_list_p, pc + 1, char_end_p);
+      }
+    }
+
+    if (str_curr_p >= re_ctx_p->input_end_p)
+    {
+      break;
+    }
+
+    if (next_p == NULL)
+    {
+      next_p = str_curr_p;
+
+      if (re_ctx_p->flags & RE_FLAG_UNICODE)
+      {
+        ecma_regexp_unicode_advance (&next_p, re_ctx_p->input_end_p);
+      }
+      else
+      {
+        lit_utf8_incr (&next_p);
+      }
+    }
+
+    str_curr_p = next_p;
+
+    ecma_regexp_nfa_list_t *list_p = current_list_p;
+    current_list_p = next_list_p;
+    next_list_p = list_p;
+  }
+
+  JERRY_ASSERT (matched_p == NULL || matched_p == re_ctx_p->captures_p[RE_GLOBAL_CAPTURE].end_p);
+  return matched_p;
+} /* ecma_regexp_nfa_run */
+
 /**
  * Match a RegExp at a specific position in the input string.
  *
@@ -1475,6 +1931,116 @@ ecma_regexp_match (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
   return ecma_regexp_run (re_ctx_p, bc_p, str_curr_p);
 } /* ecma_regexp_match */
 
+/**
+ * Get the number of backtracking steps allowed for a single search.
+ *
+ * @return number of steps
+ */
+static uint32_t
+ecma_regexp_get_step_limit (void)
+{
+#if JERRY_REGEXP_STEP_LIMIT != 0
+  return JERRY_REGEXP_STEP_LIMIT;
+#else /* JERRY_REGEXP_STEP_LIMIT == 0 */
+  return UINT32_MAX;
+#endif /* JERRY_REGEXP_STEP_LIMIT != 0 */
+} /* ecma_regexp_get_step_limit */
+
+/**
+ * Find the first match of a RegExp starting from a specific position in the input string.
+ * Sticky patterns only match at the starting position.
+ *
+ * Backtracking has no setup cost, so it is used first even if the pattern has an automaton.
+ * When the backtracking takes too many steps or reaches the stack limit, the rest of the
+ * input is searched by the automaton, which keeps the matching time linear.
+ *
+ * @return pointer to the end of the matched sub-string, the start of the sub-string is
+ *         stored in the global capture
+ *         NULL, if pattern did not match
+ *         ECMA_RE_LIMIT_EXCEEDED, if a limit is reached
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_search (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                    const re_compiled_code_t *bc_p, /**< RegExp bytecode */
+                    const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  const uint8_t *bc_start_p = (const uint8_t *) (bc_p + 1);
+  bool has_nfa = (bc_p->nfa_offset != 0);
+
+  re_ctx_p->steps_left = ecma_regexp_get_step_limit ();
+
+  if (has_nfa)
+  {
+    size_t input_size = (size_t) (re_ctx_p->input_end_p - str_curr_p) + 1;
+
+    if (input_size < UINT32_MAX / ECMA_RE_NFA_FALLBACK_STEPS)
+    {
+      re_ctx_p->steps_left = (uint32_t) input_size * ECMA_RE_NFA_FALLBACK_STEPS;
+    }
+  }
+
+  while (true)
+  {
+    if (!(re_ctx_p->flags & RE_FLAG_STICKY))
+    {
+      str_curr_p = ecma_regexp_scan (re_ctx_p, bc_p, str_curr_p);
+
+      if (str_curr_p == NULL)
+      {
+        return NULL;
+      }
+    }
+
+    const lit_utf8_byte_t *matched_p = ecma_regexp_match (re_ctx_p, bc_start_p, str_curr_p);
+
+    if (ECMA_RE_LIMIT_REACHED (matched_p) && has_nfa)
+    {
+      ecma_regexp_nfa_t nfa;
+
+      if (ecma_regexp_nfa_init (&nfa, bc_p, re_ctx_p->captures_count))
+      {
+        matched_p = ecma_regexp_nfa_run (re_ctx_p, &nfa, str_curr_p);
+        jmem_heap_free_block ((void *) nfa.stack_p, nfa.size);
+        return matched_p;
+      }
+
+      /* Backtracking is continued when there is not enough memory for the threads. */
+      has_nfa = false;
+      re_ctx_p->steps_left = ecma_regexp_get_step_limit ();
+      continue;
+    }
+
+    if (matched_p != NULL || (re_ctx_p->flags & RE_FLAG_STICKY) || str_curr_p >= re_ctx_p->input_end_p)
+    {
+      return matched_p;
+    }
+
+    if (re_ctx_p->flags & RE_FLAG_UNICODE)
+    {
+      ecma_regexp_unicode_advance (&str_curr_p, re_ctx_p->input_end_p);
+      continue;
+    }
+
+    lit_utf8_incr (&str_curr_p);
+  }
+} /* ecma_regexp_search */
+
+/**
+ * Raise the error of a RegExp match which exceeded a limit.
+ *
+ * @return ECMA_VALUE_ERROR
+ */
+static ecma_value_t
+ecma_regexp_raise_limit_error (ecma_regexp_ctx_t *re_ctx_p) /**< RegExp matcher context */
+{
+  if (re_ctx_p->steps_left == 0)
+  {
+    return ecma_raise_range_error (ECMA_ERR_REGEXP_STEP_LIMIT_EXCEEDED);
+  }
+
+  return ecma_raise_range_error (ECMA_ERR_STACK_LIMIT_EXCEEDED);
+} /* ecma_regexp_raise_limit_error */
+
 /*
  * Helper function to get the result of a capture
  *
@@ -1654,61 +2220,33 @@ ecma_regexp_exec_helper (ecma_object_t *regexp_object_p, /**< RegExp object */
     index = 0;
   }
 
-  /* 9. */
-  uint8_t *bc_start_p = (uint8_t *) (bc_p + 1);
-
-  /* 11. */
-  const lit_utf8_byte_t *matched_p = NULL;
-
-  /* 12. */
+  /* 11-12. */
   JERRY_ASSERT (index <= input_length);
-  while (true)
-  {
-    matched_p = ecma_regexp_match (&re_ctx, bc_start_p, input_curr_p);
-
-    if (matched_p != NULL)
-    {
-      goto match_found;
-    }
+  const lit_utf8_byte_t *matched_p = ecma_regexp_search (&re_ctx, bc_p, input_curr_p);
 
-    /* 12.c.i */
-    if (re_ctx.flags & RE_FLAG_STICKY)
-    {
-      goto fail_put_lastindex;
-    }
-
-    /* 12.a */
-    if (input_curr_p >= input_end_p)
-    {
-      if (re_ctx.flags & RE_FLAG_GLOBAL)
-      {
-        goto fail_put_lastindex;
-      }
-
-      goto match_failed;
-    }
-
-    JERRY_ASSERT (input_curr_p < input_end_p);
+  if (ECMA_RE_LIMIT_REACHED (matched_p))
+  {
+    ret_value = ecma_regexp_raise_limit_error (&re_ctx);
+    goto cleanup_context;
+  }
 
+  if (matched_p != NULL)
+  {
     /* 12.c.ii */
-    index++;
-
-    if (re_ctx.flags & RE_FLAG_UNICODE)
-    {
-      const lit_code_point_t cp = ecma_regexp_unicode_advance (&input_curr_p, input_end_p);
-
-      if (cp > LIT_UTF16_CODE_UNIT_MAX)
-      {
-        index++;
-      }
-
-      continue;
-    }
+    const lit_utf8_byte_t *match_begin_p = re_ctx.captures_p[RE_GLOBAL_CAPTURE].begin_p;
+    const lit_utf8_size_t skipped_size = (lit_utf8_size_t) (match_begin_p - input_curr_p);
+    index += (input_flags & ECMA_STRING_FLAG_IS_ASCII) ? skipped_size
+                                                        : lit_utf8_string_length (input_curr_p, skipped_size);
+    goto match_found;
+  }
 
-    lit_utf8_incr (&input_curr_p);
+  /* 12.a, 12.c.i */
+  if (re_ctx.flags & (RE_FLAG_GLOBAL | RE_FLAG_STICKY))
+  {
+    goto fail_put_lastindex;
   }
 
-  JERRY_UNREACHABLE ();
+  goto match_failed;
 
 fail_put_lastindex:
   /* We should only get here if the regexp is global or sticky */
@@ -1732,14 +2270,6 @@ match_failed:
   goto cleanup_context;
 
 match_found:
-  JERRY_ASSERT (matched_p != NULL);
-
-  if (ECMA_RE_STACK_LIMIT_REACHED (matched_p))
-  {
-    ret_value = ecma_raise_range_error (ECMA_ERR_STACK_LIMIT_EXCEEDED);
-    goto cleanup_context;
-  }
-
   JERRY_ASSERT (index <= input_length);
 
   /* 15. */
@@ -2275,7 +2805,6 @@ ecma_regexp_replace_helper_fast (ecma_replace_context_t *ctx_p, /**<replace cont
   ctx_p->string_p = ecma_string_get_chars (string_p, &(ctx_p->string_size), &string_length, NULL, &string_flags);
 
   const lit_utf8_byte_t *const string_end_p = ctx_p->string_p + ctx_p->string_size;
-  const uint8_t *const bc_start_p = (const uint8_t *) (bc_p + 1);
   const lit_utf8_byte_t *matched_p = NULL;
   const lit_utf8_byte_t *current_p = ctx_p->string_p;
   const lit_utf8_byte_t *last_append_p = current_p;
@@ -2339,16 +2868,22 @@ ecma_regexp_replace_helper_fast (ecma_replace_context_t *ctx_p, /**<replace cont
 
   while (true)
   {
-    matched_p = ecma_regexp_match (&re_ctx, bc_start_p, current_p);
+    matched_p = ecma_regexp_search (&re_ctx, bc_p, current_p);
 
     if (matched_p != NULL)
     {
-      if (ECMA_RE_STACK_LIMIT_REACHED (matched_p))
+      if (ECMA_RE_LIMIT_REACHED (matched_p))
       {
-        result = ecma_raise_range_error (ECMA_ERR_STACK_LIMIT_EXCEEDED);
+        result = ecma_regexp_raise_limit_error (&re_ctx);
         goto cleanup_builder;
       }
 
+      const lit_utf8_byte_t *const match_begin_p = re_ctx.captures_p[RE_GLOBAL_CAPTURE].begin_p;
+      const lit_utf8_size_t skipped_size = (lit_utf8_size_t) (match_begin_p - current_p);
+      index += (string_flags & ECMA_STRING_FLAG_IS_ASCII) ? skipped_size
+                                                           : lit_utf8_string_length (current_p, skipped_size);
+      current_p = match_begin_p;
+
       const lit_utf8_size_t remaining_size = (lit_utf8_size_t) (current_p - last_append_p);
       ecma_stringbuilder_append_raw (&(ctx_p->builder), last_append_p, remaining_size);
 
@@ -2449,6 +2984,11 @@ ecma_regexp_replace_helper_fast (ecma_replace_context_t *ctx_p, /**<replace cont
 
       break;
     }
+    else
+    {
+      /* There are no more matches in the string. */
+      break;
+    }
 
     if (current_p >= string_end_p)
     {
@@ -114,19 +114,21 @@ typedef struct
 
 ecma_value_t ecma_regexp_get_capture_value (const ecma_regexp_capture_t *const capture_p);
 
-#if (JERRY_STACK_LIMIT != 0)
 /**
- * Value used ase result when stack limit is reached
+ * Value used as result when the stack limit or the step limit is reached
  */
-#define ECMA_RE_OUT_OF_STACK ((const lit_utf8_byte_t *) UINTPTR_MAX)
+#define ECMA_RE_LIMIT_EXCEEDED ((const lit_utf8_byte_t *) UINTPTR_MAX)
 
 /**
- * Checks if the stack limit has been reached during regexp matching
+ * Checks if the stack limit or the step limit has been reached during regexp matching
  */
-#define ECMA_RE_STACK_LIMIT_REACHED(p) (JERRY_UNLIKELY (p == ECMA_RE_OUT_OF_STACK))
-#else /* JERRY_STACK_LIMIT == 0 */
-#define ECMA_RE_STACK_LIMIT_REACHED(p) (false)
-#endif /* JERRY_STACK_LIMIT != 0 */
+#define ECMA_RE_LIMIT_REACHED(p) (JERRY_UNLIKELY (p == ECMA_RE_LIMIT_EXCEEDED))
+
+/**
+ * Number of backtracking steps per input character after which patterns
+ * with an automaton are matched by the automaton.
+ */
+#define ECMA_RE_NFA_FALLBACK_STEPS 32
 
 /**
  * Offset applied to qmax when encoded into the bytecode.
@@ -147,6 +149,7 @@ typedef struct
   uint32_t non_captures_count; /**< number of non-capture groups */
   ecma_regexp_capture_t *captures_p; /**< capturing groups */
   ecma_regexp_non_capture_t *non_captures_p; /**< non-capturing groups */
+  uint32_t steps_left; /**< number of backtracking steps left before the match is aborted */
   uint16_t flags; /**< RegExp flags */
   uint8_t char_size; /**< size of encoded characters */
 } ecma_regexp_ctx_t;
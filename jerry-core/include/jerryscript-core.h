@@ -54,6 +54,7 @@ void jerry_heap_free (void *mem_p, jerry_size_t size);
 
 bool jerry_heap_stats (jerry_heap_stats_t *out_stats_p);
 void jerry_heap_gc (jerry_gc_mode_t mode);
+bool jerry_heap_gc_step (uint32_t budget_us);
 
 bool jerry_foreach_live_object (jerry_foreach_live_object_cb_t callback, void *user_data);
 bool jerry_foreach_live_object_with_info (const jerry_object_native_info_t *native_info_p,
@@ -450,7 +451,7 @@ void *jerry_string_user_ptr (const jerry_value_t value, bool *is_external);
  * @defgroup jerry-api-string-op Operations
  * @{
  */
-jerry_size_t jerry_string_substr (const jerry_value_t value, jerry_length_t start, jerry_length_t end);
+jerry_value_t jerry_string_substr (const jerry_value_t value, jerry_length_t start, jerry_length_t end);
 jerry_size_t jerry_string_to_buffer (const jerry_value_t value,
                                      jerry_encoding_t encoding,
                                      jerry_char_t *buffer_p,
@@ -27,7 +27,7 @@ JERRY_C_API_BEGIN
 /**
  * Jerry snapshot format version.
  */
-#define JERRY_SNAPSHOT_VERSION (70u)
+#define JERRY_SNAPSHOT_VERSION (72u)
 
 /**
  * Flags for jerry_generate_snapshot and jerry_generate_function_snapshot.
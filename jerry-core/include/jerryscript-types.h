@@ -151,7 +151,11 @@ typedef uint32_t jerry_length_t;
 /**
  * Description of a JerryScript value.
  */
+#if defined(JERRY_NAN_BOXING) && JERRY_NAN_BOXING
+typedef uint64_t jerry_value_t;
+#else /* !defined(JERRY_NAN_BOXING) || !JERRY_NAN_BOXING */
 typedef uint32_t jerry_value_t;
+#endif /* defined(JERRY_NAN_BOXING) && JERRY_NAN_BOXING */
 
 /**
  * Option bits for jerry_parse_options_t.
@@ -166,6 +170,7 @@ typedef enum
   JERRY_PARSE_HAS_SOURCE_NAME = (1 << 3), /**< source_name field is valid */
   JERRY_PARSE_HAS_START = (1 << 4), /**< start_line and start_column fields are valid */
   JERRY_PARSE_HAS_USER_VALUE = (1 << 5), /**< user_value field is valid */
+  JERRY_PARSE_OPTIMIZE = (1 << 6), /**< optimize the byte code */
 } jerry_parse_option_enable_feature_t;
 
 /**
@@ -119,23 +119,30 @@ struct jerry_context_t
 #endif /* JERRY_EXTERNAL_CONTEXT */
 
   ecma_global_object_t *global_object_p; /**< current global object */
-  jmem_heap_free_t *jmem_heap_list_skip_p; /**< improves deallocation performance */
-  jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
+#if !JERRY_SYSTEM_ALLOCATOR
+  uint32_t jmem_heap_bins[JMEM_HEAP_BIN_COUNT]; /**< lists of small free regions, one for each size */
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
+  jmem_pools_chunk_t *jmem_free_chunk_p[JMEM_POOLS_CLASS_COUNT]; /**< lists of free pool chunks, one for each size */
+  ecma_lit_storage_hash_t *lit_storage_hash_p; /**< hash table of literal strings, numbers and BigInts */
 #if JERRY_BUILTIN_REGEXP
   re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
 #endif /* JERRY_BUILTIN_REGEXP */
-#if JERRY_CPOINTER_32_BIT
-  jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
-#endif /* JERRY_CPOINTER_32_BIT */
   const lit_utf8_byte_t *const *lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
-  jmem_cpointer_t string_list_first_cp; /**< first item of the literal string list */
+  jmem_cpointer_t ecma_gc_white_cp; /**< list of objects which are colored, marked or swept by the current
+                                     *   garbage collection cycle */
+  jmem_cpointer_t ecma_gc_black_cp; /**< list of root objects of the current cycle */
+  jmem_cpointer_t ecma_gc_black_end_cp; /**< last item of the ecma_gc_black_cp list */
+  jmem_cpointer_t ecma_gc_cursor_cp; /**< next object processed by the current phase */
+  jmem_cpointer_t ecma_gc_cursor_prev_cp; /**< last object kept in the ecma_gc_white_cp list by the sweep phase */
+#if JERRY_GC_GENERATIONAL
+  jmem_cpointer_t ecma_gc_old_cp; /**< first object of the old generation in the ecma_gc_objects_cp list */
+#endif /* JERRY_GC_GENERATIONAL */
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
-  jmem_cpointer_t number_list_first_cp; /**< first item of the literal number list */
-#if JERRY_BUILTIN_BIGINT
-  jmem_cpointer_t bigint_list_first_cp; /**< first item of the literal bigint list */
-#endif /* JERRY_BUILTIN_BIGINT */
+#if JERRY_OBJECT_SHAPES
+  jmem_cpointer_t ecma_root_shapes_cp; /**< first shape which has a single property */
+#endif /* JERRY_OBJECT_SHAPES */
   jmem_cpointer_t global_symbols_cp[ECMA_BUILTIN_GLOBAL_SYMBOL_COUNT]; /**< global symbols */
 
 #if JERRY_MODULE_SYSTEM
@@ -152,12 +159,22 @@ struct jerry_context_t
 #endif /* JERRY_MODULE_SYSTEM */
 
   vm_frame_ctx_t *vm_top_context_p; /**< top (current) interpreter context */
+#if JERRY_VM_STACKLESS
+  vm_call_stack_segment_t *vm_call_stack_p; /**< current segment of the vm call stack */
+  vm_call_stack_segment_t *vm_call_stack_free_p; /**< unused segment kept for the next stackless calls */
+  size_t vm_call_stack_size; /**< total size of the allocated vm call stack segments */
+#endif /* JERRY_VM_STACKLESS */
   jerry_context_data_header_t *context_data_p; /**< linked list of user-provided context-specific pointers */
   jerry_external_string_free_cb_t external_string_free_callback_p; /**< free callback for external strings */
   void *error_object_created_callback_user_p; /**< user pointer for error_object_update_callback_p */
   jerry_error_object_created_cb_t error_object_created_callback_p; /**< decorator callback for Error objects */
   size_t ecma_gc_objects_number; /**< number of currently allocated objects */
   size_t ecma_gc_new_objects; /**< number of newly allocated objects since last GC session */
+#if JERRY_GC_GENERATIONAL
+  size_t ecma_gc_promoted_objects; /**< number of objects promoted by minor collections since the last
+                                    *   full collection */
+  uint8_t *ecma_gc_young_bitmap_p; /**< bit set for each young object which is not remembered */
+#endif /* JERRY_GC_GENERATIONAL */
   size_t jmem_heap_allocated_size; /**< size of allocated regions */
   size_t jmem_heap_limit; /**< current limit of heap usage, that is upon being reached,
                            *   causes call of "try give memory back" callbacks */
@@ -169,6 +186,10 @@ struct jerry_context_t
 #if (JERRY_GC_MARK_LIMIT != 0)
   uint32_t ecma_gc_mark_recursion_limit; /**< GC mark recursion limit */
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  ecma_gc_mark_segment_t *ecma_gc_mark_segment_p; /**< current segment of the GC mark stack */
+  uint32_t ecma_gc_mark_stack_top; /**< number of objects in the current segment of the GC mark stack */
+  uint8_t ecma_gc_phase; /**< current phase of the garbage collector (ecma_gc_phase_t) */
+  bool ecma_gc_mark_stack_overflow; /**< a gray object could not be pushed onto the GC mark stack */
 
 #if JERRY_PROPERTY_HASHMAP
   uint8_t ecma_prop_hashmap_alloc_state; /**< property hashmap allocation state: 0-4,
@@ -240,6 +261,14 @@ struct jerry_context_t
   ecma_lcache_hash_entry_t lcache[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
 #endif /* JERRY_LCACHE */
 
+#if JERRY_VM_PROPERTY_CACHE
+  /** inline caches of named property accesses */
+  vm_property_cache_entry_t vm_property_cache[VM_PROPERTY_CACHE_SIZE];
+#endif /* JERRY_VM_PROPERTY_CACHE */
+
+  /** first segment of the GC mark stack, which is always available */
+  ecma_gc_mark_segment_t ecma_gc_mark_stack;
+
   /**
    * Allowed values and it's meaning:
    * * NULL (0x0): the current "new.target" is undefined, that is the execution is inside a normal method.
@@ -265,7 +294,8 @@ struct jerry_context_t
 
 struct jmem_heap_t
 {
-  jmem_heap_free_t first; /**< first node in free region list */
+  uint32_t tree_root_offset; /**< root of the tree of large free regions */
+  uint32_t bin_map; /**< bit set for each non-empty small free region bin */
   uint8_t area[]; /**< heap area */
 };
 
@@ -302,13 +332,14 @@ extern jerry_context_t jerry_global_context;
 #define JMEM_HEAP_SIZE            ((size_t) (CONFIG_MEM_HEAP_SIZE))
 
 /**
- * Calculate heap area size, leaving space for a pointer to the free list
+ * Calculate heap area size, leaving space for the free region bookkeeping
  */
 #define JMEM_HEAP_AREA_SIZE       (JMEM_HEAP_SIZE - JMEM_ALIGNMENT)
 
 struct jmem_heap_t
 {
-  jmem_heap_free_t first; /**< first node in free region list */
+  uint32_t tree_root_offset; /**< root of the tree of large free regions */
+  uint32_t bin_map; /**< bit set for each non-empty small free region bin */
   uint8_t area[JMEM_HEAP_AREA_SIZE]; /**< heap area */
 };
 
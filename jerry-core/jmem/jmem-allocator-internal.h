@@ -51,6 +51,7 @@ void jmem_heap_init (void);
 void jmem_heap_finalize (void);
 bool jmem_is_heap_pointer (const void *pointer);
 void *jmem_heap_alloc_block_internal (const size_t size);
+void *jmem_heap_alloc_block_below_limit (const size_t size);
 void jmem_heap_free_block_internal (void *ptr, const size_t size);
 
 /**
@@ -189,7 +189,7 @@ jmem_compress_pointer (const void *pointer_p) /**< pointer to compress */
 #if defined(ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY) && JERRY_CPOINTER_32_BIT
   JERRY_ASSERT (((jmem_cpointer_t) uint_ptr) == uint_ptr);
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY || !JERRY_CPOINTER_32_BIT */
-  const uintptr_t heap_start = (uintptr_t) &JERRY_HEAP_CONTEXT (first);
+  const uintptr_t heap_start = (uintptr_t) &JERRY_HEAP_CONTEXT (tree_root_offset);
 
   uint_ptr -= heap_start;
   uint_ptr >>= JMEM_ALIGNMENT_LOG;
@@ -222,7 +222,7 @@ jmem_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decompres
 #if defined(ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY) && JERRY_CPOINTER_32_BIT
   JERRY_ASSERT (uint_ptr % JMEM_ALIGNMENT == 0);
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY || !JERRY_CPOINTER_32_BIT */
-  const uintptr_t heap_start = (uintptr_t) &JERRY_HEAP_CONTEXT (first);
+  const uintptr_t heap_start = (uintptr_t) &JERRY_HEAP_CONTEXT (tree_root_offset);
 
   uint_ptr <<= JMEM_ALIGNMENT_LOG;
   uint_ptr += heap_start;
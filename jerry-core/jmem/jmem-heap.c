@@ -40,6 +40,38 @@
  */
 #define JMEM_HEAP_END_OF_LIST ((uint32_t) 0xffffffff)
 
+/**
+ * Flag of the tagged previous region offset stored in single unit regions.
+ *
+ * Note:
+ *      the size of other regions is always a multiple of JMEM_ALIGNMENT, so the flag is never set for them
+ */
+#define JMEM_HEAP_SINGLE_UNIT_FLAG ((uint32_t) 0x1)
+
+/**
+ * Maximum size of regions kept in the exact size bins, larger regions are kept in the best-fit tree.
+ */
+#define JMEM_HEAP_BIN_MAX_SIZE (JMEM_HEAP_BIN_COUNT * JMEM_ALIGNMENT)
+
+/**
+ * Number of JMEM_ALIGNMENT sized units in the heap area.
+ */
+#define JMEM_HEAP_UNIT_COUNT ((uint32_t) (JMEM_HEAP_AREA_SIZE >> JMEM_ALIGNMENT_LOG))
+
+/**
+ * Size of the boundary map at the start of the heap area.
+ *
+ * The map has one bit for each unit of the heap area, which is set for the first and last unit of free regions.
+ * Since adjacent free regions are always merged, the map tells whether the neighbours of a region are free.
+ */
+#define JMEM_HEAP_MAP_SIZE \
+  JERRY_ALIGNUP ((((size_t) JMEM_HEAP_UNIT_COUNT + 31) >> 5) * sizeof (uint32_t), JMEM_ALIGNMENT)
+
+/**
+ * Boundary map of the heap area.
+ */
+#define JMEM_HEAP_MAP ((uint32_t *) JERRY_HEAP_CONTEXT (area))
+
 /**
  * @{
  */
@@ -63,15 +95,389 @@
  */
 
 /**
- * Get end of region
+ * Get the index of the heap unit which contains the address
  *
- * @return pointer to the end of the region
+ * @return unit index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE JERRY_ATTR_PURE
+jmem_heap_get_unit (const void *addr_p) /**< address */
+{
+  return (uint32_t) (((const uint8_t *) addr_p - JERRY_HEAP_CONTEXT (area)) >> JMEM_ALIGNMENT_LOG);
+} /* jmem_heap_get_unit */
+
+/**
+ * Get the region which starts at the given heap unit
+ *
+ * @return pointer to the region
  */
 static inline jmem_heap_free_t *JERRY_ATTR_ALWAYS_INLINE JERRY_ATTR_PURE
-jmem_heap_get_region_end (jmem_heap_free_t *curr_p) /**< current region */
+jmem_heap_get_unit_region (uint32_t unit) /**< unit index */
+{
+  return (jmem_heap_free_t *) (JERRY_HEAP_CONTEXT (area) + ((size_t) unit << JMEM_ALIGNMENT_LOG));
+} /* jmem_heap_get_unit_region */
+
+/**
+ * Check whether the boundary map bit of a unit is set
+ *
+ * @return true - if the unit is the first or the last unit of a free region,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_map_test (uint32_t unit) /**< unit index */
+{
+  return ((JMEM_HEAP_MAP[unit >> 5] >> (unit & 31)) & 0x1) != 0;
+} /* jmem_heap_map_test */
+
+/**
+ * Set or clear the boundary map bits of a region
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_map_update (const jmem_heap_free_t *region_p, /**< region */
+                      uint32_t size, /**< size of the region */
+                      bool is_free) /**< true - if the region becomes free */
+{
+  const uint32_t first_unit = jmem_heap_get_unit (region_p);
+  const uint32_t last_unit = first_unit + (size >> JMEM_ALIGNMENT_LOG) - 1;
+
+  if (is_free)
+  {
+    JMEM_HEAP_MAP[first_unit >> 5] |= (uint32_t) 0x1 << (first_unit & 31);
+    JMEM_HEAP_MAP[last_unit >> 5] |= (uint32_t) 0x1 << (last_unit & 31);
+  }
+  else
+  {
+    JMEM_HEAP_MAP[first_unit >> 5] &= ~((uint32_t) 0x1 << (first_unit & 31));
+    JMEM_HEAP_MAP[last_unit >> 5] &= ~((uint32_t) 0x1 << (last_unit & 31));
+  }
+} /* jmem_heap_map_update */
+
+/**
+ * Get size of a free region
+ *
+ * @return size of the region
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_get_region_size (const jmem_heap_free_t *region_p) /**< free region */
+{
+  return (region_p->size & JMEM_HEAP_SINGLE_UNIT_FLAG) ? JMEM_ALIGNMENT : region_p->size;
+} /* jmem_heap_get_region_size */
+
+/**
+ * Get the free region which ends with the given heap unit
+ *
+ * Note:
+ *      the last unit of regions larger than a unit stores the size of the region in its second word
+ *
+ * @return pointer to the region
+ */
+static inline jmem_heap_free_t *JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_get_region_by_end (uint32_t last_unit) /**< index of the last unit of the region */
+{
+  jmem_heap_free_t *last_p = jmem_heap_get_unit_region (last_unit);
+
+  if (last_p->size & JMEM_HEAP_SINGLE_UNIT_FLAG)
+  {
+    return last_p;
+  }
+
+  return jmem_heap_get_unit_region (last_unit + 1 - (last_p->size >> JMEM_ALIGNMENT_LOG));
+} /* jmem_heap_get_region_by_end */
+
+/**
+ * Get the offset of the previous region of a bin
+ *
+ * @return offset of the previous region or JMEM_HEAP_END_OF_LIST
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_bin_get_prev (const jmem_heap_free_t *region_p, /**< region */
+                        uint32_t size) /**< size of the region */
+{
+  if (size == JMEM_ALIGNMENT)
+  {
+    return (region_p->size == JMEM_HEAP_END_OF_LIST) ? JMEM_HEAP_END_OF_LIST
+                                                      : (region_p->size & ~JMEM_HEAP_SINGLE_UNIT_FLAG);
+  }
+
+  return region_p->prev_offset;
+} /* jmem_heap_bin_get_prev */
+
+/**
+ * Set the offset of the previous region of a bin
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_bin_set_prev (jmem_heap_free_t *region_p, /**< region */
+                        uint32_t size, /**< size of the region */
+                        uint32_t prev_offset) /**< offset of the previous region or JMEM_HEAP_END_OF_LIST */
+{
+  if (size == JMEM_ALIGNMENT)
+  {
+    region_p->size = prev_offset | JMEM_HEAP_SINGLE_UNIT_FLAG;
+    return;
+  }
+
+  region_p->prev_offset = prev_offset;
+} /* jmem_heap_bin_set_prev */
+
+/**
+ * Get the heap priority of a large region in the best-fit tree
+ *
+ * @return priority
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE JERRY_ATTR_CONST
+jmem_heap_tree_priority (uint32_t offset) /**< offset of the region */
+{
+  return offset * 2654435761u;
+} /* jmem_heap_tree_priority */
+
+/**
+ * Compare two large regions of the best-fit tree by size and address
+ *
+ * @return true - if the first region precedes the second one,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_tree_is_less (const jmem_heap_free_t *left_p, /**< first region */
+                        const jmem_heap_free_t *right_p) /**< second region */
+{
+  return (left_p->size < right_p->size || (left_p->size == right_p->size && left_p < right_p));
+} /* jmem_heap_tree_is_less */
+
+/**
+ * Insert a large region into the best-fit tree
+ *
+ * Note:
+ *      the tree is a treap ordered by size and address, the priorities are derived from the address
+ */
+static void
+jmem_heap_tree_insert (jmem_heap_free_t *region_p) /**< region */
+{
+  const uint32_t offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
+  const uint32_t priority = jmem_heap_tree_priority (offset);
+  uint32_t *link_p = &JERRY_HEAP_CONTEXT (tree_root_offset);
+
+  while (*link_p != JMEM_HEAP_END_OF_LIST && jmem_heap_tree_priority (*link_p) > priority)
+  {
+    jmem_heap_free_t *node_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (*link_p);
+    link_p = jmem_heap_tree_is_less (region_p, node_p) ? &node_p->next_offset : &node_p->prev_offset;
+  }
+
+  /* Split the subtree into the two children of the new node. */
+  uint32_t subtree_offset = *link_p;
+  uint32_t *left_p = &region_p->next_offset;
+  uint32_t *right_p = &region_p->prev_offset;
+
+  *link_p = offset;
+
+  while (subtree_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    jmem_heap_free_t *node_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (subtree_offset);
+
+    if (jmem_heap_tree_is_less (node_p, region_p))
+    {
+      *left_p = subtree_offset;
+      left_p = &node_p->prev_offset;
+      subtree_offset = node_p->prev_offset;
+    }
+    else
+    {
+      *right_p = subtree_offset;
+      right_p = &node_p->next_offset;
+      subtree_offset = node_p->next_offset;
+    }
+  }
+
+  *left_p = JMEM_HEAP_END_OF_LIST;
+  *right_p = JMEM_HEAP_END_OF_LIST;
+} /* jmem_heap_tree_insert */
+
+/**
+ * Remove a large region from the best-fit tree
+ */
+static void
+jmem_heap_tree_remove (jmem_heap_free_t *region_p) /**< region */
+{
+  const uint32_t offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
+  uint32_t *link_p = &JERRY_HEAP_CONTEXT (tree_root_offset);
+
+  while (*link_p != offset)
+  {
+    JERRY_ASSERT (*link_p != JMEM_HEAP_END_OF_LIST);
+
+    jmem_heap_free_t *node_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (*link_p);
+    link_p = jmem_heap_tree_is_less (region_p, node_p) ? &node_p->next_offset : &node_p->prev_offset;
+  }
+
+  /* Merge the two children of the removed node. */
+  uint32_t left_offset = region_p->next_offset;
+  uint32_t right_offset = region_p->prev_offset;
+
+  while (left_offset != JMEM_HEAP_END_OF_LIST && right_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    if (jmem_heap_tree_priority (left_offset) > jmem_heap_tree_priority (right_offset))
+    {
+      jmem_heap_free_t *node_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (left_offset);
+      *link_p = left_offset;
+      link_p = &node_p->prev_offset;
+      left_offset = node_p->prev_offset;
+    }
+    else
+    {
+      jmem_heap_free_t *node_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (right_offset);
+      *link_p = right_offset;
+      link_p = &node_p->next_offset;
+      right_offset = node_p->next_offset;
+    }
+  }
+
+  *link_p = (left_offset != JMEM_HEAP_END_OF_LIST) ? left_offset : right_offset;
+} /* jmem_heap_tree_remove */
+
+/**
+ * Find the smallest large region which is not smaller than the required size
+ *
+ * @return pointer to the region - if found,
+ *         NULL - otherwise
+ */
+static jmem_heap_free_t *
+jmem_heap_tree_find (uint32_t required_size) /**< required size */
+{
+  jmem_heap_free_t *best_p = NULL;
+  uint32_t current_offset = JERRY_HEAP_CONTEXT (tree_root_offset);
+
+  while (current_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    jmem_heap_free_t *current_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
+
+    if (current_p->size >= required_size)
+    {
+      best_p = current_p;
+      current_offset = current_p->next_offset;
+    }
+    else
+    {
+      current_offset = current_p->prev_offset;
+    }
+  }
+
+  return best_p;
+} /* jmem_heap_tree_find */
+
+/**
+ * Find the first non-empty bin which is not below the given bin
+ *
+ * @return index of the bin - if found,
+ *         JMEM_HEAP_BIN_COUNT - otherwise
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_find_bin (uint32_t bin_index) /**< index of the first suitable bin */
 {
-  return (jmem_heap_free_t *) ((uint8_t *) curr_p + curr_p->size);
-} /* jmem_heap_get_region_end */
+  uint32_t bin_map = JERRY_HEAP_CONTEXT (bin_map) & (~(uint32_t) 0 << bin_index);
+
+  if (bin_map == 0)
+  {
+    return JMEM_HEAP_BIN_COUNT;
+  }
+
+#if defined(__GNUC__) || defined(__clang__)
+  return (uint32_t) __builtin_ctz (bin_map);
+#else /* !(defined(__GNUC__) || defined(__clang__)) */
+  while (!(bin_map & ((uint32_t) 0x1 << bin_index)))
+  {
+    bin_index++;
+  }
+
+  return bin_index;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+} /* jmem_heap_find_bin */
+
+/**
+ * Add a free region to the bins or to the best-fit tree without merging it with its neighbours
+ */
+static void
+jmem_heap_add_region (jmem_heap_free_t *region_p, /**< region */
+                      uint32_t size) /**< size of the region */
+{
+  JERRY_ASSERT ((uintptr_t) region_p % JMEM_ALIGNMENT == 0);
+  JERRY_ASSERT (size > 0 && size % JMEM_ALIGNMENT == 0);
+
+  jmem_heap_map_update (region_p, size, true);
+
+  if (size > JMEM_ALIGNMENT)
+  {
+    uint32_t *footer_p = (uint32_t *) ((uint8_t *) region_p + size) - 1;
+    JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+    JMEM_VALGRIND_DEFINED_SPACE (footer_p, sizeof (uint32_t));
+
+    region_p->size = size;
+    *footer_p = size;
+
+    if (size > JMEM_HEAP_BIN_MAX_SIZE)
+    {
+      jmem_heap_tree_insert (region_p);
+      return;
+    }
+  }
+  else
+  {
+    JMEM_VALGRIND_DEFINED_SPACE (region_p, JMEM_ALIGNMENT);
+  }
+
+  const uint32_t bin_index = (size >> JMEM_ALIGNMENT_LOG) - 1;
+  const uint32_t head_offset = JERRY_CONTEXT (jmem_heap_bins)[bin_index];
+  const uint32_t offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
+
+  region_p->next_offset = head_offset;
+  jmem_heap_bin_set_prev (region_p, size, JMEM_HEAP_END_OF_LIST);
+
+  if (head_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    jmem_heap_bin_set_prev (JMEM_HEAP_GET_ADDR_FROM_OFFSET (head_offset), size, offset);
+  }
+
+  JERRY_CONTEXT (jmem_heap_bins)[bin_index] = offset;
+  JERRY_HEAP_CONTEXT (bin_map) |= (uint32_t) 0x1 << bin_index;
+} /* jmem_heap_add_region */
+
+/**
+ * Remove a free region from the bins or from the best-fit tree
+ */
+static void
+jmem_heap_remove_region (jmem_heap_free_t *region_p, /**< region */
+                         uint32_t size) /**< size of the region */
+{
+  JERRY_ASSERT (jmem_heap_get_region_size (region_p) == size);
+
+  jmem_heap_map_update (region_p, size, false);
+
+  if (size > JMEM_HEAP_BIN_MAX_SIZE)
+  {
+    jmem_heap_tree_remove (region_p);
+    return;
+  }
+
+  const uint32_t bin_index = (size >> JMEM_ALIGNMENT_LOG) - 1;
+  const uint32_t prev_offset = jmem_heap_bin_get_prev (region_p, size);
+  const uint32_t next_offset = region_p->next_offset;
+
+  if (prev_offset == JMEM_HEAP_END_OF_LIST)
+  {
+    JERRY_CONTEXT (jmem_heap_bins)[bin_index] = next_offset;
+
+    if (next_offset == JMEM_HEAP_END_OF_LIST)
+    {
+      JERRY_HEAP_CONTEXT (bin_map) &= ~((uint32_t) 0x1 << bin_index);
+    }
+  }
+  else
+  {
+    JMEM_HEAP_GET_ADDR_FROM_OFFSET (prev_offset)->next_offset = next_offset;
+  }
+
+  if (next_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    jmem_heap_bin_set_prev (JMEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset), size, prev_offset);
+  }
+} /* jmem_heap_remove_region */
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 
 /**
@@ -86,21 +492,24 @@ jmem_heap_init (void)
   JERRY_ASSERT (((UINT16_MAX + 1) << JMEM_ALIGNMENT_LOG) >= JMEM_HEAP_SIZE);
 #endif /* !JERRY_CPOINTER_32_BIT */
   JERRY_ASSERT ((uintptr_t) JERRY_HEAP_CONTEXT (area) % JMEM_ALIGNMENT == 0);
+  JERRY_ASSERT (JMEM_HEAP_AREA_SIZE % JMEM_ALIGNMENT == 0);
 
   JERRY_CONTEXT (jmem_heap_limit) = CONFIG_GC_LIMIT;
 
-  jmem_heap_free_t *const region_p = (jmem_heap_free_t *) JERRY_HEAP_CONTEXT (area);
-
-  region_p->size = JMEM_HEAP_AREA_SIZE;
-  region_p->next_offset = JMEM_HEAP_END_OF_LIST;
+  JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_AREA_SIZE);
+  JMEM_VALGRIND_DEFINED_SPACE (JMEM_HEAP_MAP, JMEM_HEAP_MAP_SIZE);
+  memset (JMEM_HEAP_MAP, 0, JMEM_HEAP_MAP_SIZE);
 
-  JERRY_HEAP_CONTEXT (first).size = 0;
-  JERRY_HEAP_CONTEXT (first).next_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (region_p);
+  for (uint32_t i = 0; i < JMEM_HEAP_BIN_COUNT; i++)
+  {
+    JERRY_CONTEXT (jmem_heap_bins)[i] = JMEM_HEAP_END_OF_LIST;
+  }
 
-  JERRY_CONTEXT (jmem_heap_list_skip_p) = &JERRY_HEAP_CONTEXT (first);
+  JERRY_HEAP_CONTEXT (bin_map) = 0;
+  JERRY_HEAP_CONTEXT (tree_root_offset) = JMEM_HEAP_END_OF_LIST;
 
-  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
-  JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_AREA_SIZE);
+  jmem_heap_add_region ((jmem_heap_free_t *) (JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_MAP_SIZE),
+                        (uint32_t) (JMEM_HEAP_AREA_SIZE - JMEM_HEAP_MAP_SIZE));
 
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
   JMEM_HEAP_STAT_INIT ();
@@ -114,13 +523,16 @@ jmem_heap_finalize (void)
 {
   JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == 0);
 #if !JERRY_SYSTEM_ALLOCATOR
-  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), JMEM_HEAP_SIZE);
+  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (tree_root_offset), JMEM_HEAP_SIZE);
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 } /* jmem_heap_finalize */
 
 /**
  * Allocation of memory region.
  *
+ * Small requests are served from the smallest non-empty exact size bin which fits, other requests
+ * from the best-fit tree. The unused end of the chosen region is returned to the free regions.
+ *
  * See also:
  *          jmem_heap_alloc_block
  *
@@ -134,118 +546,53 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
   /* Align size. */
   const size_t required_size = ((size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT) * JMEM_ALIGNMENT;
   jmem_heap_free_t *data_space_p = NULL;
+  uint32_t region_size = 0;
 
-  JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
-
-  /* Fast path for 8 byte chunks, first region is guaranteed to be sufficient. */
-  if (required_size == JMEM_ALIGNMENT && JERRY_LIKELY (JERRY_HEAP_CONTEXT (first).next_offset != JMEM_HEAP_END_OF_LIST))
+  if (required_size <= JMEM_HEAP_BIN_MAX_SIZE)
   {
-    data_space_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (JERRY_HEAP_CONTEXT (first).next_offset);
-    JERRY_ASSERT (jmem_is_heap_pointer (data_space_p));
-
-    JMEM_VALGRIND_DEFINED_SPACE (data_space_p, sizeof (jmem_heap_free_t));
-    JERRY_CONTEXT (jmem_heap_allocated_size) += JMEM_ALIGNMENT;
+    const uint32_t bin_index = jmem_heap_find_bin ((uint32_t) (required_size >> JMEM_ALIGNMENT_LOG) - 1);
 
-    if (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+    if (bin_index < JMEM_HEAP_BIN_COUNT)
     {
-      JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+      data_space_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (JERRY_CONTEXT (jmem_heap_bins)[bin_index]);
+      region_size = (bin_index + 1) << JMEM_ALIGNMENT_LOG;
     }
+  }
 
-    if (data_space_p->size == JMEM_ALIGNMENT)
-    {
-      JERRY_HEAP_CONTEXT (first).next_offset = data_space_p->next_offset;
-    }
-    else
+  if (data_space_p == NULL)
+  {
+    if (JERRY_UNLIKELY (required_size > JMEM_HEAP_AREA_SIZE))
     {
-      JERRY_ASSERT (data_space_p->size > JMEM_ALIGNMENT);
-
-      jmem_heap_free_t *remaining_p;
-      remaining_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (JERRY_HEAP_CONTEXT (first).next_offset) + 1;
-
-      JMEM_VALGRIND_DEFINED_SPACE (remaining_p, sizeof (jmem_heap_free_t));
-      remaining_p->size = data_space_p->size - JMEM_ALIGNMENT;
-      remaining_p->next_offset = data_space_p->next_offset;
-      JMEM_VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (jmem_heap_free_t));
-
-      JERRY_HEAP_CONTEXT (first).next_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
+      return NULL;
     }
 
-    JMEM_VALGRIND_NOACCESS_SPACE (data_space_p, sizeof (jmem_heap_free_t));
+    data_space_p = jmem_heap_tree_find ((uint32_t) required_size);
 
-    if (JERRY_UNLIKELY (data_space_p == JERRY_CONTEXT (jmem_heap_list_skip_p)))
+    if (JERRY_UNLIKELY (data_space_p == NULL))
     {
-      JERRY_CONTEXT (jmem_heap_list_skip_p) = JMEM_HEAP_GET_ADDR_FROM_OFFSET (JERRY_HEAP_CONTEXT (first).next_offset);
+      return NULL;
     }
+
+    region_size = data_space_p->size;
   }
-  /* Slow path for larger regions. */
-  else
-  {
-    uint32_t current_offset = JERRY_HEAP_CONTEXT (first).next_offset;
-    jmem_heap_free_t *prev_p = &JERRY_HEAP_CONTEXT (first);
 
-    while (JERRY_LIKELY (current_offset != JMEM_HEAP_END_OF_LIST))
-    {
-      jmem_heap_free_t *current_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
-      JERRY_ASSERT (jmem_is_heap_pointer (current_p));
-      JMEM_VALGRIND_DEFINED_SPACE (current_p, sizeof (jmem_heap_free_t));
+  JERRY_ASSERT (jmem_is_heap_pointer (data_space_p));
+  jmem_heap_remove_region (data_space_p, region_size);
 
-      const uint32_t next_offset = current_p->next_offset;
-      JERRY_ASSERT (next_offset == JMEM_HEAP_END_OF_LIST
-                    || jmem_is_heap_pointer (JMEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset)));
+  if (region_size > required_size)
+  {
+    /* Region was larger than necessary. */
+    jmem_heap_add_region ((jmem_heap_free_t *) ((uint8_t *) data_space_p + required_size),
+                          region_size - (uint32_t) required_size);
+  }
 
-      if (current_p->size >= required_size)
-      {
-        /* Region is sufficiently big, store address. */
-        data_space_p = current_p;
-
-        /* Region was larger than necessary. */
-        if (current_p->size > required_size)
-        {
-          /* Get address of remaining space. */
-          jmem_heap_free_t *const remaining_p = (jmem_heap_free_t *) ((uint8_t *) current_p + required_size);
-
-          /* Update metadata. */
-          JMEM_VALGRIND_DEFINED_SPACE (remaining_p, sizeof (jmem_heap_free_t));
-          remaining_p->size = current_p->size - (uint32_t) required_size;
-          remaining_p->next_offset = next_offset;
-          JMEM_VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (jmem_heap_free_t));
-
-          /* Update list. */
-          JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
-          prev_p->next_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
-          JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
-        }
-        /* Block is an exact fit. */
-        else
-        {
-          /* Remove the region from the list. */
-          JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
-          prev_p->next_offset = next_offset;
-          JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
-        }
-
-        JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
-
-        /* Found enough space. */
-        JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
-
-        while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
-        {
-          JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
-        }
-
-        break;
-      }
+  JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
 
-      JMEM_VALGRIND_NOACCESS_SPACE (current_p, sizeof (jmem_heap_free_t));
-      /* Next in list. */
-      prev_p = current_p;
-      current_offset = next_offset;
-    }
+  while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+  {
+    JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
   }
 
-  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
-
   JERRY_ASSERT ((uintptr_t) data_space_p % JMEM_ALIGNMENT == 0);
   JMEM_VALGRIND_MALLOCLIKE_SPACE (data_space_p, size);
 
@@ -319,6 +666,54 @@ jmem_heap_alloc_block_internal (const size_t size) /**< required memory size */
   return jmem_heap_gc_and_alloc_block (size, JMEM_PRESSURE_FULL);
 } /* jmem_heap_alloc_block_internal */
 
+/**
+ * Allocation of memory block without reclaiming unused memory.
+ *
+ * Note:
+ *      The allocation also fails if the block would reach the current gc limit.
+ *
+ * @return NULL, if there is not enough memory below the gc limit
+ *         pointer to the allocated memory block, otherwise
+ */
+void *
+jmem_heap_alloc_block_below_limit (const size_t size) /**< required memory size */
+{
+  JERRY_ASSERT (size > 0);
+
+  if (JERRY_CONTEXT (jmem_heap_allocated_size) + size >= JERRY_CONTEXT (jmem_heap_limit))
+  {
+    return NULL;
+  }
+
+  return jmem_heap_alloc (size);
+} /* jmem_heap_alloc_block_below_limit */
+
+/**
+ * Allocation of memory block without reclaiming unused memory.
+ *
+ * Note:
+ *      The garbage collector uses this function to allocate memory while it is running.
+ *
+ * @return NULL, if there is not enough memory
+ *         pointer to the allocated memory block, otherwise
+ */
+void *
+jmem_heap_alloc_block_without_gc (const size_t size) /**< required memory size */
+{
+  JERRY_ASSERT (size > 0);
+
+  void *block_p = jmem_heap_alloc (size);
+
+#if JERRY_MEM_STATS
+  if (block_p != NULL)
+  {
+    JMEM_HEAP_STAT_ALLOC (size);
+  }
+#endif /* JERRY_MEM_STATS */
+
+  return block_p;
+} /* jmem_heap_alloc_block_without_gc */
+
 /**
  * Allocation of memory block, reclaiming unused memory if there is not enough.
  *
@@ -363,52 +758,10 @@ jmem_heap_alloc_block_null_on_error (const size_t size) /**< required memory siz
 
 #if !JERRY_SYSTEM_ALLOCATOR
 /**
- * Finds the block in the free block list which preceeds the argument block
- *
- * @return pointer to the preceeding block
- */
-static jmem_heap_free_t *
-jmem_heap_find_prev (const jmem_heap_free_t *const block_p) /**< which memory block's predecessor we're looking for */
-{
-  const jmem_heap_free_t *prev_p;
-
-  if (block_p > JERRY_CONTEXT (jmem_heap_list_skip_p))
-  {
-    prev_p = JERRY_CONTEXT (jmem_heap_list_skip_p);
-  }
-  else
-  {
-    prev_p = &JERRY_HEAP_CONTEXT (first);
-  }
-
-  JERRY_ASSERT (jmem_is_heap_pointer (block_p));
-  const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
-
-  JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
-  /* Find position of region in the list. */
-  while (prev_p->next_offset < block_offset)
-  {
-    const jmem_heap_free_t *const next_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
-    JERRY_ASSERT (jmem_is_heap_pointer (next_p));
-
-    JMEM_VALGRIND_DEFINED_SPACE (next_p, sizeof (jmem_heap_free_t));
-    JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
-    prev_p = next_p;
-  }
-
-  JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
-  return (jmem_heap_free_t *) prev_p;
-} /* jmem_heap_find_prev */
-
-/**
- * Inserts the block into the free chain after a specified block.
- *
- * Note:
- *     'jmem_heap_find_prev' can and should be used to find the previous free block
+ * Inserts the block into the free regions, merging it with its free neighbours.
  */
 static void
 jmem_heap_insert_block (jmem_heap_free_t *block_p, /**< block to insert */
-                        jmem_heap_free_t *prev_p, /**< the free block after which to insert 'block_p' */
                         const size_t size) /**< size of the inserted block */
 {
   JERRY_ASSERT ((uintptr_t) block_p % JMEM_ALIGNMENT == 0);
@@ -416,44 +769,33 @@ jmem_heap_insert_block (jmem_heap_free_t *block_p, /**< block to insert */
 
   JMEM_VALGRIND_NOACCESS_SPACE (block_p, size);
 
-  JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
-  jmem_heap_free_t *next_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
-  JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
-  JMEM_VALGRIND_DEFINED_SPACE (next_p, sizeof (jmem_heap_free_t));
-
-  const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+  const uint32_t first_unit = jmem_heap_get_unit (block_p);
+  const uint32_t next_unit = first_unit + (uint32_t) (size >> JMEM_ALIGNMENT_LOG);
+  uint32_t region_size = (uint32_t) size;
 
-  /* Update prev. */
-  if (jmem_heap_get_region_end (prev_p) == block_p)
+  /* The units of the boundary map itself are never marked, so the previous unit can always be checked. */
+  if (jmem_heap_map_test (first_unit - 1))
   {
-    /* Can be merged. */
-    prev_p->size += (uint32_t) size;
-    JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
+    /* Can be merged with the previous region. */
+    jmem_heap_free_t *prev_p = jmem_heap_get_region_by_end (first_unit - 1);
+    const uint32_t prev_size = jmem_heap_get_region_size (prev_p);
+
+    jmem_heap_remove_region (prev_p, prev_size);
     block_p = prev_p;
-  }
-  else
-  {
-    block_p->size = (uint32_t) size;
-    prev_p->next_offset = block_offset;
+    region_size += prev_size;
   }
 
-  /* Update next. */
-  if (jmem_heap_get_region_end (block_p) == next_p)
+  if (next_unit < JMEM_HEAP_UNIT_COUNT && jmem_heap_map_test (next_unit))
   {
-    /* Can be merged. */
-    block_p->size += next_p->size;
-    block_p->next_offset = next_p->next_offset;
-  }
-  else
-  {
-    block_p->next_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (next_p);
-  }
+    /* Can be merged with the next region. */
+    jmem_heap_free_t *next_p = jmem_heap_get_unit_region (next_unit);
+    const uint32_t next_size = jmem_heap_get_region_size (next_p);
 
-  JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
+    jmem_heap_remove_region (next_p, next_size);
+    region_size += next_size;
+  }
 
-  JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
-  JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
-  JMEM_VALGRIND_NOACCESS_SPACE (next_p, sizeof (jmem_heap_free_t));
+  jmem_heap_add_region (block_p, region_size);
 } /* jmem_heap_insert_block */
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 
@@ -477,13 +819,10 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
 
   const size_t aligned_size = (size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
 
-  jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
-  jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
-  jmem_heap_insert_block (block_p, prev_p, aligned_size);
+  JMEM_VALGRIND_FREELIKE_SPACE (ptr);
+  jmem_heap_insert_block ((jmem_heap_free_t *) ptr, aligned_size);
 
   JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
-
-  JMEM_VALGRIND_FREELIKE_SPACE (ptr);
 #else /* JERRY_SYSTEM_ALLOCATOR */
   JERRY_CONTEXT (jmem_heap_allocated_size) -= size;
   free (ptr);
@@ -530,7 +869,6 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
     JMEM_HEAP_STAT_FREE (old_size);
     JMEM_HEAP_STAT_ALLOC (new_size);
     jmem_heap_insert_block ((jmem_heap_free_t *) ((uint8_t *) block_p + aligned_new_size),
-                            jmem_heap_find_prev (block_p),
                             aligned_old_size - aligned_new_size);
 
     JERRY_CONTEXT (jmem_heap_allocated_size) -= (aligned_old_size - aligned_new_size);
@@ -554,65 +892,50 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
   ecma_gc_run ();
 #endif /* JERRY_MEM_GC_BEFORE_EACH_ALLOC */
 
-  jmem_heap_free_t *prev_p = jmem_heap_find_prev (block_p);
-  JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
-  jmem_heap_free_t *const next_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
+  const uint32_t first_unit = jmem_heap_get_unit (block_p);
+  const uint32_t next_unit = first_unit + (uint32_t) (aligned_old_size >> JMEM_ALIGNMENT_LOG);
 
   /* Check if block can be extended at the end */
-  if (((jmem_heap_free_t *) ((uint8_t *) block_p + aligned_old_size)) == next_p)
+  if (next_unit < JMEM_HEAP_UNIT_COUNT && jmem_heap_map_test (next_unit))
   {
-    JMEM_VALGRIND_DEFINED_SPACE (next_p, sizeof (jmem_heap_free_t));
+    jmem_heap_free_t *const next_p = jmem_heap_get_unit_region (next_unit);
+    const uint32_t next_size = jmem_heap_get_region_size (next_p);
 
-    if (required_size <= next_p->size)
+    if (required_size <= next_size)
     {
-      /* Block can be extended, update the list. */
-      if (required_size == next_p->size)
-      {
-        prev_p->next_offset = next_p->next_offset;
-      }
-      else
+      /* Block can be extended, update the free regions. */
+      jmem_heap_remove_region (next_p, next_size);
+
+      if (required_size < next_size)
       {
-        jmem_heap_free_t *const new_next_p = (jmem_heap_free_t *) ((uint8_t *) next_p + required_size);
-        JMEM_VALGRIND_DEFINED_SPACE (new_next_p, sizeof (jmem_heap_free_t));
-        new_next_p->next_offset = next_p->next_offset;
-        new_next_p->size = (uint32_t) (next_p->size - required_size);
-        JMEM_VALGRIND_NOACCESS_SPACE (new_next_p, sizeof (jmem_heap_free_t));
-        prev_p->next_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (new_next_p);
+        jmem_heap_add_region ((jmem_heap_free_t *) ((uint8_t *) next_p + required_size),
+                              next_size - (uint32_t) required_size);
       }
 
       /* next_p will be marked as undefined space. */
       JMEM_VALGRIND_RESIZE_SPACE (block_p, old_size, new_size);
       ret_block_p = block_p;
     }
-    else
-    {
-      JMEM_VALGRIND_NOACCESS_SPACE (next_p, sizeof (jmem_heap_free_t));
-    }
-
-    JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
   }
+
   /*
    * Check if block can be extended at the front.
    * This is less optimal because we need to copy the data, but still better than allocting a new block.
    */
-  else if (jmem_heap_get_region_end (prev_p) == block_p)
+  if (ret_block_p == NULL && jmem_heap_map_test (first_unit - 1))
   {
-    if (required_size <= prev_p->size)
+    jmem_heap_free_t *const prev_p = jmem_heap_get_region_by_end (first_unit - 1);
+    const uint32_t prev_size = jmem_heap_get_region_size (prev_p);
+
+    if (required_size <= prev_size)
     {
-      if (required_size == prev_p->size)
-      {
-        JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
-        prev_p = jmem_heap_find_prev (prev_p);
-        JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
-        prev_p->next_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (next_p);
-      }
-      else
+      jmem_heap_remove_region (prev_p, prev_size);
+
+      if (required_size < prev_size)
       {
-        prev_p->size = (uint32_t) (prev_p->size - required_size);
+        jmem_heap_add_region (prev_p, prev_size - (uint32_t) required_size);
       }
 
-      JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
-
       ret_block_p = (uint8_t *) block_p - required_size;
 
       /* Mark the the new block as undefined so that we are able to write to it. */
@@ -625,16 +948,11 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
       JMEM_VALGRIND_MALLOCLIKE_SPACE (ret_block_p, new_size);
       JMEM_VALGRIND_DEFINED_SPACE (ret_block_p, old_size);
     }
-    else
-    {
-      JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
-    }
   }
 
   if (ret_block_p != NULL)
   {
-    /* Managed to extend the block. Update memory usage and the skip pointer. */
-    JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
+    /* Managed to extend the block. Update memory usage. */
     JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
 
     while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
@@ -650,14 +968,10 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
     JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_old_size;
     ret_block_p = jmem_heap_alloc_block_internal (new_size);
 
-    /* jmem_heap_alloc_block_internal may trigger garbage collection, which can create new free blocks
-     * in the heap structure, so we need to look up the previous block again. */
-    prev_p = jmem_heap_find_prev (block_p);
-
     memcpy (ret_block_p, block_p, old_size);
-    jmem_heap_insert_block (block_p, prev_p, aligned_old_size);
     /* jmem_heap_alloc_block_internal will call JMEM_VALGRIND_MALLOCLIKE_SPACE */
     JMEM_VALGRIND_FREELIKE_SPACE (block_p);
+    jmem_heap_insert_block (block_p, aligned_old_size);
   }
 
   JMEM_HEAP_STAT_FREE (old_size);
@@ -731,6 +1045,49 @@ jmem_is_heap_pointer (const void *pointer) /**< pointer */
 #endif /* !JERRY_NDEBUG */
 
 #if JERRY_MEM_STATS
+#if !JERRY_SYSTEM_ALLOCATOR
+/**
+ * Update the fragmentation statistics by walking the free regions of the boundary map
+ */
+static void
+jmem_heap_stat_update_free_regions (jmem_heap_stats_t *heap_stats_p) /**< [out] heap stats */
+{
+  heap_stats_p->free_bytes = 0;
+  heap_stats_p->free_region_count = 0;
+  heap_stats_p->largest_free_region_bytes = 0;
+
+  uint32_t unit = (uint32_t) (JMEM_HEAP_MAP_SIZE >> JMEM_ALIGNMENT_LOG);
+
+  while (unit < JMEM_HEAP_UNIT_COUNT)
+  {
+    if ((JMEM_HEAP_MAP[unit >> 5] >> (unit & 31)) == 0)
+    {
+      /* Skip the rest of the map word. */
+      unit = (unit | 31) + 1;
+      continue;
+    }
+
+    if (!jmem_heap_map_test (unit))
+    {
+      unit++;
+      continue;
+    }
+
+    const uint32_t size = jmem_heap_get_region_size (jmem_heap_get_unit_region (unit));
+
+    heap_stats_p->free_bytes += size;
+    heap_stats_p->free_region_count++;
+
+    if (size > heap_stats_p->largest_free_region_bytes)
+    {
+      heap_stats_p->largest_free_region_bytes = size;
+    }
+
+    unit += size >> JMEM_ALIGNMENT_LOG;
+  }
+} /* jmem_heap_stat_update_free_regions */
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
+
 /**
  * Get heap memory usage statistics
  */
@@ -739,6 +1096,10 @@ jmem_heap_get_stats (jmem_heap_stats_t *out_heap_stats_p) /**< [out] heap stats
 {
   JERRY_ASSERT (out_heap_stats_p != NULL);
 
+#if !JERRY_SYSTEM_ALLOCATOR
+  jmem_heap_stat_update_free_regions (&JERRY_CONTEXT (jmem_heap_stats));
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
+
   *out_heap_stats_p = JERRY_CONTEXT (jmem_heap_stats);
 } /* jmem_heap_get_stats */
 
@@ -750,6 +1111,10 @@ jmem_heap_stats_print (void)
 {
   jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
 
+#if !JERRY_SYSTEM_ALLOCATOR
+  jmem_heap_stat_update_free_regions (heap_stats);
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
+
   JERRY_DEBUG_MSG ("Heap stats:\n");
 #if !JERRY_SYSTEM_ALLOCATOR
   JERRY_DEBUG_MSG ("  Heap size = %u bytes\n", (unsigned) heap_stats->size);
@@ -766,6 +1131,18 @@ jmem_heap_stats_print (void)
   JERRY_DEBUG_MSG ("  Peak allocated object data = %u bytes\n", (unsigned) heap_stats->peak_object_bytes);
   JERRY_DEBUG_MSG ("  Allocated property data = %u bytes\n", (unsigned) heap_stats->property_bytes);
   JERRY_DEBUG_MSG ("  Peak allocated property data = %u bytes\n", (unsigned) heap_stats->peak_property_bytes);
+#if !JERRY_SYSTEM_ALLOCATOR
+  JERRY_DEBUG_MSG ("  Free = %u bytes in %u regions\n",
+                   (unsigned) heap_stats->free_bytes,
+                   (unsigned) heap_stats->free_region_count);
+  JERRY_DEBUG_MSG ("  Largest free region = %u bytes\n", (unsigned) heap_stats->largest_free_region_bytes);
+
+  if (heap_stats->free_bytes > 0)
+  {
+    JERRY_DEBUG_MSG ("  Fragmentation = %u%%\n",
+                     (unsigned) (100 - heap_stats->largest_free_region_bytes * 100 / heap_stats->free_bytes));
+  }
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
 } /* jmem_heap_stats_print */
 
 /**
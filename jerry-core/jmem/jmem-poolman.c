@@ -35,6 +35,21 @@
  * @{
  */
 
+/**
+ * Size of the slabs which are split into chunks when a pool runs out of free chunks
+ */
+#define JMEM_POOLS_SLAB_SIZE 256
+
+/**
+ * Get the size class of a chunk
+ */
+#define JMEM_POOLS_GET_CLASS(size) ((((size) + JMEM_ALIGNMENT - 1) >> JMEM_ALIGNMENT_LOG) - 1)
+
+/**
+ * Get the chunk size of a size class
+ */
+#define JMEM_POOLS_GET_CHUNK_SIZE(class) (((size_t) (class) + 1) << JMEM_ALIGNMENT_LOG)
+
 /**
  * Finalize pool manager
  */
@@ -43,73 +58,91 @@ jmem_pools_finalize (void)
 {
   jmem_pools_collect_empty ();
 
-  JERRY_ASSERT (JERRY_CONTEXT (jmem_free_8_byte_chunk_p) == NULL);
-#if JERRY_CPOINTER_32_BIT
-  JERRY_ASSERT (JERRY_CONTEXT (jmem_free_16_byte_chunk_p) == NULL);
-#endif /* JERRY_CPOINTER_32_BIT */
+  for (size_t i = 0; i < JMEM_POOLS_CLASS_COUNT; i++)
+  {
+    JERRY_ASSERT (JERRY_CONTEXT (jmem_free_chunk_p)[i] == NULL);
+  }
 } /* jmem_pools_finalize */
 
 /**
- * Allocate a chunk of specified size
+ * Allocate a chunk when the pool of its size class is empty
  *
- * @return pointer to allocated chunk, if allocation was successful,
- *         or NULL - if not enough memory.
+ * Note:
+ *      a whole slab is allocated from the heap if it fits below the gc limit, its first chunk is
+ *      returned and the others are put onto the free list, so consecutive chunks are adjacent in memory
+ *
+ * @return pointer to allocated chunk
  */
-extern inline void *JERRY_ATTR_HOT JERRY_ATTR_ALWAYS_INLINE
-jmem_pools_alloc (size_t size) /**< size of the chunk */
+static void *JERRY_ATTR_NOINLINE
+jmem_pools_alloc_slab (size_t size_class) /**< size class of the chunk */
 {
-#if JERRY_MEM_GC_BEFORE_EACH_ALLOC
-  ecma_gc_run ();
-#endif /* JERRY_MEM_GC_BEFORE_EACH_ALLOC */
+  const size_t chunk_size = JMEM_POOLS_GET_CHUNK_SIZE (size_class);
 
-#if JERRY_CPOINTER_32_BIT
-  if (size <= 8)
+#if !JERRY_SYSTEM_ALLOCATOR
+  const size_t chunk_count = JMEM_POOLS_SLAB_SIZE / chunk_size;
+  uint8_t *slab_p = (uint8_t *) jmem_heap_alloc_block_below_limit (chunk_count * chunk_size);
+
+  if (slab_p != NULL)
   {
-#else /* !JERRY_CPOINTER_32_BIT */
-  JERRY_ASSERT (size <= 8);
-#endif /* JERRY_CPOINTER_32_BIT */
+    /* The heap does not store block sizes, so the chunks can be freed one by one later. */
+    JMEM_VALGRIND_FREELIKE_SPACE (slab_p);
 
-    if (JERRY_CONTEXT (jmem_free_8_byte_chunk_p) != NULL)
+    for (size_t i = chunk_count - 1; i > 0; i--)
     {
-      const jmem_pools_chunk_t *const chunk_p = JERRY_CONTEXT (jmem_free_8_byte_chunk_p);
+      jmem_pools_chunk_t *const chunk_p = (jmem_pools_chunk_t *) (slab_p + i * chunk_size);
 
       JMEM_VALGRIND_DEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
-      JERRY_CONTEXT (jmem_free_8_byte_chunk_p) = chunk_p->next_p;
-      JMEM_VALGRIND_UNDEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
-
-      JMEM_HEAP_STAT_ALLOC (8);
-      return (void *) chunk_p;
-    }
-    else
-    {
-      void *chunk_p = jmem_heap_alloc_block_internal (8);
-      JMEM_HEAP_STAT_ALLOC (8);
-      return chunk_p;
+      chunk_p->next_p = JERRY_CONTEXT (jmem_free_chunk_p)[size_class];
+      JMEM_VALGRIND_NOACCESS_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+      JERRY_CONTEXT (jmem_free_chunk_p)[size_class] = chunk_p;
     }
 
-#if JERRY_CPOINTER_32_BIT
+    JMEM_VALGRIND_MALLOCLIKE_SPACE (slab_p, chunk_size);
+    return slab_p;
   }
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
 
-  JERRY_ASSERT (size <= 16);
+  return jmem_heap_alloc_block_internal (chunk_size);
+} /* jmem_pools_alloc_slab */
+
+/**
+ * Allocate a chunk of specified size
+ *
+ * Note:
+ *      requests larger than JMEM_POOLS_MAX_SIZE are served by the heap
+ *
+ * @return pointer to allocated chunk, if allocation was successful,
+ *         or NULL - if not enough memory.
+ */
+extern inline void *JERRY_ATTR_HOT JERRY_ATTR_ALWAYS_INLINE
+jmem_pools_alloc (size_t size) /**< size of the chunk */
+{
+  JERRY_ASSERT (size > 0);
 
-  if (JERRY_CONTEXT (jmem_free_16_byte_chunk_p) != NULL)
+  if (JERRY_UNLIKELY (size > JMEM_POOLS_MAX_SIZE))
   {
-    const jmem_pools_chunk_t *const chunk_p = JERRY_CONTEXT (jmem_free_16_byte_chunk_p);
+    return jmem_heap_alloc_block (size);
+  }
 
+#if JERRY_MEM_GC_BEFORE_EACH_ALLOC
+  ecma_gc_run ();
+#endif /* JERRY_MEM_GC_BEFORE_EACH_ALLOC */
+
+  const size_t size_class = JMEM_POOLS_GET_CLASS (size);
+  const jmem_pools_chunk_t *const chunk_p = JERRY_CONTEXT (jmem_free_chunk_p)[size_class];
+
+  JMEM_HEAP_STAT_ALLOC (size);
+
+  if (chunk_p != NULL)
+  {
     JMEM_VALGRIND_DEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
-    JERRY_CONTEXT (jmem_free_16_byte_chunk_p) = chunk_p->next_p;
+    JERRY_CONTEXT (jmem_free_chunk_p)[size_class] = chunk_p->next_p;
     JMEM_VALGRIND_UNDEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
 
-    JMEM_HEAP_STAT_ALLOC (16);
     return (void *) chunk_p;
   }
-  else
-  {
-    void *chunk_p = jmem_heap_alloc_block_internal (16);
-    JMEM_HEAP_STAT_ALLOC (16);
-    return chunk_p;
-  }
-#endif /* JERRY_CPOINTER_32_BIT */
+
+  return jmem_pools_alloc_slab (size_class);
 } /* jmem_pools_alloc */
 
 /**
@@ -122,69 +155,51 @@ jmem_pools_free (void *chunk_p, /**< pointer to the chunk */
                  size_t size) /**< size of the chunk */
 {
   JERRY_ASSERT (chunk_p != NULL);
+
+  if (JERRY_UNLIKELY (size > JMEM_POOLS_MAX_SIZE))
+  {
+    jmem_heap_free_block (chunk_p, size);
+    return;
+  }
+
   JMEM_HEAP_STAT_FREE (size);
 
   jmem_pools_chunk_t *const chunk_to_free_p = (jmem_pools_chunk_t *) chunk_p;
+  const size_t size_class = JMEM_POOLS_GET_CLASS (size);
 
   JMEM_VALGRIND_DEFINED_SPACE (chunk_to_free_p, size);
 
-#if JERRY_CPOINTER_32_BIT
-  if (size <= 8)
-  {
-#else /* !JERRY_CPOINTER_32_BIT */
-  JERRY_ASSERT (size <= 8);
-#endif /* JERRY_CPOINTER_32_BIT */
-
-    chunk_to_free_p->next_p = JERRY_CONTEXT (jmem_free_8_byte_chunk_p);
-    JERRY_CONTEXT (jmem_free_8_byte_chunk_p) = chunk_to_free_p;
-
-#if JERRY_CPOINTER_32_BIT
-  }
-  else
-  {
-    JERRY_ASSERT (size <= 16);
-
-    chunk_to_free_p->next_p = JERRY_CONTEXT (jmem_free_16_byte_chunk_p);
-    JERRY_CONTEXT (jmem_free_16_byte_chunk_p) = chunk_to_free_p;
-  }
-#endif /* JERRY_CPOINTER_32_BIT */
+  chunk_to_free_p->next_p = JERRY_CONTEXT (jmem_free_chunk_p)[size_class];
+  JERRY_CONTEXT (jmem_free_chunk_p)[size_class] = chunk_to_free_p;
 
   JMEM_VALGRIND_NOACCESS_SPACE (chunk_to_free_p, size);
 } /* jmem_pools_free */
 
 /**
  *  Collect empty pool chunks
+ *
+ *  Note:
+ *       the chunks are returned to the heap one by one, where adjacent free chunks of a slab are merged again
  */
 void
 jmem_pools_collect_empty (void)
 {
-  jmem_pools_chunk_t *chunk_p = JERRY_CONTEXT (jmem_free_8_byte_chunk_p);
-  JERRY_CONTEXT (jmem_free_8_byte_chunk_p) = NULL;
-
-  while (chunk_p)
+  for (size_t size_class = 0; size_class < JMEM_POOLS_CLASS_COUNT; size_class++)
   {
-    JMEM_VALGRIND_DEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
-    jmem_pools_chunk_t *const next_p = chunk_p->next_p;
-    JMEM_VALGRIND_NOACCESS_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+    const size_t chunk_size = JMEM_POOLS_GET_CHUNK_SIZE (size_class);
+    jmem_pools_chunk_t *chunk_p = JERRY_CONTEXT (jmem_free_chunk_p)[size_class];
+    JERRY_CONTEXT (jmem_free_chunk_p)[size_class] = NULL;
 
-    jmem_heap_free_block_internal (chunk_p, 8);
-    chunk_p = next_p;
-  }
-
-#if JERRY_CPOINTER_32_BIT
-  chunk_p = JERRY_CONTEXT (jmem_free_16_byte_chunk_p);
-  JERRY_CONTEXT (jmem_free_16_byte_chunk_p) = NULL;
-
-  while (chunk_p)
-  {
-    JMEM_VALGRIND_DEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
-    jmem_pools_chunk_t *const next_p = chunk_p->next_p;
-    JMEM_VALGRIND_NOACCESS_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+    while (chunk_p)
+    {
+      JMEM_VALGRIND_DEFINED_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
+      jmem_pools_chunk_t *const next_p = chunk_p->next_p;
+      JMEM_VALGRIND_NOACCESS_SPACE (chunk_p, sizeof (jmem_pools_chunk_t));
 
-    jmem_heap_free_block_internal (chunk_p, 16);
-    chunk_p = next_p;
+      jmem_heap_free_block_internal (chunk_p, chunk_size);
+      chunk_p = next_p;
+    }
   }
-#endif /* JERRY_CPOINTER_32_BIT */
 } /* jmem_pools_collect_empty */
 
 /**
@@ -122,6 +122,16 @@ typedef enum
   JMEM_PRESSURE_FULL, /**< memory full */
 } jmem_pressure_t;
 
+/**
+ * Number of pool size classes, the chunk sizes are the multiples of JMEM_ALIGNMENT
+ */
+#define JMEM_POOLS_CLASS_COUNT 6
+
+/**
+ * Maximum size of pool chunks, larger requests are served by the heap
+ */
+#define JMEM_POOLS_MAX_SIZE (JMEM_POOLS_CLASS_COUNT * JMEM_ALIGNMENT)
+
 /**
  * Node for free chunk list
  */
@@ -131,12 +141,22 @@ typedef struct jmem_pools_chunk_t
 } jmem_pools_chunk_t;
 
 /**
- *  Free region node
+ * Number of exact size bins for small free regions
+ */
+#define JMEM_HEAP_BIN_COUNT 32
+
+/**
+ * Free region node
+ *
+ * Note:
+ *      regions of a single JMEM_ALIGNMENT sized unit only have the first two fields, where
+ *      the size field holds the offset of the previous region tagged with JMEM_HEAP_SINGLE_UNIT_FLAG
  */
 typedef struct
 {
-  uint32_t next_offset; /**< Offset of next region in list */
+  uint32_t next_offset; /**< Offset of next region in the bin, or left child in the large region tree */
   uint32_t size; /**< Size of region */
+  uint32_t prev_offset; /**< Offset of previous region in the bin, or right child in the large region tree */
 } jmem_heap_free_t;
 
 void jmem_init (void);
@@ -144,6 +164,7 @@ void jmem_finalize (void);
 
 void *jmem_heap_alloc_block (const size_t size);
 void *jmem_heap_alloc_block_null_on_error (const size_t size);
+void *jmem_heap_alloc_block_without_gc (const size_t size);
 void *jmem_heap_realloc_block (void *ptr, const size_t old_size, const size_t new_size);
 void jmem_heap_free_block (void *ptr, const size_t size);
 
@@ -172,6 +193,10 @@ typedef struct
 
   size_t property_bytes; /**< allocated memory for properties */
   size_t peak_property_bytes; /**< peak allocated memory for properties */
+
+  size_t free_bytes; /**< currently free bytes */
+  size_t free_region_count; /**< number of free regions */
+  size_t largest_free_region_bytes; /**< size of the largest free region */
 } jmem_heap_stats_t;
 
 void jmem_stats_allocate_byte_code_bytes (size_t property_size);
@@ -16,10 +16,20 @@
 #include "js-parser-internal.h"
 
 /* These two checks only checks the compiler, they have no effect on the code. */
+#if JERRY_NAN_BOXING
+
+JERRY_STATIC_ASSERT (sizeof (cbc_uint8_arguments_t) == 24, sizeof_cbc_uint8_arguments_t_must_be_24_byte_long);
+
+JERRY_STATIC_ASSERT (sizeof (cbc_uint16_arguments_t) == 32, sizeof_cbc_uint16_arguments_t_must_be_32_byte_long);
+
+#else /* !JERRY_NAN_BOXING */
+
 JERRY_STATIC_ASSERT (sizeof (cbc_uint8_arguments_t) == 16, sizeof_cbc_uint8_arguments_t_must_be_16_byte_long);
 
 JERRY_STATIC_ASSERT (sizeof (cbc_uint16_arguments_t) == 24, sizeof_cbc_uint16_arguments_t_must_be_24_byte_long);
 
+#endif /* JERRY_NAN_BOXING */
+
 JERRY_STATIC_ASSERT (offsetof (cbc_uint8_arguments_t, script_value) == offsetof (cbc_uint16_arguments_t, script_value),
                      script_value_in_cbc_uint8_arguments_and_cbc_uint16_arguments_must_be_in_the_same_offset);
 
@@ -27,8 +37,25 @@ JERRY_STATIC_ASSERT (offsetof (cbc_uint8_arguments_t, script_value) == offsetof
  * The reason of these two static asserts to notify the developer to increase the JERRY_SNAPSHOT_VERSION
  * whenever new bytecodes are introduced or existing ones have been deleted.
  */
-JERRY_STATIC_ASSERT (CBC_END == 238, number_of_cbc_opcodes_changed);
-JERRY_STATIC_ASSERT (CBC_EXT_END == 167, number_of_cbc_ext_opcodes_changed);
+JERRY_STATIC_ASSERT (CBC_END == 250, number_of_cbc_opcodes_changed);
+JERRY_STATIC_ASSERT (CBC_EXT_END == 191, number_of_cbc_ext_opcodes_changed);
+
+/**
+ * The relation and branch opcodes are decoded by the VM using their distance from the first group.
+ */
+JERRY_STATIC_ASSERT ((CBC_EXT_BRANCH_IF_LESS_BACKWARD & 0x3) == 1, relation_and_branch_opcodes_must_be_aligned);
+JERRY_STATIC_ASSERT (CBC_EXT_BRANCH_IF_NOT_GREATER_EQUAL_FORWARD == CBC_EXT_BRANCH_IF_LESS_BACKWARD + 7 * 4,
+                     relation_and_branch_opcodes_must_be_in_groups_of_four);
+JERRY_STATIC_ASSERT (CBC_GREATER_EQUAL_TWO_LITERALS == CBC_LESS_TWO_LITERALS + 3 * 3,
+                     relation_opcodes_must_be_in_the_same_order_as_relation_and_branch_opcodes);
+
+/**
+ * The quickened opcodes are decoded by the VM using their distance from the first group.
+ */
+JERRY_STATIC_ASSERT (CBC_SUBTRACT == CBC_ADD + 3 && CBC_MULTIPLY == CBC_ADD + 2 * 3,
+                     arithmetic_opcodes_must_be_in_groups_of_three);
+JERRY_STATIC_ASSERT (CBC_MULTIPLY_TWO_LITERALS_DOUBLE == CBC_ADD_RIGHT_LITERAL_INT + 2 * 4 + 3,
+                     quickened_arithmetic_opcodes_must_be_in_groups_of_four);
 
 /** \addtogroup parser Parser
  * @{
@@ -94,6 +94,20 @@
               1,                                                                                \
               (VM_OC_##group) | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_STACK)
 
+/* The byte code generator never emits quickened opcodes: the VM rewrites the literal
+ * forms of a binary operation to these opcodes after observing the operand types. */
+#define CBC_QUICKENED_OPERATION(name)                                                          \
+  CBC_OPCODE (name##_RIGHT_LITERAL_INT, CBC_HAS_LITERAL_ARG, 0, VM_OC_QUICKENED_ARITHMETIC)    \
+  CBC_OPCODE (name##_TWO_LITERALS_INT,                                                         \
+              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2,                                      \
+              1,                                                                               \
+              VM_OC_QUICKENED_ARITHMETIC)                                                      \
+  CBC_OPCODE (name##_RIGHT_LITERAL_DOUBLE, CBC_HAS_LITERAL_ARG, 0, VM_OC_QUICKENED_ARITHMETIC) \
+  CBC_OPCODE (name##_TWO_LITERALS_DOUBLE,                                                      \
+              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2,                                      \
+              1,                                                                               \
+              VM_OC_QUICKENED_ARITHMETIC)
+
 #define CBC_UNARY_LVALUE_OPERATION(name, group)                                                            \
   CBC_OPCODE (name, CBC_NO_FLAG, -2, (VM_OC_PROP_##group) | VM_OC_GET_STACK_STACK | VM_OC_PUT_REFERENCE)   \
   CBC_OPCODE (name##_PUSH_RESULT,                                                                          \
@@ -169,6 +183,34 @@
   CBC_OPCODE (name##_2, CBC_HAS_BRANCH_ARG, stack, (vm_oc) | VM_OC_GET_BRANCH | VM_OC_BACKWARD_BRANCH) \
   CBC_OPCODE (name##_3, CBC_HAS_BRANCH_ARG, stack, (vm_oc) | VM_OC_GET_BRANCH | VM_OC_BACKWARD_BRANCH)
 
+#define CBC_FORWARD_BRANCH_TWO_LITERALS(name, stack, vm_oc)                                          \
+  CBC_OPCODE (name,                                                                                  \
+              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2 | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, \
+              stack,                                                                                 \
+              (vm_oc) | VM_OC_GET_LITERAL_LITERAL)                                                   \
+  CBC_OPCODE (name##_2,                                                                              \
+              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2 | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, \
+              stack,                                                                                 \
+              (vm_oc) | VM_OC_GET_LITERAL_LITERAL)                                                   \
+  CBC_OPCODE (name##_3,                                                                              \
+              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2 | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, \
+              stack,                                                                                 \
+              (vm_oc) | VM_OC_GET_LITERAL_LITERAL)
+
+#define CBC_BACKWARD_BRANCH_TWO_LITERALS(name, stack, vm_oc)                   \
+  CBC_OPCODE (name,                                                           \
+              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2 | CBC_HAS_BRANCH_ARG, \
+              stack,                                                          \
+              (vm_oc) | VM_OC_GET_LITERAL_LITERAL | VM_OC_BACKWARD_BRANCH)    \
+  CBC_OPCODE (name##_2,                                                       \
+              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2 | CBC_HAS_BRANCH_ARG, \
+              stack,                                                          \
+              (vm_oc) | VM_OC_GET_LITERAL_LITERAL | VM_OC_BACKWARD_BRANCH)    \
+  CBC_OPCODE (name##_3,                                                       \
+              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2 | CBC_HAS_BRANCH_ARG, \
+              stack,                                                          \
+              (vm_oc) | VM_OC_GET_LITERAL_LITERAL | VM_OC_BACKWARD_BRANCH)
+
 #define CBC_BRANCH_OFFSET_LENGTH(opcode) ((opcode) &0x3)
 
 #define CBC_BRANCH_IS_BACKWARD(flags) (!((flags) &CBC_FORWARD_BRANCH_ARG))
@@ -454,6 +496,11 @@
               0,                                                                                                    \
               VM_OC_ASSIGN_LET_CONST | VM_OC_GET_LITERAL)                                                           \
                                                                                                                     \
+  /* Quickened arithmetic opcodes. */                                                                               \
+  CBC_QUICKENED_OPERATION (CBC_ADD)                                                                                 \
+  CBC_QUICKENED_OPERATION (CBC_SUBTRACT)                                                                            \
+  CBC_QUICKENED_OPERATION (CBC_MULTIPLY)                                                                            \
+                                                                                                                    \
   /* Last opcode (not a real opcode). */                                                                            \
   CBC_OPCODE (CBC_END, CBC_NO_FLAG, 0, VM_OC_NONE)
 
@@ -498,15 +545,26 @@
   CBC_OPCODE (CBC_EXT_ERROR, CBC_NO_FLAG, 0, VM_OC_ERROR)                                                              \
   CBC_FORWARD_BRANCH (CBC_EXT_BRANCH_IF_NULLISH, -1, VM_OC_BRANCH_IF_NULLISH)                                          \
                                                                                                                        \
-  /* Basic opcodes. */                                                                                                 \
+  /* Relation and branch opcodes created by the byte code optimizer. Note: these eight groups                          \
+   * must be in this order, and the relations must follow the order of CBC_LESS ... CBC_GREATER_EQUAL. */              \
   CBC_OPCODE (CBC_EXT_POP_REFERENCE, CBC_NO_FLAG, -2, VM_OC_POP_REFERENCE)                                             \
+  CBC_BACKWARD_BRANCH_TWO_LITERALS (CBC_EXT_BRANCH_IF_LESS_BACKWARD, 0, VM_OC_BRANCH_IF_RELATION)                      \
   CBC_OPCODE (CBC_EXT_CREATE_ARGUMENTS, CBC_HAS_LITERAL_ARG, 0, VM_OC_CREATE_ARGUMENTS)                                \
+  CBC_BACKWARD_BRANCH_TWO_LITERALS (CBC_EXT_BRANCH_IF_GREATER_BACKWARD, 0, VM_OC_BRANCH_IF_RELATION)                   \
   CBC_OPCODE (CBC_EXT_CREATE_VAR_EVAL, CBC_HAS_LITERAL_ARG, 0, VM_OC_EXT_VAR_EVAL)                                     \
+  CBC_BACKWARD_BRANCH_TWO_LITERALS (CBC_EXT_BRANCH_IF_LESS_EQUAL_BACKWARD, 0, VM_OC_BRANCH_IF_RELATION)                \
   CBC_OPCODE (CBC_EXT_CREATE_VAR_FUNC_EVAL, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, VM_OC_EXT_VAR_EVAL)         \
+  CBC_BACKWARD_BRANCH_TWO_LITERALS (CBC_EXT_BRANCH_IF_GREATER_EQUAL_BACKWARD, 0, VM_OC_BRANCH_IF_RELATION)             \
   CBC_OPCODE (CBC_EXT_COPY_FROM_ARG, CBC_HAS_LITERAL_ARG, 0, VM_OC_COPY_FROM_ARG)                                      \
+  CBC_FORWARD_BRANCH_TWO_LITERALS (CBC_EXT_BRANCH_IF_NOT_LESS_FORWARD, 0, VM_OC_BRANCH_IF_RELATION)                    \
   CBC_OPCODE (CBC_EXT_PUSH_REST_OBJECT, CBC_NO_FLAG, 1, VM_OC_PUSH_REST_OBJECT)                                        \
+  CBC_FORWARD_BRANCH_TWO_LITERALS (CBC_EXT_BRANCH_IF_NOT_GREATER_FORWARD, 0, VM_OC_BRANCH_IF_RELATION)                 \
   CBC_OPCODE (CBC_EXT_MODULE_IMPORT, CBC_NO_FLAG, 0, VM_OC_MODULE_IMPORT)                                              \
+  CBC_FORWARD_BRANCH_TWO_LITERALS (CBC_EXT_BRANCH_IF_NOT_LESS_EQUAL_FORWARD, 0, VM_OC_BRANCH_IF_RELATION)              \
   CBC_OPCODE (CBC_EXT_MODULE_IMPORT_META, CBC_NO_FLAG, 1, VM_OC_MODULE_IMPORT_META)                                    \
+  CBC_FORWARD_BRANCH_TWO_LITERALS (CBC_EXT_BRANCH_IF_NOT_GREATER_EQUAL_FORWARD, 0, VM_OC_BRANCH_IF_RELATION)           \
+                                                                                                                       \
+  /* Basic opcodes. */                                                                                                 \
   CBC_OPCODE (CBC_EXT_STRING_CONCAT, CBC_NO_FLAG, -1, VM_OC_STRING_CONCAT | VM_OC_GET_STACK_STACK | VM_OC_PUT_STACK)   \
   CBC_OPCODE (CBC_EXT_STRING_CONCAT_RIGHT_LITERAL,                                                                     \
               CBC_HAS_LITERAL_ARG,                                                                                     \
@@ -816,6 +874,31 @@ typedef struct
   uint16_t padding; /**< an unused value */
 } cbc_uint16_arguments_t;
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Compiled code of a function which body is compiled by its first call.
+ *
+ * Note: the optional fields of the function (extended info and name)
+ *       follow this structure in the same way as the byte code.
+ */
+typedef struct
+{
+  cbc_uint8_arguments_t header; /**< compiled code arguments */
+  ecma_value_t compiled_code; /**< byte code of the function after the first call */
+  uint32_t arguments_start; /**< start offset of the argument list in the source code */
+  uint32_t arguments_end; /**< end offset of the argument list in the source code */
+  uint32_t body_start; /**< start offset of the function body in the source code */
+  uint32_t body_end; /**< end offset of the function body in the source code */
+  uint32_t arguments_line; /**< line of the argument list start */
+  uint32_t arguments_column; /**< column of the argument list start */
+  uint32_t body_line; /**< line of the function body start */
+  uint32_t body_column; /**< column of the function body start */
+  uint32_t parse_opts; /**< ecma_parse_opts_t options inherited by the function body */
+} cbc_lazy_function_t;
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * Compact byte code status flags.
  */
@@ -832,6 +915,9 @@ typedef enum
   CBC_CODE_FLAGS_STATIC_FUNCTION = (1u << 8), /**< this function is a static snapshot function */
   CBC_CODE_FLAGS_DEBUGGER_IGNORE = (1u << 9), /**< this function should be ignored by debugger */
   CBC_CODE_FLAGS_LEXICAL_BLOCK_NEEDED = (1u << 10), /**< compiled code needs a lexical block */
+#if JERRY_LAZY_FUNCTIONS
+  CBC_CODE_FLAGS_LAZY_FUNCTION = (1u << 11), /**< compiled code data is cbc_lazy_function_t */
+#endif /* JERRY_LAZY_FUNCTIONS */
 
   /* Bits from bit 12 is reserved for function types (see CBC_FUNCTION_TYPE_SHIFT).
    * Note: the last bits are used for type flags because < and >= operators can be used to
@@ -981,9 +1067,9 @@ typedef struct
 #if JERRY_SOURCE_NAME
   ecma_value_t source_name; /**< source name */
 #endif /* JERRY_SOURCE_NAME */
-#if JERRY_FUNCTION_TO_STRING
+#if JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS
   ecma_value_t source_code; /**< source code */
-#endif /* JERRY_FUNCTION_TO_STRING */
+#endif /* JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS */
 } cbc_script_t;
 
 /**
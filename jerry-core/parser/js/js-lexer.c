@@ -3554,6 +3554,25 @@ lexer_compare_literal_to_string (parser_context_t *context_p, /**< context */
 void
 lexer_init_line_info (parser_context_t *context_p) /**< context */
 {
+#if JERRY_LAZY_FUNCTIONS
+  if (context_p->lazy_function_p != NULL)
+  {
+    cbc_lazy_function_t *lazy_function_p = context_p->lazy_function_p;
+
+    if (context_p->source_p == context_p->source_start_p)
+    {
+      context_p->line = lazy_function_p->body_line;
+      context_p->column = lazy_function_p->body_column;
+    }
+    else
+    {
+      context_p->line = lazy_function_p->arguments_line;
+      context_p->column = lazy_function_p->arguments_column;
+    }
+    return;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   context_p->line = 1;
   context_p->column = 1;
 
@@ -244,6 +244,12 @@ typedef struct
 
 #define PARSER_CBC_UNAVAILABLE CBC_EXT_OPCODE
 
+/**
+ * Marks a byte of the byte code stream which is removed by the optimizer.
+ * This value is never used as an opcode.
+ */
+#define PARSER_CBC_REMOVED_BYTE 0xff
+
 #define PARSER_TO_EXT_OPCODE(opcode)   ((uint16_t) ((opcode) + 256))
 #define PARSER_GET_EXT_OPCODE(opcode)  ((opcode) -256)
 #define PARSER_IS_BASIC_OPCODE(opcode) ((opcode) < 256)
@@ -616,6 +622,11 @@ typedef struct
   const uint8_t *function_start_p; /**< start position of the function which will be parsed */
   const uint8_t *function_end_p; /**< end position of the current function */
 #endif /* JERRY_FUNCTION_TO_STRING */
+
+#if JERRY_LAZY_FUNCTIONS
+  const uint8_t *script_source_start_p; /**< start of the whole script source */
+  cbc_lazy_function_t *lazy_function_p; /**< function whose body is compiled (lazy compilation only) */
+#endif /* JERRY_LAZY_FUNCTIONS */
 } parser_context_t;
 
 /**
@@ -822,6 +833,10 @@ void scanner_create_variables (parser_context_t *context_p, uint32_t option_flag
 
 void scanner_get_location (scanner_location_t *location_p, parser_context_t *context_p);
 void scanner_set_location (parser_context_t *context_p, scanner_location_t *location_p);
+#if JERRY_LAZY_FUNCTIONS
+bool scanner_get_function_end_location (parser_context_t *context_p, scanner_location_t *location_p);
+void scanner_release_function_body (parser_context_t *context_p, const uint8_t *end_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
 uint16_t scanner_decode_map_to (parser_scope_stack_t *stack_item_p);
 uint16_t scanner_save_literal (parser_context_t *context_p, uint16_t ident_index);
 bool scanner_literal_is_const_reg (parser_context_t *context_p, uint16_t literal_index);
@@ -878,6 +893,15 @@ void parser_line_info_append (parser_context_t *context_p, parser_line_counter_t
 uint8_t *parser_line_info_generate (parser_context_t *context_p);
 #endif /* JERRY_LINE_INFO */
 
+/**
+ * @}
+ *
+ * \addtogroup jsparser_optimizer Byte code optimizer
+ * @{
+ */
+
+void parser_optimize_byte_code (parser_context_t *context_p);
+
 /**
  * @}
  *
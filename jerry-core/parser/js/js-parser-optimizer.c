@@ -0,0 +1,1090 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "ecma-literal-storage.h"
+
+#include "js-parser-internal.h"
+#include "opcodes.h"
+
+/** \addtogroup parser Parser
+ * @{
+ *
+ * \addtogroup jsparser JavaScript
+ * @{
+ *
+ * \addtogroup jsparser_optimizer Byte code optimizer
+ * @{
+ */
+
+#if JERRY_PARSER
+
+/*
+ * The optimizer rewrites the byte code stream before the post processing
+ * assigns the final literal indicies and branch offsets. At this point
+ * each literal argument is a two byte long (little endian) literal pool
+ * index or register index, and forward branches are always encoded with
+ * PARSER_MAX_BRANCH_LENGTH bytes.
+ *
+ * The optimizer never grows the stream: the bytes of the removed
+ * instructions are replaced by PARSER_CBC_REMOVED_BYTE, which are
+ * skipped by the post processing. Branches which target removed bytes
+ * continue at the next instruction.
+ */
+
+/**
+ * Byte code buffer of the optimizer.
+ */
+typedef struct
+{
+  uint8_t *byte_code_p; /**< flat copy of the byte code stream */
+  uint8_t *targets_p; /**< bit set of the branch targets */
+  size_t size; /**< size of the byte code */
+} parser_optimizer_t;
+
+/**
+ * Set a bit in a bit set.
+ */
+#define PARSER_OPTIMIZER_SET_BIT(bits_p, index) ((bits_p)[(index) >> 3] |= (uint8_t) (1u << ((index) &0x7)))
+
+/**
+ * Get a bit from a bit set.
+ */
+#define PARSER_OPTIMIZER_GET_BIT(bits_p, index) (((bits_p)[(index) >> 3] >> ((index) &0x7)) & 0x1)
+
+/**
+ * Read a literal argument of an instruction.
+ */
+#define PARSER_OPTIMIZER_GET_LITERAL(byte_code_p) ((uint16_t) ((byte_code_p)[0] | ((byte_code_p)[1] << 8)))
+
+/**
+ * Checks whether the opcode is a binary arithmetic or bitwise operation which can be folded.
+ */
+#define PARSER_OPTIMIZER_IS_FOLDABLE(opcode)                              \
+  (((opcode) >= CBC_BIT_OR && (opcode) <= CBC_BIT_AND_TWO_LITERALS) \
+   || ((opcode) >= CBC_LEFT_SHIFT && (opcode) <= CBC_EXPONENTIATION_TWO_LITERALS))
+
+/**
+ * Copy the byte code between the stream and the flat buffer.
+ */
+static void
+parser_optimizer_copy_stream (parser_context_t *context_p, /**< context */
+                              uint8_t *byte_code_p, /**< flat buffer */
+                              bool to_stream) /**< copy direction */
+{
+  parser_mem_page_t *page_p = context_p->byte_code.first_p;
+  size_t size = context_p->byte_code_size;
+
+  while (size > 0)
+  {
+    size_t length = JERRY_MIN (size, PARSER_CBC_STREAM_PAGE_SIZE);
+
+    if (to_stream)
+    {
+      memcpy (page_p->bytes, byte_code_p, length);
+    }
+    else
+    {
+      memcpy (byte_code_p, page_p->bytes, length);
+    }
+
+    byte_code_p += length;
+    size -= length;
+    page_p = page_p->next_p;
+  }
+} /* parser_optimizer_copy_stream */
+
+/**
+ * Get the flags of an instruction.
+ *
+ * @return byte code flags
+ */
+static uint8_t
+parser_optimizer_get_flags (const uint8_t *byte_code_p) /**< instruction */
+{
+  if (byte_code_p[0] == CBC_EXT_OPCODE)
+  {
+    return cbc_ext_flags[byte_code_p[1]];
+  }
+
+  return cbc_flags[byte_code_p[0]];
+} /* parser_optimizer_get_flags */
+
+/**
+ * Get the length of an instruction.
+ *
+ * @return instruction length
+ */
+static size_t
+parser_optimizer_get_length (const uint8_t *byte_code_p) /**< instruction */
+{
+  uint8_t flags = parser_optimizer_get_flags (byte_code_p);
+  uint8_t opcode = byte_code_p[0];
+  size_t length = 1;
+
+  if (opcode == CBC_EXT_OPCODE)
+  {
+    opcode = byte_code_p[1];
+    length++;
+  }
+
+  if (flags & CBC_HAS_LITERAL_ARG2)
+  {
+    length += (flags & CBC_HAS_LITERAL_ARG) ? 4 : 6;
+  }
+  else if (flags & CBC_HAS_LITERAL_ARG)
+  {
+    length += 2;
+  }
+
+  if (flags & CBC_HAS_BYTE_ARG)
+  {
+    length++;
+  }
+
+  if (flags & CBC_HAS_BRANCH_ARG)
+  {
+    length += CBC_BRANCH_OFFSET_LENGTH (opcode);
+  }
+
+  return length;
+} /* parser_optimizer_get_length */
+
+/**
+ * Skip the removed bytes starting from an offset.
+ *
+ * @return offset of the next instruction
+ */
+static size_t
+parser_optimizer_skip_removed (parser_optimizer_t *optimizer_p, /**< optimizer */
+                               size_t offset) /**< start offset */
+{
+  while (offset < optimizer_p->size && optimizer_p->byte_code_p[offset] == PARSER_CBC_REMOVED_BYTE)
+  {
+    offset++;
+  }
+
+  return offset;
+} /* parser_optimizer_skip_removed */
+
+/**
+ * Decode the offset of a branch instruction.
+ *
+ * @return branch offset
+ */
+static size_t
+parser_optimizer_get_branch_offset (const uint8_t *byte_code_p, /**< branch argument */
+                                    size_t length) /**< length of the branch argument */
+{
+  size_t offset = 0;
+
+  do
+  {
+    offset = (offset << 8) | *byte_code_p++;
+  } while (--length > 0);
+
+  return offset;
+} /* parser_optimizer_get_branch_offset */
+
+/**
+ * Encode the offset of a branch instruction.
+ */
+static void
+parser_optimizer_set_branch_offset (uint8_t *byte_code_p, /**< branch argument */
+                                    size_t length, /**< length of the branch argument */
+                                    size_t offset) /**< branch offset */
+{
+  byte_code_p += length;
+
+  do
+  {
+    *(--byte_code_p) = (uint8_t) (offset & 0xff);
+    offset >>= 8;
+  } while (--length > 0);
+} /* parser_optimizer_set_branch_offset */
+
+/**
+ * Collect the targets of all branch instructions.
+ */
+static void
+parser_optimizer_find_targets (parser_optimizer_t *optimizer_p) /**< optimizer */
+{
+  uint8_t *byte_code_p = optimizer_p->byte_code_p;
+  size_t offset = 0;
+
+  memset (optimizer_p->targets_p, 0, (optimizer_p->size + 8) >> 3);
+
+  while (offset < optimizer_p->size)
+  {
+    if (byte_code_p[offset] == PARSER_CBC_REMOVED_BYTE)
+    {
+      offset++;
+      continue;
+    }
+
+    uint8_t flags = parser_optimizer_get_flags (byte_code_p + offset);
+    size_t length = parser_optimizer_get_length (byte_code_p + offset);
+
+    if (flags & CBC_HAS_BRANCH_ARG)
+    {
+      uint8_t opcode = byte_code_p[offset];
+
+      if (opcode == CBC_EXT_OPCODE)
+      {
+        opcode = byte_code_p[offset + 1];
+      }
+
+      size_t branch_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
+      size_t branch_offset = parser_optimizer_get_branch_offset (byte_code_p + offset + length - branch_length,
+                                                                 branch_length);
+
+      if (CBC_BRANCH_IS_FORWARD (flags))
+      {
+        JERRY_ASSERT (offset + branch_offset <= optimizer_p->size);
+        PARSER_OPTIMIZER_SET_BIT (optimizer_p->targets_p, offset + branch_offset);
+      }
+      else
+      {
+        JERRY_ASSERT (branch_offset <= offset);
+        PARSER_OPTIMIZER_SET_BIT (optimizer_p->targets_p, offset - branch_offset);
+      }
+    }
+
+    offset += length;
+  }
+} /* parser_optimizer_find_targets */
+
+/**
+ * Checks whether any byte in the (start, end) range is a branch target.
+ *
+ * @return true - if there is a branch target in the range
+ *         false - otherwise
+ */
+static bool
+parser_optimizer_has_target (parser_optimizer_t *optimizer_p, /**< optimizer */
+                             size_t start, /**< start offset (excluded) */
+                             size_t end) /**< end offset (excluded) */
+{
+  for (size_t offset = start + 1; offset < end; offset++)
+  {
+    if (PARSER_OPTIMIZER_GET_BIT (optimizer_p->targets_p, offset))
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* parser_optimizer_has_target */
+
+/**
+ * Get the value of a number literal.
+ *
+ * @return true - if the literal is a number
+ *         false - otherwise
+ */
+static bool
+parser_optimizer_get_literal_number (parser_context_t *context_p, /**< context */
+                                     uint16_t literal_index, /**< literal index */
+                                     ecma_number_t *number_p) /**< [out] number value */
+{
+  if (literal_index >= PARSER_REGISTER_START)
+  {
+    return false;
+  }
+
+  lexer_literal_t *literal_p = PARSER_GET_LITERAL (literal_index);
+
+  /* BigInt values are number literals as well. */
+  if (literal_p->type != LEXER_NUMBER_LITERAL || !ecma_is_value_number (literal_p->u.value))
+  {
+    return false;
+  }
+
+  *number_p = ecma_get_number_from_value (literal_p->u.value);
+  return true;
+} /* parser_optimizer_get_literal_number */
+
+/**
+ * Decode the numbers pushed by an instruction.
+ *
+ * @return number of pushed numbers (0, 1 or 2)
+ */
+static uint32_t
+parser_optimizer_get_pushed_numbers (parser_context_t *context_p, /**< context */
+                                     const uint8_t *byte_code_p, /**< instruction */
+                                     ecma_number_t *numbers_p) /**< [out] pushed numbers */
+{
+  switch (byte_code_p[0])
+  {
+    case CBC_PUSH_NUMBER_0:
+    {
+      numbers_p[0] = 0;
+      return 1;
+    }
+    case CBC_PUSH_NUMBER_POS_BYTE:
+    {
+      numbers_p[0] = (ecma_number_t) byte_code_p[1] + 1;
+      return 1;
+    }
+    case CBC_PUSH_NUMBER_NEG_BYTE:
+    {
+      numbers_p[0] = -((ecma_number_t) byte_code_p[1] + 1);
+      return 1;
+    }
+    case CBC_PUSH_LITERAL:
+    {
+      return parser_optimizer_get_literal_number (context_p,
+                                                  PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + 1),
+                                                  numbers_p) ? 1 : 0;
+    }
+    case CBC_PUSH_TWO_LITERALS:
+    {
+      if (parser_optimizer_get_literal_number (context_p, PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + 1), numbers_p)
+          && parser_optimizer_get_literal_number (context_p,
+                                                  PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + 3),
+                                                  numbers_p + 1))
+      {
+        return 2;
+      }
+      return 0;
+    }
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_0:
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_POS_BYTE:
+    case CBC_PUSH_LITERAL_PUSH_NUMBER_NEG_BYTE:
+    {
+      if (!parser_optimizer_get_literal_number (context_p, PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + 1), numbers_p))
+      {
+        return 0;
+      }
+
+      if (byte_code_p[0] == CBC_PUSH_LITERAL_PUSH_NUMBER_0)
+      {
+        numbers_p[1] = 0;
+      }
+      else if (byte_code_p[0] == CBC_PUSH_LITERAL_PUSH_NUMBER_POS_BYTE)
+      {
+        numbers_p[1] = (ecma_number_t) byte_code_p[3] + 1;
+      }
+      else
+      {
+        numbers_p[1] = -((ecma_number_t) byte_code_p[3] + 1);
+      }
+      return 2;
+    }
+    default:
+    {
+      return 0;
+    }
+  }
+} /* parser_optimizer_get_pushed_numbers */
+
+/**
+ * Compute the result of a foldable binary operation.
+ *
+ * @return result of the operation
+ */
+static ecma_number_t
+parser_optimizer_compute (uint8_t opcode, /**< stack only form of the operation */
+                          ecma_number_t left_number, /**< left operand */
+                          ecma_number_t right_number) /**< right operand */
+{
+  ecma_value_t left_value = ecma_make_number_value (left_number);
+  ecma_value_t right_value = ecma_make_number_value (right_number);
+  ecma_value_t result;
+
+  switch (opcode)
+  {
+    case CBC_BIT_OR:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR, left_value, right_value);
+      break;
+    }
+    case CBC_BIT_XOR:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR, left_value, right_value);
+      break;
+    }
+    case CBC_BIT_AND:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND, left_value, right_value);
+      break;
+    }
+    case CBC_LEFT_SHIFT:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT, left_value, right_value);
+      break;
+    }
+    case CBC_RIGHT_SHIFT:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT, left_value, right_value);
+      break;
+    }
+    case CBC_UNS_RIGHT_SHIFT:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT, left_value, right_value);
+      break;
+    }
+    case CBC_ADD:
+    {
+      result = ecma_make_number_value (left_number + right_number);
+      break;
+    }
+    case CBC_SUBTRACT:
+    {
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_SUBTRACTION, left_value, right_value);
+      break;
+    }
+    case CBC_MULTIPLY:
+    {
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION, left_value, right_value);
+      break;
+    }
+    case CBC_DIVIDE:
+    {
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION, left_value, right_value);
+      break;
+    }
+    case CBC_MODULO:
+    {
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_REMAINDER, left_value, right_value);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (opcode == CBC_EXPONENTIATION);
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_EXPONENTIATION, left_value, right_value);
+      break;
+    }
+  }
+
+  JERRY_ASSERT (ecma_is_value_number (result));
+
+  ecma_number_t number = ecma_get_number_from_value (result);
+
+  ecma_free_value (result);
+  ecma_free_value (right_value);
+  ecma_free_value (left_value);
+  return number;
+} /* parser_optimizer_compute */
+
+/**
+ * Replace an instruction sequence with an instruction which pushes a number.
+ *
+ * @return true - if the sequence is replaced
+ *         false - otherwise
+ */
+static bool
+parser_optimizer_emit_number (parser_context_t *context_p, /**< context */
+                              uint8_t *byte_code_p, /**< start of the sequence */
+                              size_t length, /**< length of the sequence */
+                              ecma_number_t number) /**< pushed number */
+{
+  JERRY_ASSERT (length >= 3);
+
+  size_t new_length;
+
+  if (!ecma_number_is_nan (number) && !ecma_number_is_zero (number) && number >= -CBC_PUSH_NUMBER_BYTE_RANGE_END
+      && number <= CBC_PUSH_NUMBER_BYTE_RANGE_END && number == (ecma_number_t) (int32_t) number)
+  {
+    int32_t value = (int32_t) number;
+
+    byte_code_p[0] = (value > 0) ? CBC_PUSH_NUMBER_POS_BYTE : CBC_PUSH_NUMBER_NEG_BYTE;
+    byte_code_p[1] = (uint8_t) (((value > 0) ? value : -value) - 1);
+    new_length = 2;
+  }
+  else if (ecma_number_is_zero (number) && !ecma_number_is_negative (number))
+  {
+    byte_code_p[0] = CBC_PUSH_NUMBER_0;
+    new_length = 1;
+  }
+  else
+  {
+    ecma_value_t lit_value = ecma_find_or_create_literal_number (number);
+    parser_list_iterator_t literal_iterator;
+    lexer_literal_t *literal_p;
+    uint32_t literal_index = 0;
+
+    parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+
+    while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
+    {
+      if (literal_p->type == LEXER_NUMBER_LITERAL && literal_p->u.value == lit_value)
+      {
+        break;
+      }
+
+      literal_index++;
+    }
+
+    if (literal_p == NULL)
+    {
+      JERRY_ASSERT (literal_index == context_p->literal_count);
+
+      if (literal_index >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+      {
+        return false;
+      }
+
+      literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
+      literal_p->u.value = lit_value;
+      literal_p->prop.length = 0; /* Unused. */
+      literal_p->type = LEXER_NUMBER_LITERAL;
+      literal_p->status_flags = 0;
+
+      context_p->literal_count++;
+    }
+
+    byte_code_p[0] = CBC_PUSH_LITERAL;
+    byte_code_p[1] = (uint8_t) (literal_index & 0xff);
+    byte_code_p[2] = (uint8_t) (literal_index >> 8);
+    new_length = 3;
+  }
+
+  memset (byte_code_p + new_length, PARSER_CBC_REMOVED_BYTE, length - new_length);
+  return true;
+} /* parser_optimizer_emit_number */
+
+/**
+ * Fold a binary operation on number constants starting at the given offset.
+ *
+ * @return true - if the operation is folded
+ *         false - otherwise
+ */
+static bool
+parser_optimizer_fold_constants (parser_context_t *context_p, /**< context */
+                                 parser_optimizer_t *optimizer_p, /**< optimizer */
+                                 size_t offset) /**< instruction offset */
+{
+  uint8_t *byte_code_p = optimizer_p->byte_code_p;
+  /* The second decoded instruction may push two numbers as well. */
+  ecma_number_t numbers[3];
+  uint8_t opcode = byte_code_p[offset];
+  size_t end;
+
+  if (PARSER_OPTIMIZER_IS_FOLDABLE (opcode) && cbc_flags[opcode] == (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
+  {
+    /* Operation with two literal arguments. */
+    if (!parser_optimizer_get_literal_number (context_p,
+                                              PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + offset + 1),
+                                              numbers)
+        || !parser_optimizer_get_literal_number (context_p,
+                                                 PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + offset + 3),
+                                                 numbers + 1))
+    {
+      return false;
+    }
+
+    end = offset + 5;
+    opcode = (uint8_t) (opcode - 2);
+  }
+  else
+  {
+    uint32_t count = parser_optimizer_get_pushed_numbers (context_p, byte_code_p + offset, numbers);
+
+    if (count == 0)
+    {
+      return false;
+    }
+
+    end = parser_optimizer_skip_removed (optimizer_p, offset + parser_optimizer_get_length (byte_code_p + offset));
+
+    if (end >= optimizer_p->size)
+    {
+      return false;
+    }
+
+    opcode = byte_code_p[end];
+
+    if (count == 1)
+    {
+      if (PARSER_OPTIMIZER_IS_FOLDABLE (opcode) && cbc_flags[opcode] == CBC_HAS_LITERAL_ARG)
+      {
+        /* Pushed number followed by an operation with a right literal argument. */
+        if (!parser_optimizer_get_literal_number (context_p,
+                                                  PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + end + 1),
+                                                  numbers + 1))
+        {
+          return false;
+        }
+
+        end += 3;
+        opcode = (uint8_t) (opcode - 1);
+      }
+      else if (parser_optimizer_get_pushed_numbers (context_p, byte_code_p + end, numbers + 1) == 1)
+      {
+        /* Two pushed numbers followed by an operation. */
+        end = parser_optimizer_skip_removed (optimizer_p, end + parser_optimizer_get_length (byte_code_p + end));
+
+        if (end >= optimizer_p->size)
+        {
+          return false;
+        }
+
+        opcode = byte_code_p[end];
+
+        if (!PARSER_OPTIMIZER_IS_FOLDABLE (opcode) || cbc_flags[opcode] != CBC_NO_FLAG)
+        {
+          return false;
+        }
+
+        end++;
+      }
+      else
+      {
+        return false;
+      }
+    }
+    else
+    {
+      if (!PARSER_OPTIMIZER_IS_FOLDABLE (opcode) || cbc_flags[opcode] != CBC_NO_FLAG)
+      {
+        return false;
+      }
+
+      end++;
+    }
+  }
+
+  if (parser_optimizer_has_target (optimizer_p, offset, end))
+  {
+    return false;
+  }
+
+  ecma_number_t result = parser_optimizer_compute (opcode, numbers[0], numbers[1]);
+
+  return parser_optimizer_emit_number (context_p, byte_code_p + offset, end - offset, result);
+} /* parser_optimizer_fold_constants */
+
+/**
+ * Checks whether the source of a literal to register assignment can be read without side effects.
+ *
+ * @return true - if reading the source has no side effects
+ *         false - otherwise
+ */
+static bool
+parser_optimizer_is_pure_literal (parser_context_t *context_p, /**< context */
+                                  uint16_t literal_index) /**< literal index */
+{
+  /* Reading an identifier may throw a reference error. */
+  return (literal_index >= PARSER_REGISTER_START || PARSER_GET_LITERAL (literal_index)->type != LEXER_IDENT_LITERAL);
+} /* parser_optimizer_is_pure_literal */
+
+/**
+ * Remove the stores into registers which are never read.
+ *
+ * @return true - if any store is removed
+ *         false - otherwise
+ */
+static bool
+parser_optimizer_remove_dead_stores (parser_context_t *context_p, /**< context */
+                                     parser_optimizer_t *optimizer_p) /**< optimizer */
+{
+  uint8_t *byte_code_p = optimizer_p->byte_code_p;
+  uint8_t used_registers[(PARSER_MAXIMUM_NUMBER_OF_REGISTERS + 7) >> 3];
+  size_t offset = 0;
+  bool has_dead_store = false;
+
+  JERRY_ASSERT (context_p->register_count <= PARSER_MAXIMUM_NUMBER_OF_REGISTERS);
+
+  memset (used_registers, 0, sizeof (used_registers));
+
+  /* First phase: collect the registers which are read. Every literal argument
+   * is a read except the target of the assignments handled below. */
+  while (offset < optimizer_p->size)
+  {
+    uint8_t opcode = byte_code_p[offset];
+
+    if (opcode == PARSER_CBC_REMOVED_BYTE)
+    {
+      offset++;
+      continue;
+    }
+
+    uint8_t flags = parser_optimizer_get_flags (byte_code_p + offset);
+    size_t length = parser_optimizer_get_length (byte_code_p + offset);
+    size_t literal_offset = offset + ((opcode == CBC_EXT_OPCODE) ? 2 : 1);
+    size_t literal_count = 0;
+
+    if (flags & CBC_HAS_LITERAL_ARG2)
+    {
+      literal_count = (flags & CBC_HAS_LITERAL_ARG) ? 2 : 3;
+    }
+    else if (flags & CBC_HAS_LITERAL_ARG)
+    {
+      literal_count = 1;
+    }
+
+    if (opcode == CBC_ASSIGN_SET_IDENT || opcode == CBC_ASSIGN_SET_IDENT_PUSH_RESULT
+        || opcode == CBC_ASSIGN_LITERAL_SET_IDENT || opcode == CBC_ASSIGN_LITERAL_SET_IDENT_PUSH_RESULT)
+    {
+      literal_count--;
+    }
+
+    while (literal_count > 0)
+    {
+      uint16_t literal_index = PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + literal_offset);
+
+      if (literal_index >= PARSER_REGISTER_START)
+      {
+        literal_index = (uint16_t) (literal_index - PARSER_REGISTER_START);
+        JERRY_ASSERT (literal_index < PARSER_MAXIMUM_NUMBER_OF_REGISTERS);
+        PARSER_OPTIMIZER_SET_BIT (used_registers, literal_index);
+      }
+
+      literal_offset += 2;
+      literal_count--;
+    }
+
+    offset += length;
+  }
+
+  /* Second phase: remove the stores into the unused registers. */
+  offset = 0;
+
+  while (offset < optimizer_p->size)
+  {
+    uint8_t opcode = byte_code_p[offset];
+
+    if (opcode == PARSER_CBC_REMOVED_BYTE)
+    {
+      offset++;
+      continue;
+    }
+
+    size_t length = parser_optimizer_get_length (byte_code_p + offset);
+    uint16_t literal_index;
+
+    switch (opcode)
+    {
+      case CBC_ASSIGN_SET_IDENT:
+      case CBC_ASSIGN_SET_IDENT_PUSH_RESULT:
+      {
+        literal_index = PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + offset + 1);
+        break;
+      }
+      case CBC_ASSIGN_LITERAL_SET_IDENT:
+      case CBC_ASSIGN_LITERAL_SET_IDENT_PUSH_RESULT:
+      {
+        literal_index = PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + offset + 3);
+        break;
+      }
+      default:
+      {
+        offset += length;
+        continue;
+      }
+    }
+
+    if (literal_index < PARSER_REGISTER_START
+        || PARSER_OPTIMIZER_GET_BIT (used_registers, literal_index - PARSER_REGISTER_START))
+    {
+      offset += length;
+      continue;
+    }
+
+    switch (opcode)
+    {
+      case CBC_ASSIGN_SET_IDENT:
+      {
+        /* The assigned value is still dropped from the stack. */
+        byte_code_p[offset] = CBC_POP;
+        memset (byte_code_p + offset + 1, PARSER_CBC_REMOVED_BYTE, length - 1);
+        has_dead_store = true;
+        break;
+      }
+      case CBC_ASSIGN_SET_IDENT_PUSH_RESULT:
+      {
+        memset (byte_code_p + offset, PARSER_CBC_REMOVED_BYTE, length);
+        has_dead_store = true;
+        break;
+      }
+      case CBC_ASSIGN_LITERAL_SET_IDENT:
+      {
+        if (parser_optimizer_is_pure_literal (context_p, PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + offset + 1)))
+        {
+          memset (byte_code_p + offset, PARSER_CBC_REMOVED_BYTE, length);
+          has_dead_store = true;
+        }
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (opcode == CBC_ASSIGN_LITERAL_SET_IDENT_PUSH_RESULT);
+
+        /* The assigned value is still pushed onto the stack. */
+        byte_code_p[offset] = CBC_PUSH_LITERAL;
+        memset (byte_code_p + offset + 3, PARSER_CBC_REMOVED_BYTE, length - 3);
+        has_dead_store = true;
+        break;
+      }
+    }
+
+    offset += length;
+  }
+
+  return has_dead_store;
+} /* parser_optimizer_remove_dead_stores */
+
+/**
+ * Checks whether the opcode is a forward branch which can be redirected.
+ *
+ * @return true - if the branch can be redirected
+ *         false - otherwise
+ */
+static bool
+parser_optimizer_is_simple_forward_branch (uint8_t opcode) /**< opcode */
+{
+  switch (opcode)
+  {
+    case CBC_JUMP_FORWARD + PARSER_MAX_BRANCH_LENGTH - 1:
+    case CBC_BRANCH_IF_TRUE_FORWARD + PARSER_MAX_BRANCH_LENGTH - 1:
+    case CBC_BRANCH_IF_FALSE_FORWARD + PARSER_MAX_BRANCH_LENGTH - 1:
+    case CBC_BRANCH_IF_LOGICAL_TRUE + PARSER_MAX_BRANCH_LENGTH - 1:
+    case CBC_BRANCH_IF_LOGICAL_FALSE + PARSER_MAX_BRANCH_LENGTH - 1:
+    case CBC_BRANCH_IF_STRICT_EQUAL + PARSER_MAX_BRANCH_LENGTH - 1:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* parser_optimizer_is_simple_forward_branch */
+
+/**
+ * Redirect the forward branches which target unconditional jumps
+ * to the final target and remove the jumps to the next instruction.
+ */
+static void
+parser_optimizer_thread_jumps (parser_optimizer_t *optimizer_p) /**< optimizer */
+{
+  const uint8_t jump_opcode = CBC_JUMP_FORWARD + PARSER_MAX_BRANCH_LENGTH - 1;
+  const size_t jump_length = PARSER_MAX_BRANCH_LENGTH + 1;
+  uint8_t *byte_code_p = optimizer_p->byte_code_p;
+  size_t offset = 0;
+
+  while (offset < optimizer_p->size)
+  {
+    uint8_t opcode = byte_code_p[offset];
+
+    if (opcode == PARSER_CBC_REMOVED_BYTE)
+    {
+      offset++;
+      continue;
+    }
+
+    size_t length = parser_optimizer_get_length (byte_code_p + offset);
+
+    if (!parser_optimizer_is_simple_forward_branch (opcode))
+    {
+      offset += length;
+      continue;
+    }
+
+    JERRY_ASSERT (length == jump_length);
+
+    size_t target = offset + parser_optimizer_get_branch_offset (byte_code_p + offset + 1, PARSER_MAX_BRANCH_LENGTH);
+    size_t next = parser_optimizer_skip_removed (optimizer_p, target);
+
+    while (next < optimizer_p->size && byte_code_p[next] == jump_opcode)
+    {
+      target = next + parser_optimizer_get_branch_offset (byte_code_p + next + 1, PARSER_MAX_BRANCH_LENGTH);
+      next = parser_optimizer_skip_removed (optimizer_p, target);
+    }
+
+    if (opcode == jump_opcode && parser_optimizer_skip_removed (optimizer_p, offset + jump_length) >= next)
+    {
+      /* Jumps to the next instruction are effectively NOPs. */
+      memset (byte_code_p + offset, PARSER_CBC_REMOVED_BYTE, jump_length);
+    }
+    else
+    {
+      parser_optimizer_set_branch_offset (byte_code_p + offset + 1, PARSER_MAX_BRANCH_LENGTH, target - offset);
+    }
+
+    offset += length;
+  }
+} /* parser_optimizer_thread_jumps */
+
+/**
+ * Fuse a relational operation on two literals and the following conditional
+ * branch into a single relation and branch instruction.
+ */
+static void
+parser_optimizer_fuse_relation (parser_optimizer_t *optimizer_p, /**< optimizer */
+                                size_t offset) /**< instruction offset */
+{
+  uint8_t *byte_code_p = optimizer_p->byte_code_p + offset;
+  uint8_t opcode = byte_code_p[0];
+
+  if (opcode < CBC_LESS_TWO_LITERALS || opcode > CBC_GREATER_EQUAL_TWO_LITERALS
+      || (opcode - CBC_LESS_TWO_LITERALS) % 3 != 0 || offset + 5 >= optimizer_p->size
+      || PARSER_OPTIMIZER_GET_BIT (optimizer_p->targets_p, offset + 5))
+  {
+    return;
+  }
+
+  uint32_t relation = (uint32_t) (opcode - CBC_LESS_TWO_LITERALS) / 3;
+  uint8_t branch_opcode = byte_code_p[5];
+  uint16_t left_index = PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + 1);
+  uint16_t right_index = PARSER_OPTIMIZER_GET_LITERAL (byte_code_p + 3);
+
+  if (branch_opcode == CBC_BRANCH_IF_FALSE_FORWARD + PARSER_MAX_BRANCH_LENGTH - 1)
+  {
+    size_t branch_offset = parser_optimizer_get_branch_offset (byte_code_p + 6, PARSER_MAX_BRANCH_LENGTH) + 5;
+
+    if (branch_offset >= ((size_t) 1 << (PARSER_MAX_BRANCH_LENGTH * 8)))
+    {
+      return;
+    }
+
+    byte_code_p[0] = CBC_EXT_OPCODE;
+    byte_code_p[1] = (uint8_t) (CBC_EXT_BRANCH_IF_NOT_LESS_FORWARD + relation * 4 + PARSER_MAX_BRANCH_LENGTH - 1);
+    parser_optimizer_set_branch_offset (byte_code_p + 6, PARSER_MAX_BRANCH_LENGTH, branch_offset);
+  }
+  else if (branch_opcode >= CBC_BRANCH_IF_TRUE_BACKWARD && branch_opcode <= CBC_BRANCH_IF_TRUE_BACKWARD_3)
+  {
+    size_t branch_length = CBC_BRANCH_OFFSET_LENGTH (branch_opcode);
+    size_t branch_offset = parser_optimizer_get_branch_offset (byte_code_p + 6, branch_length);
+
+    if (branch_offset < 5)
+    {
+      return;
+    }
+
+    branch_offset -= 5;
+
+    /* Backward branches use the shortest encoding. */
+    size_t new_length = 1;
+
+    while (new_length < branch_length && (branch_offset >> (new_length * 8)) != 0)
+    {
+      new_length++;
+    }
+
+    byte_code_p[0] = CBC_EXT_OPCODE;
+    byte_code_p[1] = (uint8_t) (CBC_EXT_BRANCH_IF_LESS_BACKWARD + relation * 4 + new_length - 1);
+    parser_optimizer_set_branch_offset (byte_code_p + 6, new_length, branch_offset);
+
+    if (new_length < branch_length)
+    {
+      memset (byte_code_p + 6 + new_length, PARSER_CBC_REMOVED_BYTE, branch_length - new_length);
+    }
+  }
+  else
+  {
+    return;
+  }
+
+  byte_code_p[2] = (uint8_t) (left_index & 0xff);
+  byte_code_p[3] = (uint8_t) (left_index >> 8);
+  byte_code_p[4] = (uint8_t) (right_index & 0xff);
+  byte_code_p[5] = (uint8_t) (right_index >> 8);
+} /* parser_optimizer_fuse_relation */
+
+/**
+ * Optimize the byte code stream before post processing.
+ *
+ * The following transformations are performed:
+ *  - folding of arithmetic and bitwise operations on number constants
+ *  - removal of stores into registers which are never read (functions only)
+ *  - redirection of branches to unconditional jumps
+ *  - fusion of relational operations and conditional branches
+ */
+void
+parser_optimize_byte_code (parser_context_t *context_p) /**< context */
+{
+  parser_optimizer_t optimizer;
+  size_t size = context_p->byte_code_size;
+
+  if (size == 0)
+  {
+    return;
+  }
+
+  JERRY_ASSERT (context_p->u.allocated_buffer_p == NULL);
+
+  uint32_t buffer_size = (uint32_t) (size + ((size + 8) >> 3));
+  uint8_t *buffer_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (buffer_size);
+
+  if (buffer_p == NULL)
+  {
+    /* The optimizer is optional, the byte code is unchanged. */
+    return;
+  }
+
+  /* The buffer is freed by the error handler if an error is thrown. */
+  context_p->u.allocated_buffer_p = buffer_p;
+  context_p->allocated_buffer_size = buffer_size;
+
+  optimizer.byte_code_p = buffer_p;
+  optimizer.targets_p = buffer_p + size;
+  optimizer.size = size;
+
+  parser_optimizer_copy_stream (context_p, optimizer.byte_code_p, false);
+  parser_optimizer_find_targets (&optimizer);
+
+  size_t offset = 0;
+
+  while (offset < size)
+  {
+    if (buffer_p[offset] == PARSER_CBC_REMOVED_BYTE)
+    {
+      offset++;
+      continue;
+    }
+
+    if (!parser_optimizer_fold_constants (context_p, &optimizer, offset))
+    {
+      offset += parser_optimizer_get_length (buffer_p + offset);
+    }
+  }
+
+  if (context_p->status_flags & PARSER_IS_FUNCTION)
+  {
+    while (parser_optimizer_remove_dead_stores (context_p, &optimizer))
+    {
+    }
+  }
+
+  parser_optimizer_thread_jumps (&optimizer);
+  parser_optimizer_find_targets (&optimizer);
+
+  offset = 0;
+
+  while (offset < size)
+  {
+    if (buffer_p[offset] == PARSER_CBC_REMOVED_BYTE)
+    {
+      offset++;
+      continue;
+    }
+
+    parser_optimizer_fuse_relation (&optimizer, offset);
+    offset += parser_optimizer_get_length (buffer_p + offset);
+  }
+
+  parser_optimizer_copy_stream (context_p, optimizer.byte_code_p, true);
+  parser_free_allocated_buffer (context_p);
+} /* parser_optimize_byte_code */
+
+#endif /* JERRY_PARSER */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
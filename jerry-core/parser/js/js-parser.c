@@ -46,6 +46,20 @@ JERRY_STATIC_ASSERT (PARSER_RESTORE_STATUS_FLAGS (ECMA_PARSE_ALLOW_SUPER) == PAR
 JERRY_STATIC_ASSERT (PARSER_RESTORE_STATUS_FLAGS (ECMA_PARSE_FUNCTION_CONTEXT) == 0,
                      ecma_parse_function_context_must_not_be_transformed);
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Source code descriptor of a lazy function body.
+ */
+typedef struct
+{
+  parser_source_char_t source; /**< function body, must be the first member */
+  const uint8_t *script_source_p; /**< start of the script source code */
+  cbc_lazy_function_t *function_p; /**< lazy function */
+} parser_lazy_source_t;
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * Compute real literal indicies.
  *
@@ -360,7 +374,8 @@ parser_update_backward_branch (parser_mem_page_t *page_p, /**< current page */
  */
 static void
 parse_update_branches (parser_context_t *context_p, /**< context */
-                       uint8_t *byte_code_p) /**< byte code */
+                       uint8_t *byte_code_p, /**< byte code */
+                       uint16_t literal_one_byte_limit) /**< maximum value of single byte literal indicies */
 {
   parser_mem_page_t *page_p = context_p->byte_code.first_p;
   parser_mem_page_t *prev_page_p = NULL;
@@ -407,6 +422,15 @@ parse_update_branches (parser_context_t *context_p, /**< context */
       branch_argument_length = CBC_BRANCH_OFFSET_LENGTH (*bytes_p);
       bytes_p++;
 
+      if (JERRY_UNLIKELY (flags & CBC_HAS_LITERAL_ARG))
+      {
+        /* Only the relation and branch opcodes have literal arguments. */
+        JERRY_ASSERT (flags & CBC_HAS_LITERAL_ARG2);
+
+        bytes_p += (*bytes_p > literal_one_byte_limit) ? 2 : 1;
+        bytes_p += (*bytes_p > literal_one_byte_limit) ? 2 : 1;
+      }
+
       /* Decoding target. */
       length = branch_argument_length;
       target_distance = 0;
@@ -671,6 +695,11 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   }
 #endif /* JERRY_DEBUGGER */
 
+  if (context_p->global_status_flags & ECMA_PARSE_INTERNAL_OPTIMIZE_BYTE_CODE)
+  {
+    parser_optimize_byte_code (context_p);
+  }
+
   parser_compute_indicies (context_p, &ident_end, &const_literal_end);
 
   if (context_p->literal_count <= CBC_MAXIMUM_SMALL_VALUE)
@@ -702,6 +731,13 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     size_t branch_offset_length;
 
     opcode_p = page_p->bytes + offset;
+
+    if (*opcode_p == PARSER_CBC_REMOVED_BYTE)
+    {
+      PARSER_NEXT_BYTE (page_p, offset);
+      continue;
+    }
+
     last_opcode = (cbc_opcode_t) (*opcode_p);
     PARSER_NEXT_BYTE (page_p, offset);
     branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (last_opcode);
@@ -791,13 +827,15 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
       if (flags & CBC_HAS_LITERAL_ARG2)
       {
+        /* The other argument flags are kept, since branch
+         * arguments may follow the literal arguments. */
         if (flags & CBC_HAS_LITERAL_ARG)
         {
-          flags = CBC_HAS_LITERAL_ARG;
+          flags = (uint8_t) (flags & ~CBC_HAS_LITERAL_ARG2);
         }
         else
         {
-          flags = CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2;
+          flags = (uint8_t) (flags | CBC_HAS_LITERAL_ARG);
         }
       }
       else
@@ -912,6 +950,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     total_size += ecma_extended_info_get_encoded_length (context_p->argument_length);
   }
 #if JERRY_FUNCTION_TO_STRING
+  uint32_t source_range_start = 0;
+  uint32_t source_range_size = 0;
+
   if (context_p->last_context_p != NULL)
   {
     extended_info |= CBC_EXTENDED_CODE_FLAGS_HAS_SOURCE_CODE_RANGE;
@@ -928,8 +969,37 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       extended_info |= CBC_EXTENDED_CODE_FLAGS_SOURCE_CODE_IN_ARGUMENTS;
     }
 
-    total_size += ecma_extended_info_get_encoded_length ((uint32_t) (function_start_p - start_p));
-    total_size += ecma_extended_info_get_encoded_length ((uint32_t) (context_p->function_end_p - function_start_p));
+#if JERRY_LAZY_FUNCTIONS
+    if (context_p->lazy_function_p != NULL)
+    {
+      /* The body of a lazy function is a part of the script source. */
+      JERRY_ASSERT (!(extended_info & CBC_EXTENDED_CODE_FLAGS_SOURCE_CODE_IN_ARGUMENTS));
+      start_p = context_p->script_source_start_p;
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+    source_range_start = (uint32_t) (function_start_p - start_p);
+    source_range_size = (uint32_t) (context_p->function_end_p - function_start_p);
+  }
+#if JERRY_LAZY_FUNCTIONS
+  else if (context_p->lazy_function_p != NULL)
+  {
+    /* The compiled code inherits the source code range of the lazy function. */
+    uint8_t *lazy_extended_info_p =
+      ecma_compiled_code_resolve_extended_info ((ecma_compiled_code_t *) context_p->lazy_function_p);
+
+    JERRY_ASSERT (*lazy_extended_info_p == CBC_EXTENDED_CODE_FLAGS_HAS_SOURCE_CODE_RANGE);
+
+    extended_info |= CBC_EXTENDED_CODE_FLAGS_HAS_SOURCE_CODE_RANGE;
+    source_range_start = ecma_extended_info_decode_vlq (&lazy_extended_info_p);
+    source_range_size = ecma_extended_info_decode_vlq (&lazy_extended_info_p);
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+  if (extended_info & CBC_EXTENDED_CODE_FLAGS_HAS_SOURCE_CODE_RANGE)
+  {
+    total_size += ecma_extended_info_get_encoded_length (source_range_start);
+    total_size += ecma_extended_info_get_encoded_length (source_range_size);
   }
 #endif /* JERRY_FUNCTION_TO_STRING */
   if (extended_info != 0)
@@ -1099,6 +1169,14 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
     opcode_p = dst_p;
     branch_mark_p = page_p->bytes + offset;
+
+    if (*branch_mark_p == PARSER_CBC_REMOVED_BYTE)
+    {
+      /* Bytes removed by the optimizer are not copied. */
+      PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+      continue;
+    }
+
     opcode = (cbc_opcode_t) (*branch_mark_p);
     branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
 
@@ -1144,8 +1222,8 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
     }
 
-    /* Only literal and call arguments can be combined. */
-    JERRY_ASSERT (!(flags & CBC_HAS_BRANCH_ARG) || !(flags & (CBC_HAS_BYTE_ARG | CBC_HAS_LITERAL_ARG)));
+    /* Branch arguments can only be combined with literal arguments. */
+    JERRY_ASSERT (!(flags & CBC_HAS_BRANCH_ARG) || !(flags & CBC_HAS_BYTE_ARG));
 
     while (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
     {
@@ -1170,13 +1248,15 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
       if (flags & CBC_HAS_LITERAL_ARG2)
       {
+        /* The other argument flags are kept, since branch
+         * arguments may follow the literal arguments. */
         if (flags & CBC_HAS_LITERAL_ARG)
         {
-          flags = CBC_HAS_LITERAL_ARG;
+          flags = (uint8_t) (flags & ~CBC_HAS_LITERAL_ARG2);
         }
         else
         {
-          flags = CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2;
+          flags = (uint8_t) (flags | CBC_HAS_LITERAL_ARG);
         }
       }
       else
@@ -1257,7 +1337,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   uint8_t *line_info_p = parser_line_info_generate (context_p);
 #endif /* JERRY_LINE_INFO */
 
-  parse_update_branches (context_p, byte_code_p);
+  parse_update_branches (context_p, byte_code_p, literal_one_byte_limit);
 
   parser_cbc_stream_free (&context_p->byte_code);
 
@@ -1353,19 +1433,10 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     }
 
 #if JERRY_FUNCTION_TO_STRING
-    if (context_p->last_context_p != NULL)
+    if (extended_info & CBC_EXTENDED_CODE_FLAGS_HAS_SOURCE_CODE_RANGE)
     {
-      const uint8_t *start_p = context_p->source_start_p;
-
-      if (extended_info & CBC_EXTENDED_CODE_FLAGS_SOURCE_CODE_IN_ARGUMENTS)
-      {
-        start_p = context_p->arguments_start_p;
-      }
-
-      const uint8_t *function_start_p = context_p->last_context_p->function_start_p;
-
-      ecma_extended_info_encode_vlq (&extended_info_p, (uint32_t) (function_start_p - start_p));
-      ecma_extended_info_encode_vlq (&extended_info_p, (uint32_t) (context_p->function_end_p - function_start_p));
+      ecma_extended_info_encode_vlq (&extended_info_p, source_range_start);
+      ecma_extended_info_encode_vlq (&extended_info_p, source_range_size);
     }
 #endif /* JERRY_FUNCTION_TO_STRING */
   }
@@ -1956,6 +2027,16 @@ parser_script_size (parser_context_t *context_p) /**< context */
 static ecma_value_t
 parser_source_name (parser_context_t *context_p) /**< context */
 {
+#if JERRY_LAZY_FUNCTIONS
+  if (context_p->lazy_function_p != NULL)
+  {
+    ecma_value_t source_name = context_p->script_p->source_name;
+
+    ecma_ref_ecma_string (ecma_get_string_from_value (source_name));
+    return source_name;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   if (context_p->options_p != NULL && (context_p->options_p->options & JERRY_PARSE_HAS_SOURCE_NAME))
   {
     JERRY_ASSERT (ecma_is_value_string (context_p->options_p->source_name));
@@ -1973,6 +2054,99 @@ parser_source_name (parser_context_t *context_p) /**< context */
 } /* parser_source_name */
 #endif /* JERRY_SOURCE_NAME */
 
+/**
+ * Create the script of the source code.
+ */
+static void
+parser_create_script (parser_context_t *context_p) /**< context */
+{
+  context_p->script_p = parser_malloc (context_p, parser_script_size (context_p));
+
+  CBC_SCRIPT_SET_TYPE (context_p->script_p, context_p->user_value, CBC_SCRIPT_REF_ONE);
+
+  if (context_p->global_status_flags & (ECMA_PARSE_EVAL | ECMA_PARSE_HAS_ARGUMENT_LIST_VALUE))
+  {
+    context_p->script_p->refs_and_type |= CBC_SCRIPT_IS_EVAL_CODE;
+  }
+
+#if JERRY_BUILTIN_REALMS
+  context_p->script_p->realm_p = (ecma_object_t *) JERRY_CONTEXT (global_object_p);
+#endif /* JERRY_BUILTIN_REALMS */
+
+#if JERRY_SOURCE_NAME
+  context_p->script_p->source_name = parser_source_name (context_p);
+#endif /* JERRY_SOURCE_NAME */
+
+  ECMA_SET_INTERNAL_VALUE_POINTER (context_p->script_value, context_p->script_p);
+} /* parser_create_script */
+
+#if JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS
+
+/**
+ * Store the source code of the script.
+ */
+static void
+parser_store_source_code (parser_context_t *context_p, /**< context */
+                          void *source_p) /**< source code */
+{
+#if JERRY_LAZY_FUNCTIONS
+  if (context_p->lazy_function_p != NULL)
+  {
+    /* The source code is already stored by the script. */
+    return;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+#if !JERRY_FUNCTION_TO_STRING
+  if (!(context_p->global_status_flags & ECMA_PARSE_INTERNAL_HAS_LAZY_FUNCTION))
+  {
+    context_p->script_p->source_code = ecma_make_magic_string_value (LIT_MAGIC_STRING__EMPTY);
+    return;
+  }
+#endif /* !JERRY_FUNCTION_TO_STRING */
+
+  if (!(context_p->global_status_flags & ECMA_PARSE_HAS_SOURCE_VALUE))
+  {
+    ecma_string_t *string_p;
+
+#if JERRY_FUNCTION_TO_STRING
+    if (context_p->global_status_flags & ECMA_PARSE_INTERNAL_HAS_4_BYTE_MARKER)
+    {
+      string_p = ecma_new_ecma_string_from_utf8_converted_to_cesu8 (context_p->source_start_p, context_p->source_size);
+    }
+    else
+    {
+      string_p = ecma_new_ecma_string_from_utf8 (context_p->source_start_p, context_p->source_size);
+    }
+#else /* !JERRY_FUNCTION_TO_STRING */
+    string_p = ecma_new_ecma_string_from_utf8 (context_p->source_start_p, context_p->source_size);
+#endif /* JERRY_FUNCTION_TO_STRING */
+
+    context_p->script_p->source_code = ecma_make_string_value (string_p);
+  }
+  else
+  {
+    ecma_value_t source = ((ecma_value_t *) source_p)[0];
+
+    ecma_ref_ecma_string (ecma_get_string_from_value (source));
+    context_p->script_p->source_code = source;
+  }
+
+#if JERRY_FUNCTION_TO_STRING
+  if (context_p->argument_list != ECMA_VALUE_EMPTY)
+  {
+    int idx = (context_p->user_value != ECMA_VALUE_EMPTY) ? 1 : 0;
+
+    CBC_SCRIPT_GET_OPTIONAL_VALUES (context_p->script_p)[idx] = context_p->argument_list;
+
+    ecma_ref_ecma_string (ecma_get_string_from_value (context_p->argument_list));
+    context_p->script_p->refs_and_type |= CBC_SCRIPT_HAS_FUNCTION_ARGUMENTS;
+  }
+#endif /* JERRY_FUNCTION_TO_STRING */
+} /* parser_store_source_code */
+
+#endif /* JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS */
+
 /**
  * Parse and compile EcmaScript source code
  *
@@ -2070,6 +2244,37 @@ parser_parse_source (void *source_p, /**< source code */
     }
   }
 
+#if JERRY_LAZY_FUNCTIONS
+  context.script_source_start_p = context.source_start_p;
+  context.lazy_function_p = NULL;
+
+  if (context.global_status_flags & ECMA_PARSE_INTERNAL_LAZY_FUNCTION_BODY)
+  {
+    parser_lazy_source_t *lazy_source_p = (parser_lazy_source_t *) source_p;
+    cbc_lazy_function_t *lazy_function_p = lazy_source_p->function_p;
+
+    /* The argument list and the body are parsed in the same way as the arguments of the Function constructor. */
+    context.status_flags |= PARSER_IS_FUNCTION;
+    context.global_status_flags |= ECMA_PARSE_INTERNAL_LAZY_FUNCTIONS;
+    context.script_source_start_p = lazy_source_p->script_source_p;
+    context.arguments_start_p = context.script_source_start_p + lazy_function_p->arguments_start;
+    context.arguments_size = lazy_function_p->arguments_end - lazy_function_p->arguments_start;
+    context.source_p = context.arguments_start_p;
+    context.lazy_function_p = lazy_function_p;
+    context.script_value = lazy_function_p->header.script_value;
+    context.script_p = ECMA_GET_INTERNAL_VALUE_POINTER (cbc_script_t, context.script_value);
+  }
+  else if (!(context.global_status_flags & (ECMA_PARSE_EVAL | ECMA_PARSE_MODULE))
+           && context.argument_list == ECMA_VALUE_EMPTY
+           && ((context.global_status_flags & ECMA_PARSE_HAS_SOURCE_VALUE)
+               || lit_is_valid_cesu8_string (context.source_start_p, context.source_size)))
+  {
+    /* Lazy functions are compiled from the stored source code, so the
+     * offsets of the original source must be valid in the stored string. */
+    context.global_status_flags |= ECMA_PARSE_INTERNAL_LAZY_FUNCTIONS;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 #if JERRY_DEBUGGER
   if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
   {
@@ -2207,24 +2412,24 @@ parser_parse_source (void *source_p, /**< source code */
 
   PARSER_TRY (context.try_buffer)
   {
-    context.script_p = parser_malloc (&context, parser_script_size (&context));
-
-    CBC_SCRIPT_SET_TYPE (context.script_p, context.user_value, CBC_SCRIPT_REF_ONE);
+#if JERRY_LAZY_FUNCTIONS
+    if (context.lazy_function_p != NULL)
+    {
+      /* The script is shared with the other functions of the source code. */
+      if (JERRY_UNLIKELY (context.script_p->refs_and_type >= CBC_SCRIPT_REF_MAX))
+      {
+        jerry_fatal (JERRY_FATAL_REF_COUNT_LIMIT);
+      }
 
-    if (context.global_status_flags & (ECMA_PARSE_EVAL | ECMA_PARSE_HAS_ARGUMENT_LIST_VALUE))
+      context.script_p->refs_and_type += CBC_SCRIPT_REF_ONE;
+    }
+    else
     {
-      context.script_p->refs_and_type |= CBC_SCRIPT_IS_EVAL_CODE;
+      parser_create_script (&context);
     }
-
-#if JERRY_BUILTIN_REALMS
-    context.script_p->realm_p = (ecma_object_t *) JERRY_CONTEXT (global_object_p);
-#endif /* JERRY_BUILTIN_REALMS */
-
-#if JERRY_SOURCE_NAME
-    context.script_p->source_name = parser_source_name (&context);
-#endif /* JERRY_SOURCE_NAME */
-
-    ECMA_SET_INTERNAL_VALUE_POINTER (context.script_value, context.script_p);
+#else /* !JERRY_LAZY_FUNCTIONS */
+    parser_create_script (&context);
+#endif /* JERRY_LAZY_FUNCTIONS */
 
     /* Pushing a dummy value ensures the stack is never empty.
      * This simplifies the stack management routines. */
@@ -2320,40 +2525,9 @@ parser_parse_source (void *source_p, /**< source code */
     }
 #endif /* JERRY_MODULE_SYSTEM */
 
-#if JERRY_FUNCTION_TO_STRING
-    if (!(context.global_status_flags & ECMA_PARSE_HAS_SOURCE_VALUE))
-    {
-      ecma_string_t *string_p;
-
-      if (context.global_status_flags & ECMA_PARSE_INTERNAL_HAS_4_BYTE_MARKER)
-      {
-        string_p = ecma_new_ecma_string_from_utf8_converted_to_cesu8 (context.source_start_p, context.source_size);
-      }
-      else
-      {
-        string_p = ecma_new_ecma_string_from_utf8 (context.source_start_p, context.source_size);
-      }
-
-      context.script_p->source_code = ecma_make_string_value (string_p);
-    }
-    else
-    {
-      ecma_value_t source = ((ecma_value_t *) source_p)[0];
-
-      ecma_ref_ecma_string (ecma_get_string_from_value (source));
-      context.script_p->source_code = source;
-    }
-
-    if (context.argument_list != ECMA_VALUE_EMPTY)
-    {
-      int idx = (context.user_value != ECMA_VALUE_EMPTY) ? 1 : 0;
-
-      CBC_SCRIPT_GET_OPTIONAL_VALUES (context.script_p)[idx] = context.argument_list;
-
-      ecma_ref_ecma_string (ecma_get_string_from_value (context.argument_list));
-      context.script_p->refs_and_type |= CBC_SCRIPT_HAS_FUNCTION_ARGUMENTS;
-    }
-#endif /* JERRY_FUNCTION_TO_STRING */
+#if JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS
+    parser_store_source_code (&context, source_p);
+#endif /* JERRY_FUNCTION_TO_STRING || JERRY_LAZY_FUNCTIONS */
 
 #if JERRY_PARSER_DUMP_BYTE_CODE
     if (context.is_show_opcodes)
@@ -2386,12 +2560,21 @@ parser_parse_source (void *source_p, /**< source code */
     parser_free_literals (&context.literal_pool);
     parser_cbc_stream_free (&context.byte_code);
 
-#if JERRY_SOURCE_NAME
-    ecma_deref_ecma_string (ecma_get_string_from_value (context.script_p->source_name));
-#endif /* JERRY_SOURCE_NAME */
+#if JERRY_LAZY_FUNCTIONS
+    if (context.lazy_function_p != NULL)
+    {
+      /* The script is owned by the lazy function. */
+      context.script_p->refs_and_type -= CBC_SCRIPT_REF_ONE;
+      context.script_p = NULL;
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
 
     if (context.script_p != NULL)
     {
+#if JERRY_SOURCE_NAME
+      ecma_deref_ecma_string (ecma_get_string_from_value (context.script_p->source_name));
+#endif /* JERRY_SOURCE_NAME */
+
       JERRY_ASSERT (context.script_p->refs_and_type >= CBC_SCRIPT_REF_ONE);
       jmem_heap_free_block (context.script_p, parser_script_size (&context));
     }
@@ -2641,6 +2824,132 @@ parser_restore_context (parser_context_t *context_p, /**< context */
 #endif /* JERRY_LINE_INFO */
 } /* parser_restore_context */
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Status flags of the functions which body can be compiled lazily.
+ */
+#define PARSER_LAZY_FUNCTION_STATUS_FLAGS \
+  (PARSER_IS_STRICT | PARSER_FUNCTION_CLOSURE | PARSER_IS_FUNC_EXPRESSION | PARSER_ALLOW_NEW_TARGET)
+
+/**
+ * Create a lazy function after its argument list is parsed, and skip its body.
+ *
+ * Note:
+ *      the current token must be the left brace of the function body
+ *
+ * @return compiled code of the lazy function
+ */
+static ecma_compiled_code_t *
+parser_create_lazy_function (parser_context_t *context_p, /**< context */
+                             scanner_location_t *arguments_location_p, /**< start of the argument list */
+                             const uint8_t *arguments_end_p, /**< end of the argument list */
+                             scanner_location_t *end_location_p) /**< end of the function */
+{
+  JERRY_ASSERT (context_p->token.type == LEXER_LEFT_BRACE);
+  JERRY_ASSERT (context_p->last_context_p != NULL);
+
+  const uint8_t *script_source_start_p = context_p->script_source_start_p;
+  size_t total_size = sizeof (cbc_lazy_function_t) + sizeof (ecma_value_t);
+
+#if JERRY_FUNCTION_TO_STRING
+  const uint8_t *function_start_p = context_p->last_context_p->function_start_p;
+  uint32_t source_range_start = (uint32_t) (function_start_p - script_source_start_p);
+  uint32_t source_range_size = (uint32_t) (end_location_p->source_p - function_start_p);
+
+  total_size += sizeof (uint8_t) + ecma_extended_info_get_encoded_length (source_range_start)
+                + ecma_extended_info_get_encoded_length (source_range_size);
+#endif /* JERRY_FUNCTION_TO_STRING */
+
+  total_size = JERRY_ALIGNUP (total_size, JMEM_ALIGNMENT);
+
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) parser_malloc (context_p, total_size);
+
+#if JERRY_SNAPSHOT_SAVE || JERRY_PARSER_DUMP_BYTE_CODE
+  // Avoid getting junk bytes
+  memset (lazy_function_p, 0, total_size);
+#endif /* JERRY_SNAPSHOT_SAVE || JERRY_PARSER_DUMP_BYTE_CODE */
+
+#if JERRY_MEM_STATS
+  jmem_stats_allocate_byte_code_bytes (total_size);
+#endif /* JERRY_MEM_STATS */
+
+  ecma_compiled_code_t *compiled_code_p = (ecma_compiled_code_t *) lazy_function_p;
+  uint8_t argument_count = (uint8_t) context_p->argument_count;
+
+  compiled_code_p->size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
+  compiled_code_p->refs = 1;
+  compiled_code_p->status_flags = (CBC_CODE_FLAGS_LAZY_FUNCTION | CBC_FUNCTION_TO_TYPE_BITS (CBC_FUNCTION_NORMAL));
+
+  if (context_p->status_flags & PARSER_IS_STRICT)
+  {
+    compiled_code_p->status_flags |= CBC_CODE_FLAGS_STRICT_MODE;
+  }
+
+  lazy_function_p->header.stack_limit = 0;
+  lazy_function_p->header.argument_end = argument_count;
+  lazy_function_p->header.script_value = context_p->script_value;
+  lazy_function_p->header.register_end = argument_count;
+  lazy_function_p->header.ident_end = argument_count;
+  lazy_function_p->header.const_literal_end = argument_count;
+  lazy_function_p->header.literal_end = argument_count;
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (lazy_function_p->compiled_code, NULL);
+  lazy_function_p->arguments_start = (uint32_t) (arguments_location_p->source_p - script_source_start_p);
+  lazy_function_p->arguments_end = (uint32_t) (arguments_end_p - script_source_start_p);
+  lazy_function_p->arguments_line = arguments_location_p->line;
+  lazy_function_p->arguments_column = arguments_location_p->column;
+  lazy_function_p->body_start = (uint32_t) (context_p->source_p - script_source_start_p);
+  lazy_function_p->body_end = (uint32_t) (end_location_p->source_p - 1 - script_source_start_p);
+  lazy_function_p->body_line = context_p->line;
+  lazy_function_p->body_column = context_p->column;
+  lazy_function_p->parse_opts = context_p->global_status_flags & ECMA_PARSE_INTERNAL_OPTIMIZE_BYTE_CODE;
+
+  ecma_value_t *base_p = (ecma_value_t *) (((uint8_t *) compiled_code_p) + total_size);
+  *(--base_p) = ecma_make_magic_string_value (LIT_MAGIC_STRING__EMPTY);
+
+#if JERRY_FUNCTION_TO_STRING
+  uint8_t *extended_info_p = ((uint8_t *) base_p) - 1;
+
+  compiled_code_p->status_flags |= CBC_CODE_FLAGS_HAS_EXTENDED_INFO;
+  *extended_info_p = CBC_EXTENDED_CODE_FLAGS_HAS_SOURCE_CODE_RANGE;
+
+  ecma_extended_info_encode_vlq (&extended_info_p, source_range_start);
+  ecma_extended_info_encode_vlq (&extended_info_p, source_range_size);
+#endif /* JERRY_FUNCTION_TO_STRING */
+
+  if (JERRY_UNLIKELY (context_p->script_p->refs_and_type >= CBC_SCRIPT_REF_MAX))
+  {
+    /* This is probably never happens in practice. */
+    jerry_fatal (JERRY_FATAL_REF_COUNT_LIMIT);
+  }
+
+  context_p->script_p->refs_and_type += CBC_SCRIPT_REF_ONE;
+  context_p->global_status_flags |= ECMA_PARSE_INTERNAL_HAS_LAZY_FUNCTION;
+
+  /* Drop everything produced by the argument list and continue after the function body. */
+  parser_free_literals (&context_p->literal_pool);
+  parser_list_reset (&context_p->literal_pool);
+  parser_cbc_stream_free (&context_p->byte_code);
+  context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+
+  scanner_release_function_body (context_p, end_location_p->source_p);
+  scanner_set_location (context_p, end_location_p);
+
+  context_p->token.type = LEXER_RIGHT_BRACE;
+  context_p->token.flags = 0;
+  context_p->token.line = end_location_p->line;
+  context_p->token.column = end_location_p->column - 1;
+
+#if JERRY_FUNCTION_TO_STRING
+  context_p->function_end_p = context_p->source_p;
+#endif /* JERRY_FUNCTION_TO_STRING */
+
+  return compiled_code_p;
+} /* parser_create_lazy_function */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * Parse function code
  *
@@ -2680,9 +2989,28 @@ parser_parse_function (parser_context_t *context_p, /**< context */
     parser_raise_error (context_p, PARSER_ERR_ARGUMENT_LIST_EXPECTED);
   }
 
+#if JERRY_LAZY_FUNCTIONS
+  scanner_location_t arguments_location;
+  scanner_location_t end_location;
+
+  scanner_get_location (&arguments_location, context_p);
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   lexer_next_token (context_p);
 
+#if JERRY_LAZY_FUNCTIONS
+  bool is_lazy = ((context_p->global_status_flags & ECMA_PARSE_INTERNAL_LAZY_FUNCTIONS)
+                  && !(context_p->status_flags & (uint32_t) ~PARSER_LAZY_FUNCTION_STATUS_FLAGS)
+                  && context_p->private_context_p == NULL && context_p->skipped_scanner_info_p == NULL
+                  && scanner_get_function_end_location (context_p, &end_location));
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   parser_parse_function_arguments (context_p, LEXER_RIGHT_PAREN);
+
+#if JERRY_LAZY_FUNCTIONS
+  const uint8_t *arguments_end_p = context_p->source_p - 1;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   lexer_next_token (context_p);
 
   if ((context_p->status_flags & PARSER_IS_PROPERTY_GETTER) && context_p->argument_count != 0)
@@ -2713,6 +3041,16 @@ parser_parse_function (parser_context_t *context_p, /**< context */
     parser_raise_error (context_p, PARSER_ERR_LEFT_BRACE_EXPECTED);
   }
 
+#if JERRY_LAZY_FUNCTIONS
+  if (is_lazy && context_p->argument_count <= CBC_MAXIMUM_BYTE_VALUE
+      && !(context_p->status_flags & (PARSER_LEXICAL_BLOCK_NEEDED | PARSER_HAS_NON_STRICT_ARG)))
+  {
+    compiled_code_p = parser_create_lazy_function (context_p, &arguments_location, arguments_end_p, &end_location);
+    parser_restore_context (context_p, &saved_context);
+    return compiled_code_p;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
   lexer_next_token (context_p);
   parser_parse_statements (context_p);
   compiled_code_p = parser_post_processing (context_p);
@@ -3372,6 +3710,67 @@ parser_parse_script (void *source_p, /**< source code */
 #endif /* JERRY_PARSER */
 } /* parser_parse_script */
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Compile the body of a lazy function.
+ *
+ * Note:
+ *      the compiled code is owned by the lazy function, and
+ *      it is returned again when the function is compiled later
+ *
+ * @return pointer to compiled byte code - if success
+ *         NULL - otherwise (an exception is thrown)
+ */
+ecma_compiled_code_t *
+parser_compile_lazy_function (ecma_compiled_code_t *bytecode_p) /**< lazy function */
+{
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION);
+
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+
+  if (!ECMA_IS_INTERNAL_VALUE_NULL (lazy_function_p->compiled_code))
+  {
+    return ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_compiled_code_t, lazy_function_p->compiled_code);
+  }
+
+  cbc_script_t *script_p = ECMA_GET_INTERNAL_VALUE_POINTER (cbc_script_t, lazy_function_p->header.script_value);
+  ecma_string_t *source_string_p = ecma_get_string_from_value (script_p->source_code);
+  uint32_t parse_opts =
+    ECMA_PARSE_INTERNAL_LAZY_FUNCTION_BODY | ECMA_PARSE_ALLOW_NEW_TARGET | lazy_function_p->parse_opts;
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE)
+  {
+    parse_opts |= ECMA_PARSE_STRICT_MODE;
+  }
+
+  ECMA_STRING_TO_UTF8_STRING (source_string_p, source_start_p, source_size);
+
+  JERRY_ASSERT (lazy_function_p->body_end <= source_size);
+
+  parser_lazy_source_t lazy_source;
+  lazy_source.source.source_p = source_start_p + lazy_function_p->body_start;
+  lazy_source.source.source_size = lazy_function_p->body_end - lazy_function_p->body_start;
+  lazy_source.script_source_p = source_start_p;
+  lazy_source.function_p = lazy_function_p;
+
+  ecma_compiled_code_t *compiled_code_p = parser_parse_source (&lazy_source, parse_opts, NULL);
+
+  ECMA_FINALIZE_UTF8_STRING (source_start_p, source_size);
+
+  if (JERRY_UNLIKELY (compiled_code_p == NULL))
+  {
+    /* Exception has already thrown. */
+    return NULL;
+  }
+
+  *ecma_compiled_code_resolve_function_name (compiled_code_p) = *ecma_compiled_code_resolve_function_name (bytecode_p);
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (lazy_function_p->compiled_code, compiled_code_p);
+  return compiled_code_p;
+} /* parser_compile_lazy_function */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * @}
  * @}
@@ -167,7 +167,16 @@ scanner_get_stream_size (scanner_info_t *info_p, /**< scanner info block */
     }
   }
 
-  return size + 1 + (size_t) (data_p - data_p_start);
+  size += 1 + (size_t) (data_p - data_p_start);
+
+#if JERRY_LAZY_FUNCTIONS
+  if (info_p->type == SCANNER_TYPE_FUNCTION && (info_p->u8_arg & SCANNER_FUNCTION_HAS_END_LOCATION))
+  {
+    size += sizeof (scanner_location_t);
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+  return size;
 } /* scanner_get_stream_size */
 
 /**
@@ -942,6 +951,25 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
 
     compressed_size += sizeof (scanner_info_t);
 
+#if JERRY_LAZY_FUNCTIONS
+    const uint16_t lazy_function_mask = (SCANNER_LITERAL_POOL_FUNCTION | SCANNER_LITERAL_POOL_CLASS_FIELD
+                                         | SCANNER_LITERAL_POOL_HAS_COMPLEX_ARGUMENT | SCANNER_LITERAL_POOL_ARROW
+                                         | SCANNER_LITERAL_POOL_GENERATOR | SCANNER_LITERAL_POOL_ASYNC);
+
+    /* The parser may skip the body of simple inner functions, so their end is recorded.
+     * Functions with a 'use strict' directive are not skipped, since their arguments must be checked. */
+    bool has_end_location = ((context_p->global_status_flags & ECMA_PARSE_INTERNAL_LAZY_FUNCTIONS)
+                             && prev_literal_pool_p != NULL && context_p->token.type == LEXER_RIGHT_BRACE
+                             && (status_flags & lazy_function_mask) == SCANNER_LITERAL_POOL_FUNCTION
+                             && (!(status_flags & SCANNER_LITERAL_POOL_IS_STRICT)
+                                 || (prev_literal_pool_p->status_flags & SCANNER_LITERAL_POOL_IS_STRICT)));
+
+    if (has_end_location)
+    {
+      compressed_size += sizeof (scanner_location_t);
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     scanner_info_t *info_p;
 
     if (prev_literal_pool_p != NULL || scanner_context_p->end_arguments_p == NULL)
@@ -1022,6 +1050,13 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
         u8_arg |= SCANNER_FUNCTION_IS_STRICT;
       }
 
+#if JERRY_LAZY_FUNCTIONS
+      if (has_end_location)
+      {
+        u8_arg |= SCANNER_FUNCTION_HAS_END_LOCATION;
+      }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
       info_p->u8_arg = u8_arg;
       info_p->u16_arg = (uint16_t) no_declarations;
     }
@@ -1179,6 +1214,17 @@ scanner_pop_literal_pool (parser_context_t *context_p, /**< context */
 
     data_p[0] = SCANNER_STREAM_TYPE_END;
 
+#if JERRY_LAZY_FUNCTIONS
+    if (has_end_location)
+    {
+      scanner_location_t end_location;
+
+      scanner_get_location (&end_location, context_p);
+      memcpy (data_p + 1, &end_location, sizeof (scanner_location_t));
+      data_p += sizeof (scanner_location_t);
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     JERRY_ASSERT (((uint8_t *) info_p) + compressed_size == data_p + 1);
   }
 
@@ -1930,6 +1976,57 @@ scanner_reverse_info_list (parser_context_t *context_p) /**< context */
   context_p->next_scanner_info_p = last_scanner_info_p;
 } /* scanner_reverse_info_list */
 
+/**
+ * Release the data owned by a scanner info block.
+ *
+ * @return size of the scanner info block
+ */
+static size_t
+scanner_release_info_data (scanner_info_t *scanner_info_p) /**< scanner info block */
+{
+  switch (scanner_info_p->type)
+  {
+    case SCANNER_TYPE_FUNCTION:
+    case SCANNER_TYPE_BLOCK:
+    {
+      return scanner_get_stream_size (scanner_info_p, sizeof (scanner_info_t));
+    }
+    case SCANNER_TYPE_WHILE:
+    case SCANNER_TYPE_FOR_IN:
+    case SCANNER_TYPE_FOR_OF:
+    case SCANNER_TYPE_CASE:
+    case SCANNER_TYPE_INITIALIZER:
+    case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
+    case SCANNER_TYPE_CLASS_STATIC_BLOCK_END:
+    {
+      return sizeof (scanner_location_info_t);
+    }
+    case SCANNER_TYPE_FOR:
+    {
+      return sizeof (scanner_for_info_t);
+    }
+    case SCANNER_TYPE_SWITCH:
+    {
+      scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
+      return sizeof (scanner_switch_info_t);
+    }
+    case SCANNER_TYPE_CLASS_CONSTRUCTOR:
+    {
+      scanner_release_private_fields (((scanner_class_info_t *) scanner_info_p)->members);
+      return sizeof (scanner_class_info_t);
+    }
+    default:
+    {
+      JERRY_ASSERT (
+        scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS || scanner_info_p->type == SCANNER_TYPE_LITERAL_FLAGS
+        || scanner_info_p->type == SCANNER_TYPE_LET_EXPRESSION || scanner_info_p->type == SCANNER_TYPE_ERR_REDECLARED
+        || scanner_info_p->type == SCANNER_TYPE_ERR_ASYNC_FUNCTION
+        || scanner_info_p->type == SCANNER_TYPE_EXPORT_MODULE_SPECIFIER);
+      return sizeof (scanner_info_t);
+    }
+  }
+} /* scanner_release_info_data */
+
 /**
  * Release unused scanner info blocks.
  * This should happen only if an error is occurred.
@@ -1950,61 +2047,13 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   {
     scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
 
-    size_t size = sizeof (scanner_info_t);
-
-    switch (scanner_info_p->type)
+    if (scanner_info_p->type == SCANNER_TYPE_END)
     {
-      case SCANNER_TYPE_END:
-      {
-        scanner_info_p = context_p->active_scanner_info_p;
-        continue;
-      }
-      case SCANNER_TYPE_FUNCTION:
-      case SCANNER_TYPE_BLOCK:
-      {
-        size = scanner_get_stream_size (scanner_info_p, sizeof (scanner_info_t));
-        break;
-      }
-      case SCANNER_TYPE_WHILE:
-      case SCANNER_TYPE_FOR_IN:
-      case SCANNER_TYPE_FOR_OF:
-      case SCANNER_TYPE_CASE:
-      case SCANNER_TYPE_INITIALIZER:
-      case SCANNER_TYPE_CLASS_FIELD_INITIALIZER_END:
-      case SCANNER_TYPE_CLASS_STATIC_BLOCK_END:
-      {
-        size = sizeof (scanner_location_info_t);
-        break;
-      }
-      case SCANNER_TYPE_FOR:
-      {
-        size = sizeof (scanner_for_info_t);
-        break;
-      }
-      case SCANNER_TYPE_SWITCH:
-      {
-        scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
-        size = sizeof (scanner_switch_info_t);
-        break;
-      }
-      case SCANNER_TYPE_CLASS_CONSTRUCTOR:
-      {
-        scanner_release_private_fields (((scanner_class_info_t *) scanner_info_p)->members);
-        size = sizeof (scanner_class_info_t);
-        break;
-      }
-      default:
-      {
-        JERRY_ASSERT (
-          scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS || scanner_info_p->type == SCANNER_TYPE_LITERAL_FLAGS
-          || scanner_info_p->type == SCANNER_TYPE_LET_EXPRESSION || scanner_info_p->type == SCANNER_TYPE_ERR_REDECLARED
-          || scanner_info_p->type == SCANNER_TYPE_ERR_ASYNC_FUNCTION
-          || scanner_info_p->type == SCANNER_TYPE_EXPORT_MODULE_SPECIFIER);
-        break;
-      }
+      scanner_info_p = context_p->active_scanner_info_p;
+      continue;
     }
 
-    scanner_free (scanner_info_p, size);
+    scanner_free (scanner_info_p, scanner_release_info_data (scanner_info_p));
     scanner_info_p = next_scanner_info_p;
   }
 
@@ -2012,6 +2061,58 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   context_p->active_scanner_info_p = NULL;
 } /* scanner_cleanup */
 
+#if JERRY_LAZY_FUNCTIONS
+
+/**
+ * Get the location of the closing brace of the next function.
+ *
+ * Note:
+ *      the location is only available for functions which body can be compiled lazily
+ *
+ * @return true - if the end location is stored in the scanner info,
+ *         false - otherwise
+ */
+bool
+scanner_get_function_end_location (parser_context_t *context_p, /**< context */
+                                   scanner_location_t *location_p) /**< [out] end location */
+{
+  scanner_info_t *info_p = context_p->next_scanner_info_p;
+
+  JERRY_ASSERT (info_p->type == SCANNER_TYPE_FUNCTION);
+
+  if (!(info_p->u8_arg & SCANNER_FUNCTION_HAS_END_LOCATION))
+  {
+    return false;
+  }
+
+  size_t size = scanner_get_stream_size (info_p, sizeof (scanner_info_t));
+  memcpy (location_p, ((uint8_t *) info_p) + size - sizeof (scanner_location_t), sizeof (scanner_location_t));
+  return true;
+} /* scanner_get_function_end_location */
+
+/**
+ * Release the scanner info blocks of a function body which is not parsed.
+ */
+void
+scanner_release_function_body (parser_context_t *context_p, /**< context */
+                               const uint8_t *end_p) /**< end of the function body */
+{
+  JERRY_ASSERT (context_p->skipped_scanner_info_p == NULL);
+
+  scanner_info_t *scanner_info_p = context_p->next_scanner_info_p;
+
+  while (scanner_info_p->source_p != NULL && scanner_info_p->source_p < end_p)
+  {
+    JERRY_ASSERT (scanner_info_p->type != SCANNER_TYPE_END);
+
+    context_p->next_scanner_info_p = scanner_info_p->next_p;
+    scanner_free (scanner_info_p, scanner_release_info_data (scanner_info_p));
+    scanner_info_p = context_p->next_scanner_info_p;
+  }
+} /* scanner_release_function_body */
+
+#endif /* JERRY_LAZY_FUNCTIONS */
+
 /**
  * Checks whether a context needs to be created for a block.
  *
@@ -2798,7 +2899,16 @@ scanner_create_variables (parser_context_t *context_p, /**< context */
 
   if (!(option_flags & SCANNER_CREATE_VARS_IS_FUNCTION_ARGS))
   {
-    scanner_release_next (context_p, (size_t) (next_data_p + 1 - ((const uint8_t *) info_p)));
+    size_t size = (size_t) (next_data_p + 1 - ((const uint8_t *) info_p));
+
+#if JERRY_LAZY_FUNCTIONS
+    if (info_type == SCANNER_TYPE_FUNCTION && (info_u8_arg & SCANNER_FUNCTION_HAS_END_LOCATION))
+    {
+      size += sizeof (scanner_location_t);
+    }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+    scanner_release_next (context_p, size);
   }
   parser_flush_cbc (context_p);
 } /* scanner_create_variables */
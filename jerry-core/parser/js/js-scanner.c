@@ -3350,6 +3350,11 @@ scan_completed:
   }
   PARSER_CATCH
   {
+#if JERRY_LAZY_FUNCTIONS
+    /* The end of the unterminated functions is unknown, so their bodies must be parsed. */
+    context_p->global_status_flags &= (uint32_t) ~ECMA_PARSE_INTERNAL_LAZY_FUNCTIONS;
+#endif /* JERRY_LAZY_FUNCTIONS */
+
     while (scanner_context.active_binding_list_p != NULL)
     {
       scanner_pop_binding_list (&scanner_context);
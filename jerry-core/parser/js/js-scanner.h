@@ -240,6 +240,10 @@ typedef enum
                                           *   this flag must be combined with the type of function (e.g. async) */
   SCANNER_FUNCTION_ASYNC = (1 << 4), /**< function is async function */
   SCANNER_FUNCTION_IS_STRICT = (1 << 5), /**< function is strict */
+#if JERRY_LAZY_FUNCTIONS
+  SCANNER_FUNCTION_HAS_END_LOCATION = (1 << 6), /**< the location of the closing brace of the function body
+                                                 *   is stored after the stream */
+#endif /* JERRY_LAZY_FUNCTIONS */
 } scanner_function_flags_t;
 
 /**
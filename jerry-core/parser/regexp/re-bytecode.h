@@ -97,8 +97,89 @@ typedef struct
   uint32_t captures_count; /**< number of capturing groups */
   uint32_t non_captures_count; /**< number of non-capturing groups */
   ecma_value_t source; /**< original RegExp pattern */
+  uint32_t nfa_offset; /**< offset of the automaton from the start of the compiled code,
+                        *   0 if the pattern can only be matched by backtracking */
+  uint32_t scan_offset; /**< offset of the start position scan data from the start of the compiled code */
+  uint8_t scan_type; /**< re_scan_type_t */
+  uint8_t prefix_size; /**< size of the literal prefix for RE_SCAN_PREFIX */
 } re_compiled_code_t;
 
+/**
+ * Size of the first byte bitmap of RE_SCAN_FIRST_BYTES.
+ */
+#define RE_SCAN_BITMAP_SIZE 32
+
+/**
+ * Maximum size of the literal prefix of RE_SCAN_PREFIX.
+ */
+#define RE_SCAN_MAX_PREFIX_SIZE 32
+
+/**
+ * Types of the start position scan, which skips the positions where a pattern cannot match.
+ */
+typedef enum
+{
+  RE_SCAN_ANY, /**< a match can start at any position */
+  RE_SCAN_INPUT_START, /**< a match can only start at the start of the input */
+  RE_SCAN_PREFIX, /**< every match starts with a literal byte sequence */
+  RE_SCAN_FIRST_BYTES, /**< every match starts with a byte contained in a bitmap */
+} re_scan_type_t;
+
+/**
+ * Get the start position scan data of the compiled code.
+ */
+#define RE_GET_SCAN_DATA(bc_p) (((const uint8_t *) (bc_p)) + (bc_p)->scan_offset)
+
+/**
+ * Maximum number of instructions of an automaton.
+ */
+#define RE_NFA_MAX_INSTRUCTIONS 1024
+
+/**
+ * Automaton opcodes
+ */
+typedef enum
+{
+  RE_NFA_OP_CHAR, /**< match the next character with the atom at byte code offset arg2 */
+  RE_NFA_OP_MATCH, /**< pattern matched */
+  RE_NFA_OP_SPLIT, /**< continue at arg1 and at arg2, arg1 has higher priority */
+  RE_NFA_OP_JUMP, /**< continue at arg1 */
+  RE_NFA_OP_SAVE, /**< store the current position into capture slot arg1 */
+  RE_NFA_OP_CLEAR, /**< clear arg2 number of capture slots starting from arg1 */
+  RE_NFA_OP_ASSERT, /**< check the zero-width assertion opcode stored in arg1 */
+} re_nfa_opcode_t;
+
+/**
+ * Automaton instruction
+ */
+typedef struct
+{
+  uint8_t opcode; /**< re_nfa_opcode_t */
+  uint16_t arg1; /**< first argument */
+  uint32_t arg2; /**< second argument */
+} re_nfa_instruction_t;
+
+/**
+ * Automaton header, followed by the instructions.
+ *
+ * The automaton is a Thompson NFA created from the byte code of patterns which have no
+ * backreferences and lookahead assertions. It is executed by simulating all threads in
+ * lockstep, so the matching time is proportional to the product of the input length and
+ * the number of instructions. Threads are kept in priority order, which produces the same
+ * result as the backtracking matcher.
+ */
+typedef struct
+{
+  uint16_t instruction_count; /**< number of instructions */
+  uint16_t thread_count; /**< maximum number of threads (character and match instructions) */
+  uint32_t stack_size; /**< size of the stack used for following the epsilon transitions */
+} re_nfa_header_t;
+
+/**
+ * Get the instructions of an automaton.
+ */
+#define RE_NFA_GET_INSTRUCTIONS(nfa_p) ((const re_nfa_instruction_t *) ((nfa_p) + 1))
+
 void re_initialize_regexp_bytecode (re_compiler_ctx_t *re_ctx_p);
 uint32_t re_bytecode_size (re_compiler_ctx_t *re_ctx_p);
 
@@ -96,6 +96,1063 @@ re_cache_gc (void)
   JERRY_CONTEXT (re_cache_idx) = 0;
 } /* re_cache_gc */
 
+/**
+ * Context of the automaton compiler
+ */
+typedef struct
+{
+  const uint8_t *bytecode_start_p; /**< start of the compiled code */
+  re_nfa_instruction_t *instructions_p; /**< instruction buffer, NULL if only the size is computed */
+  uint32_t instruction_count; /**< number of instructions */
+  uint32_t thread_count; /**< number of character and match instructions */
+  uint32_t stack_size; /**< size of the stack used for following the epsilon transitions */
+  uint32_t unsafe_split_count; /**< number of split instructions whose preferred branch can match an empty string */
+  uint8_t char_size; /**< size of encoded characters */
+  bool failed; /**< the pattern cannot be converted to an automaton */
+} re_nfa_compiler_ctx_t;
+
+/**
+ * Append an instruction to the automaton.
+ *
+ * @return index of the instruction
+ */
+static uint32_t
+re_nfa_emit (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+             re_nfa_opcode_t opcode, /**< opcode */
+             uint32_t arg1, /**< first argument */
+             uint32_t arg2) /**< second argument */
+{
+  const uint32_t index = nfa_ctx_p->instruction_count;
+
+  if (index >= RE_NFA_MAX_INSTRUCTIONS || arg1 > UINT16_MAX)
+  {
+    nfa_ctx_p->failed = true;
+    return index;
+  }
+
+  nfa_ctx_p->instruction_count++;
+
+  /* The stack size is the upper limit of the entries pushed by the instructions of a single epsilon closure. */
+  switch (opcode)
+  {
+    case RE_NFA_OP_CHAR:
+    case RE_NFA_OP_MATCH:
+    {
+      nfa_ctx_p->thread_count++;
+      break;
+    }
+    case RE_NFA_OP_SPLIT:
+    case RE_NFA_OP_SAVE:
+    {
+      nfa_ctx_p->stack_size += 2;
+      break;
+    }
+    case RE_NFA_OP_CLEAR:
+    {
+      nfa_ctx_p->stack_size += arg2 + 1;
+      break;
+    }
+    default:
+    {
+      nfa_ctx_p->stack_size++;
+      break;
+    }
+  }
+
+  if (nfa_ctx_p->instructions_p != NULL)
+  {
+    re_nfa_instruction_t *instruction_p = nfa_ctx_p->instructions_p + index;
+    instruction_p->opcode = (uint8_t) opcode;
+    instruction_p->arg1 = (uint16_t) arg1;
+    instruction_p->arg2 = arg2;
+  }
+
+  return index;
+} /* re_nfa_emit */
+
+/**
+ * Set the targets of a split instruction.
+ */
+static void
+re_nfa_set_split_targets (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+                          uint32_t index, /**< index of the split instruction */
+                          uint32_t first_target, /**< target with higher priority */
+                          uint32_t second_target) /**< target with lower priority */
+{
+  if (nfa_ctx_p->instructions_p != NULL && !nfa_ctx_p->failed)
+  {
+    JERRY_ASSERT (nfa_ctx_p->instructions_p[index].opcode == RE_NFA_OP_SPLIT);
+    nfa_ctx_p->instructions_p[index].arg1 = (uint16_t) first_target;
+    nfa_ctx_p->instructions_p[index].arg2 = second_target;
+  }
+} /* re_nfa_set_split_targets */
+
+/**
+ * Set the target of a jump instruction.
+ */
+static void
+re_nfa_set_jump_target (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+                        uint32_t index, /**< index of the jump instruction */
+                        uint32_t target) /**< target */
+{
+  if (nfa_ctx_p->instructions_p != NULL && !nfa_ctx_p->failed)
+  {
+    JERRY_ASSERT (nfa_ctx_p->instructions_p[index].opcode == RE_NFA_OP_JUMP);
+    nfa_ctx_p->instructions_p[index].arg1 = (uint16_t) target;
+  }
+} /* re_nfa_set_jump_target */
+
+/**
+ * Skip a character atom in the byte code.
+ *
+ * @return pointer to the byte code after the atom
+ */
+static const uint8_t *
+re_nfa_skip_atom (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+                  const uint8_t *bc_p) /**< pointer to the atom */
+{
+  switch (re_get_opcode (&bc_p))
+  {
+    case RE_OP_BYTE:
+    case RE_OP_CLASS_ESCAPE:
+    {
+      return bc_p + 1;
+    }
+    case RE_OP_CHAR:
+    {
+      return bc_p + nfa_ctx_p->char_size;
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      const uint8_t flags = re_get_byte (&bc_p);
+      const uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
+      const uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
+
+      bc_p += flags & RE_CLASS_ESCAPE_COUNT_MASK;
+      return bc_p + (char_count + range_count * 2) * nfa_ctx_p->char_size;
+    }
+    default:
+    {
+      JERRY_ASSERT (bc_p[-1] == RE_OP_PERIOD || bc_p[-1] == RE_OP_UNICODE_PERIOD);
+      return bc_p;
+    }
+  }
+} /* re_nfa_skip_atom */
+
+static bool re_nfa_compile_disjunction (re_nfa_compiler_ctx_t *nfa_ctx_p, const uint8_t **bc_p);
+
+/**
+ * Convert a group to automaton instructions. The iterations of the group are unrolled.
+ *
+ * The backtracking matcher rejects empty optional iterations. An empty iteration of an
+ * infinite loop returns to the already visited split instruction, so its thread is
+ * discarded, but the unrolled iterations of bounded loops must consume at least one
+ * character. An empty iteration may also reach a split instruction of the body which
+ * is already visited by a thread with lower priority, e.g. the lazy iterator of
+ * /(a*?)+/, so infinite loops with such bodies are not converted either.
+ *
+ * @return true - if the group can match an empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_group (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+                      const uint8_t **bc_p) /**< [in, out] pointer to the group start opcode */
+{
+  const uint8_t *group_bc_p = *bc_p;
+  const bool is_capturing = (re_get_opcode (&group_bc_p) == RE_OP_CAPTURING_GROUP_START);
+  const uint32_t group_idx = re_get_value (&group_bc_p);
+  uint32_t capture_start = group_idx;
+  uint32_t capture_count;
+
+  if (is_capturing)
+  {
+    capture_count = re_get_value (&group_bc_p);
+  }
+  else
+  {
+    capture_start = re_get_value (&group_bc_p);
+    capture_count = re_get_value (&group_bc_p);
+  }
+
+  const uint32_t qmin = re_get_value (&group_bc_p);
+  const uint8_t *end_p = NULL;
+
+  if (qmin == 0)
+  {
+    const uint32_t end_offset = re_get_value (&group_bc_p);
+    end_p = group_bc_p + end_offset;
+  }
+
+  if (qmin > RE_NFA_MAX_INSTRUCTIONS)
+  {
+    nfa_ctx_p->failed = true;
+    return false;
+  }
+
+  /* Nested capturing groups are cleared at the start of each iteration. */
+  uint32_t clear_start = capture_start * 2;
+  uint32_t clear_count = capture_count * 2;
+
+  if (is_capturing)
+  {
+    clear_start += 2;
+    clear_count -= 2;
+  }
+
+  bool is_nullable = true;
+
+  for (uint32_t i = 0; i < qmin && !nfa_ctx_p->failed; i++)
+  {
+    const uint32_t iteration_start = nfa_ctx_p->instruction_count;
+    const uint8_t *body_p = group_bc_p;
+
+    if (is_capturing)
+    {
+      re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, group_idx * 2, 0);
+    }
+
+    if (clear_count > 0)
+    {
+      re_nfa_emit (nfa_ctx_p, RE_NFA_OP_CLEAR, clear_start, clear_count);
+    }
+
+    is_nullable = re_nfa_compile_disjunction (nfa_ctx_p, &body_p);
+
+    if (is_capturing)
+    {
+      re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, group_idx * 2 + 1, 0);
+    }
+
+    end_p = body_p;
+
+    if (nfa_ctx_p->instruction_count == iteration_start)
+    {
+      /* The remaining iterations produce no instructions either. */
+      break;
+    }
+  }
+
+  if (nfa_ctx_p->failed)
+  {
+    return false;
+  }
+
+  const uint8_t *end_bc_p = end_p;
+  const re_opcode_t end_opcode = re_get_opcode (&end_bc_p);
+  JERRY_ASSERT (end_opcode >= RE_OP_GREEDY_CAPTURING_GROUP_END && end_opcode <= RE_OP_LAZY_NON_CAPTURING_GROUP_END);
+
+  const bool is_greedy = (end_opcode == RE_OP_GREEDY_CAPTURING_GROUP_END
+                          || end_opcode == RE_OP_GREEDY_NON_CAPTURING_GROUP_END);
+  re_get_value (&end_bc_p);
+  re_get_value (&end_bc_p);
+  const uint32_t qmax = re_get_value (&end_bc_p) - RE_QMAX_OFFSET;
+  *bc_p = end_bc_p;
+
+  if (qmax <= qmin)
+  {
+    return is_nullable || qmin == 0;
+  }
+
+  const bool is_infinite = (qmax == RE_INFINITY);
+
+  if (!is_infinite && qmax - qmin > RE_NFA_MAX_INSTRUCTIONS)
+  {
+    nfa_ctx_p->failed = true;
+    return false;
+  }
+
+  const uint32_t first_split = nfa_ctx_p->instruction_count;
+  const uint32_t optional_count = is_infinite ? 1 : qmax - qmin;
+
+  for (uint32_t i = 0; i < optional_count && !nfa_ctx_p->failed; i++)
+  {
+    const uint8_t *body_p = group_bc_p;
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SPLIT, 0, 0);
+
+    if (is_capturing)
+    {
+      re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, group_idx * 2, 0);
+    }
+
+    if (clear_count > 0)
+    {
+      re_nfa_emit (nfa_ctx_p, RE_NFA_OP_CLEAR, clear_start, clear_count);
+    }
+
+    const uint32_t unsafe_split_count = nfa_ctx_p->unsafe_split_count;
+
+    if (re_nfa_compile_disjunction (nfa_ctx_p, &body_p)
+        && (!is_infinite || nfa_ctx_p->unsafe_split_count != unsafe_split_count))
+    {
+      nfa_ctx_p->failed = true;
+    }
+
+    if (is_capturing)
+    {
+      re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, group_idx * 2 + 1, 0);
+    }
+
+    if (is_infinite)
+    {
+      re_nfa_emit (nfa_ctx_p, RE_NFA_OP_JUMP, first_split, 0);
+    }
+  }
+
+  if (nfa_ctx_p->failed)
+  {
+    return false;
+  }
+
+  /* Each optional iteration has the same number of instructions. */
+  const uint32_t done = nfa_ctx_p->instruction_count;
+  const uint32_t iteration_size = (done - first_split) / optional_count;
+
+  for (uint32_t split = first_split; split < done; split += iteration_size)
+  {
+    re_nfa_set_split_targets (nfa_ctx_p, split, is_greedy ? split + 1 : done, is_greedy ? done : split + 1);
+  }
+
+  if (!is_greedy)
+  {
+    nfa_ctx_p->unsafe_split_count++;
+  }
+
+  return qmin == 0 || is_nullable;
+} /* re_nfa_compile_group */
+
+/**
+ * Convert an iterated character atom to automaton instructions.
+ *
+ * @return true - if the iterator can match an empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_iterator (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+                         const uint8_t **bc_p) /**< [in, out] pointer to the iterator opcode */
+{
+  const uint8_t *iterator_bc_p = *bc_p;
+  const bool is_greedy = (re_get_opcode (&iterator_bc_p) == RE_OP_GREEDY_ITERATOR);
+  const uint32_t qmin = re_get_value (&iterator_bc_p);
+  const uint32_t qmax = re_get_value (&iterator_bc_p) - RE_QMAX_OFFSET;
+  const uint32_t end_offset = re_get_value (&iterator_bc_p);
+  const uint32_t atom_offset = (uint32_t) (iterator_bc_p - nfa_ctx_p->bytecode_start_p);
+  const bool is_infinite = (qmax == RE_INFINITY);
+
+  *bc_p = iterator_bc_p + end_offset;
+
+  if (qmin > RE_NFA_MAX_INSTRUCTIONS || (!is_infinite && qmax - qmin > RE_NFA_MAX_INSTRUCTIONS))
+  {
+    nfa_ctx_p->failed = true;
+    return false;
+  }
+
+  for (uint32_t i = 0; i < qmin && !nfa_ctx_p->failed; i++)
+  {
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_CHAR, 0, atom_offset);
+  }
+
+  if (qmax > qmin && !is_greedy)
+  {
+    nfa_ctx_p->unsafe_split_count++;
+  }
+
+  if (is_infinite)
+  {
+    const uint32_t split = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SPLIT, 0, 0);
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_CHAR, 0, atom_offset);
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_JUMP, split, 0);
+
+    const uint32_t done = nfa_ctx_p->instruction_count;
+    re_nfa_set_split_targets (nfa_ctx_p, split, is_greedy ? split + 1 : done, is_greedy ? done : split + 1);
+    return qmin == 0;
+  }
+
+  const uint32_t first_split = nfa_ctx_p->instruction_count;
+
+  for (uint32_t i = qmin; i < qmax && !nfa_ctx_p->failed; i++)
+  {
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SPLIT, 0, 0);
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_CHAR, 0, atom_offset);
+  }
+
+  const uint32_t done = nfa_ctx_p->instruction_count;
+
+  for (uint32_t split = first_split; split < done; split += 2)
+  {
+    re_nfa_set_split_targets (nfa_ctx_p, split, is_greedy ? split + 1 : done, is_greedy ? done : split + 1);
+  }
+
+  return qmin == 0;
+} /* re_nfa_compile_iterator */
+
+/**
+ * Convert a sequence of terms to automaton instructions.
+ *
+ * @return true - if the sequence can match an empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_sequence (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+                         const uint8_t **bc_p, /**< [in, out] pointer to the byte code */
+                         const uint8_t *end_p) /**< end of the sequence, NULL if it ends with a terminator */
+{
+  bool is_nullable = true;
+
+  while (*bc_p != end_p && !nfa_ctx_p->failed)
+  {
+    switch (**bc_p)
+    {
+      case RE_OP_EOF:
+      case RE_OP_ALTERNATIVE_NEXT:
+      case RE_OP_GREEDY_CAPTURING_GROUP_END:
+      case RE_OP_GREEDY_NON_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_NON_CAPTURING_GROUP_END:
+      {
+        return is_nullable;
+      }
+      case RE_OP_CAPTURING_GROUP_START:
+      case RE_OP_NON_CAPTURING_GROUP_START:
+      {
+        is_nullable = re_nfa_compile_group (nfa_ctx_p, bc_p) && is_nullable;
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_LAZY_ITERATOR:
+      {
+        is_nullable = re_nfa_compile_iterator (nfa_ctx_p, bc_p) && is_nullable;
+        break;
+      }
+      case RE_OP_ASSERT_LINE_START:
+      case RE_OP_ASSERT_LINE_END:
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        re_nfa_emit (nfa_ctx_p, RE_NFA_OP_ASSERT, re_get_opcode (bc_p), 0);
+        break;
+      }
+      case RE_OP_CLASS_ESCAPE:
+      case RE_OP_CHAR_CLASS:
+      case RE_OP_UNICODE_PERIOD:
+      case RE_OP_PERIOD:
+      case RE_OP_CHAR:
+      case RE_OP_BYTE:
+      {
+        re_nfa_emit (nfa_ctx_p, RE_NFA_OP_CHAR, 0, (uint32_t) (*bc_p - nfa_ctx_p->bytecode_start_p));
+        *bc_p = re_nfa_skip_atom (nfa_ctx_p, *bc_p);
+        is_nullable = false;
+        break;
+      }
+      default:
+      {
+        /* Backreferences and lookahead assertions need backtracking. */
+        nfa_ctx_p->failed = true;
+        break;
+      }
+    }
+  }
+
+  return is_nullable;
+} /* re_nfa_compile_sequence */
+
+/**
+ * Convert a disjunction to automaton instructions.
+ *
+ * @return true - if the disjunction can match an empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_disjunction (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+                            const uint8_t **bc_p) /**< [in, out] pointer to the byte code */
+{
+  if (**bc_p != RE_OP_ALTERNATIVE_START)
+  {
+    return re_nfa_compile_sequence (nfa_ctx_p, bc_p, NULL);
+  }
+
+  bool is_nullable = false;
+  /* The jumps to the end of the disjunction are linked through their targets. */
+  uint32_t jump_list = RE_NFA_MAX_INSTRUCTIONS;
+
+  while (!nfa_ctx_p->failed)
+  {
+    (*bc_p)++;
+    const uint32_t length = re_get_value (bc_p);
+    const uint8_t *alternative_end_p = *bc_p + length;
+
+    if (*alternative_end_p != RE_OP_ALTERNATIVE_NEXT)
+    {
+      is_nullable = re_nfa_compile_sequence (nfa_ctx_p, bc_p, alternative_end_p) || is_nullable;
+      break;
+    }
+
+    const uint32_t split = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SPLIT, 0, 0);
+
+    if (re_nfa_compile_sequence (nfa_ctx_p, bc_p, alternative_end_p))
+    {
+      is_nullable = true;
+      nfa_ctx_p->unsafe_split_count++;
+    }
+
+    jump_list = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_JUMP, jump_list, 0);
+    re_nfa_set_split_targets (nfa_ctx_p, split, split + 1, nfa_ctx_p->instruction_count);
+  }
+
+  if (nfa_ctx_p->instructions_p != NULL && !nfa_ctx_p->failed)
+  {
+    while (jump_list != RE_NFA_MAX_INSTRUCTIONS)
+    {
+      const uint32_t next = nfa_ctx_p->instructions_p[jump_list].arg1;
+      re_nfa_set_jump_target (nfa_ctx_p, jump_list, nfa_ctx_p->instruction_count);
+      jump_list = next;
+    }
+  }
+
+  return is_nullable;
+} /* re_nfa_compile_disjunction */
+
+/**
+ * Convert the byte code of a pattern to an automaton.
+ *
+ * When nfa_p is NULL, only the size of the automaton is computed.
+ *
+ * @return true - if the pattern can be converted to an automaton
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< automaton compiler context */
+                const re_compiled_code_t *re_compiled_code_p, /**< compiled byte code */
+                re_nfa_header_t *nfa_p) /**< [out] automaton */
+{
+  nfa_ctx_p->bytecode_start_p = (const uint8_t *) re_compiled_code_p;
+  nfa_ctx_p->instructions_p = (nfa_p != NULL) ? (re_nfa_instruction_t *) (nfa_p + 1) : NULL;
+  nfa_ctx_p->instruction_count = 0;
+  nfa_ctx_p->thread_count = 0;
+  nfa_ctx_p->stack_size = 1;
+  nfa_ctx_p->unsafe_split_count = 0;
+  nfa_ctx_p->char_size =
+    (re_compiled_code_p->header.status_flags & RE_FLAG_UNICODE) ? sizeof (lit_code_point_t) : sizeof (ecma_char_t);
+  nfa_ctx_p->failed = (re_compiled_code_p->captures_count > UINT16_MAX / 2);
+
+  const uint8_t *bc_p = (const uint8_t *) (re_compiled_code_p + 1);
+
+  re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, 0, 0);
+  re_nfa_compile_disjunction (nfa_ctx_p, &bc_p);
+  re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, 1, 0);
+  re_nfa_emit (nfa_ctx_p, RE_NFA_OP_MATCH, 0, 0);
+
+  if (nfa_ctx_p->failed)
+  {
+    return false;
+  }
+
+  JERRY_ASSERT (*bc_p == RE_OP_EOF);
+
+  if (nfa_p != NULL)
+  {
+    nfa_p->instruction_count = (uint16_t) nfa_ctx_p->instruction_count;
+    nfa_p->thread_count = (uint16_t) nfa_ctx_p->thread_count;
+    nfa_p->stack_size = nfa_ctx_p->stack_size;
+  }
+
+  return true;
+} /* re_nfa_compile */
+
+/**
+ * Lead byte of the CESU-8 encoding of surrogate code units
+ */
+#define RE_SCAN_SURROGATE_LEAD_BYTE 0xed
+
+/**
+ * Context of the start position scan analysis
+ */
+typedef struct
+{
+  uint8_t first_bytes[RE_SCAN_BITMAP_SIZE]; /**< bitmap of the bytes which can start a match */
+  uint8_t prefix[RE_SCAN_MAX_PREFIX_SIZE]; /**< literal prefix of the matches */
+  uint32_t prefix_size; /**< size of the literal prefix */
+  uint16_t flags; /**< RegExp flags */
+  bool is_any; /**< any byte can start a match */
+} re_scan_ctx_t;
+
+/**
+ * Add a byte to the first byte bitmap.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+re_scan_add_byte (re_scan_ctx_t *scan_ctx_p, /**< scan context */
+                  uint32_t byte) /**< byte */
+{
+  JERRY_ASSERT (byte <= UINT8_MAX);
+  scan_ctx_p->first_bytes[byte >> 3] |= (uint8_t) (1u << (byte & 0x7));
+} /* re_scan_add_byte */
+
+/**
+ * Add the first bytes of a character range to the first byte bitmap.
+ *
+ * With the ignore case flag the input characters are canonicalized before they are compared,
+ * so the bytes of all characters with the same canonical form are added. Non-ASCII characters
+ * are not canonicalized to ASCII characters, except U+017F and U+212A in unicode mode.
+ */
+static void
+re_scan_add_range (re_scan_ctx_t *scan_ctx_p, /**< scan context */
+                   lit_code_point_t begin, /**< first character of the range */
+                   lit_code_point_t end) /**< last character of the range */
+{
+  const bool is_ignore_case = (scan_ctx_p->flags & RE_FLAG_IGNORE_CASE) != 0;
+
+  for (lit_code_point_t ch = begin; ch <= end && ch <= LIT_UTF8_1_BYTE_CODE_POINT_MAX; ch++)
+  {
+    re_scan_add_byte (scan_ctx_p, ch);
+
+    const lit_code_point_t lower_ch = ch | 0x20;
+
+    if (is_ignore_case && lower_ch >= LIT_CHAR_LOWERCASE_A && lower_ch <= LIT_CHAR_LOWERCASE_Z)
+    {
+      re_scan_add_byte (scan_ctx_p, ch ^ 0x20);
+
+      if (scan_ctx_p->flags & RE_FLAG_UNICODE)
+      {
+        /* Lead bytes of U+017F and U+212A, which are case folded to 's' and 'k'. */
+        re_scan_add_byte (scan_ctx_p, 0xc5);
+        re_scan_add_byte (scan_ctx_p, 0xe2);
+      }
+    }
+  }
+
+  if (end <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    return;
+  }
+
+  if (is_ignore_case || end > LIT_UTF16_CODE_UNIT_MAX)
+  {
+    /* Characters which are not represented by a single code unit are not tracked. */
+    scan_ctx_p->is_any = (scan_ctx_p->is_any || (scan_ctx_p->flags & RE_FLAG_UNICODE));
+    begin = LIT_UTF8_1_BYTE_CODE_POINT_MAX + 1;
+    end = LIT_UTF16_CODE_UNIT_MAX;
+  }
+  else if (begin <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    begin = LIT_UTF8_1_BYTE_CODE_POINT_MAX + 1;
+  }
+
+  /* The lead byte of the encoded characters grows with the code point. */
+  lit_utf8_byte_t begin_bytes[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+  lit_utf8_byte_t end_bytes[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+  lit_code_unit_to_utf8 ((ecma_char_t) begin, begin_bytes);
+  lit_code_unit_to_utf8 ((ecma_char_t) end, end_bytes);
+
+  for (uint32_t byte = begin_bytes[0]; byte <= end_bytes[0]; byte++)
+  {
+    re_scan_add_byte (scan_ctx_p, byte);
+  }
+} /* re_scan_add_range */
+
+/**
+ * Add the first bytes of a class escape to the first byte bitmap.
+ */
+static void
+re_scan_add_class_escape (re_scan_ctx_t *scan_ctx_p, /**< scan context */
+                          ecma_class_escape_t escape) /**< class escape */
+{
+  switch (escape)
+  {
+    case RE_ESCAPE_DIGIT:
+    {
+      re_scan_add_range (scan_ctx_p, LIT_CHAR_0, LIT_CHAR_9);
+      break;
+    }
+    case RE_ESCAPE_WORD_CHAR:
+    {
+      re_scan_add_range (scan_ctx_p, LIT_CHAR_0, LIT_CHAR_9);
+      re_scan_add_range (scan_ctx_p, LIT_CHAR_UPPERCASE_A, LIT_CHAR_UPPERCASE_Z);
+      re_scan_add_range (scan_ctx_p, LIT_CHAR_UNDERSCORE, LIT_CHAR_UNDERSCORE);
+      re_scan_add_range (scan_ctx_p, LIT_CHAR_LOWERCASE_A, LIT_CHAR_LOWERCASE_Z);
+      break;
+    }
+    case RE_ESCAPE_WHITESPACE:
+    {
+      re_scan_add_range (scan_ctx_p, LIT_CHAR_TAB, LIT_CHAR_CR);
+      re_scan_add_range (scan_ctx_p, LIT_CHAR_SP, LIT_CHAR_SP);
+      /* Non-ASCII white space characters are between these characters. */
+      re_scan_add_range (scan_ctx_p, LIT_CHAR_NBSP, LIT_CHAR_BOM);
+      break;
+    }
+    default:
+    {
+      scan_ctx_p->is_any = true;
+      break;
+    }
+  }
+} /* re_scan_add_class_escape */
+
+/**
+ * Add the first bytes of a character atom to the first byte bitmap.
+ */
+static void
+re_scan_add_atom (re_scan_ctx_t *scan_ctx_p, /**< scan context */
+                  const uint8_t *bc_p) /**< pointer to the atom */
+{
+  const bool is_unicode = (scan_ctx_p->flags & RE_FLAG_UNICODE) != 0;
+
+  switch (re_get_opcode (&bc_p))
+  {
+    case RE_OP_BYTE:
+    {
+      re_scan_add_byte (scan_ctx_p, *bc_p);
+      break;
+    }
+    case RE_OP_CHAR:
+    {
+      const lit_code_point_t ch = re_get_char (&bc_p, is_unicode);
+      re_scan_add_range (scan_ctx_p, ch, ch);
+      break;
+    }
+    case RE_OP_CLASS_ESCAPE:
+    {
+      re_scan_add_class_escape (scan_ctx_p, (ecma_class_escape_t) re_get_byte (&bc_p));
+      break;
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      const uint8_t flags = re_get_byte (&bc_p);
+      uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
+      uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
+      uint32_t escape_count = flags & RE_CLASS_ESCAPE_COUNT_MASK;
+
+      if (flags & RE_CLASS_INVERT)
+      {
+        scan_ctx_p->is_any = true;
+        break;
+      }
+
+      while (escape_count-- > 0)
+      {
+        re_scan_add_class_escape (scan_ctx_p, (ecma_class_escape_t) re_get_byte (&bc_p));
+      }
+
+      while (char_count-- > 0)
+      {
+        const lit_code_point_t ch = re_get_char (&bc_p, is_unicode);
+        re_scan_add_range (scan_ctx_p, ch, ch);
+      }
+
+      while (range_count-- > 0)
+      {
+        const lit_code_point_t begin = re_get_char (&bc_p, is_unicode);
+        const lit_code_point_t end = re_get_char (&bc_p, is_unicode);
+        re_scan_add_range (scan_ctx_p, begin, end);
+      }
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (bc_p[-1] == RE_OP_PERIOD || bc_p[-1] == RE_OP_UNICODE_PERIOD);
+      scan_ctx_p->is_any = true;
+      break;
+    }
+  }
+} /* re_scan_add_atom */
+
+static bool re_scan_disjunction (re_scan_ctx_t *scan_ctx_p, const uint8_t **bc_p);
+
+/**
+ * Add the first bytes of a group to the first byte bitmap.
+ *
+ * @return true - if the group can match an empty string
+ *         false - otherwise
+ */
+static bool
+re_scan_group (re_scan_ctx_t *scan_ctx_p, /**< scan context */
+               const uint8_t **bc_p) /**< [in, out] pointer to the group start opcode */
+{
+  const uint8_t *group_bc_p = *bc_p;
+
+  if (re_get_opcode (&group_bc_p) == RE_OP_NON_CAPTURING_GROUP_START)
+  {
+    re_get_value (&group_bc_p);
+  }
+
+  re_get_value (&group_bc_p);
+  re_get_value (&group_bc_p);
+
+  const uint32_t qmin = re_get_value (&group_bc_p);
+  const uint8_t *end_p = NULL;
+
+  if (qmin == 0)
+  {
+    const uint32_t end_offset = re_get_value (&group_bc_p);
+    end_p = group_bc_p + end_offset;
+  }
+
+  const bool is_nullable = re_scan_disjunction (scan_ctx_p, &group_bc_p);
+
+  if (qmin > 0)
+  {
+    if (!is_nullable)
+    {
+      return false;
+    }
+
+    end_p = group_bc_p;
+  }
+
+  /* Skip the group end opcode and its arguments. */
+  re_get_opcode (&end_p);
+  re_get_value (&end_p);
+  re_get_value (&end_p);
+  re_get_value (&end_p);
+  *bc_p = end_p;
+  return true;
+} /* re_scan_group */
+
+/**
+ * Add the first bytes of a sequence of terms to the first byte bitmap. The terms
+ * after the first term which cannot match an empty string are not processed.
+ *
+ * @return true - if the sequence can match an empty string
+ *         false - otherwise
+ */
+static bool
+re_scan_sequence (re_scan_ctx_t *scan_ctx_p, /**< scan context */
+                  const uint8_t **bc_p, /**< [in, out] pointer to the byte code */
+                  const uint8_t *end_p) /**< end of the sequence, NULL if it ends with a terminator */
+{
+  while (*bc_p != end_p && !scan_ctx_p->is_any)
+  {
+    switch (**bc_p)
+    {
+      case RE_OP_EOF:
+      case RE_OP_ALTERNATIVE_NEXT:
+      case RE_OP_GREEDY_CAPTURING_GROUP_END:
+      case RE_OP_GREEDY_NON_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_NON_CAPTURING_GROUP_END:
+      {
+        return true;
+      }
+      case RE_OP_CAPTURING_GROUP_START:
+      case RE_OP_NON_CAPTURING_GROUP_START:
+      {
+        if (!re_scan_group (scan_ctx_p, bc_p))
+        {
+          return false;
+        }
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_LAZY_ITERATOR:
+      {
+        const uint8_t *iterator_bc_p = *bc_p + 1;
+        const uint32_t qmin = re_get_value (&iterator_bc_p);
+        re_get_value (&iterator_bc_p);
+        const uint32_t end_offset = re_get_value (&iterator_bc_p);
+
+        re_scan_add_atom (scan_ctx_p, iterator_bc_p);
+
+        if (qmin > 0)
+        {
+          return false;
+        }
+
+        *bc_p = iterator_bc_p + end_offset;
+        break;
+      }
+      case RE_OP_ASSERT_LINE_START:
+      case RE_OP_ASSERT_LINE_END:
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        (*bc_p)++;
+        break;
+      }
+      case RE_OP_ASSERT_LOOKAHEAD_POS:
+      case RE_OP_ASSERT_LOOKAHEAD_NEG:
+      {
+        /* Lookahead assertions do not consume characters. */
+        const uint8_t *assert_bc_p = *bc_p + 2;
+        re_get_value (&assert_bc_p);
+        re_get_value (&assert_bc_p);
+        const uint32_t end_offset = re_get_value (&assert_bc_p);
+        *bc_p = assert_bc_p + end_offset;
+        break;
+      }
+      case RE_OP_BACKREFERENCE:
+      {
+        scan_ctx_p->is_any = true;
+        return false;
+      }
+      default:
+      {
+        re_scan_add_atom (scan_ctx_p, *bc_p);
+        return false;
+      }
+    }
+  }
+
+  return true;
+} /* re_scan_sequence */
+
+/**
+ * Add the first bytes of a disjunction to the first byte bitmap.
+ *
+ * @return true - if the disjunction can match an empty string
+ *         false - otherwise
+ */
+static bool
+re_scan_disjunction (re_scan_ctx_t *scan_ctx_p, /**< scan context */
+                     const uint8_t **bc_p) /**< [in, out] pointer to the byte code */
+{
+  if (**bc_p != RE_OP_ALTERNATIVE_START)
+  {
+    return re_scan_sequence (scan_ctx_p, bc_p, NULL);
+  }
+
+  bool is_nullable = false;
+
+  do
+  {
+    (*bc_p)++;
+    const uint32_t length = re_get_value (bc_p);
+    const uint8_t *alternative_p = *bc_p;
+
+    *bc_p += length;
+    is_nullable = re_scan_sequence (scan_ctx_p, &alternative_p, *bc_p) || is_nullable;
+  } while (**bc_p == RE_OP_ALTERNATIVE_NEXT);
+
+  return is_nullable;
+} /* re_scan_disjunction */
+
+/**
+ * Checks whether all alternatives of a pattern start with a line start assertion.
+ *
+ * @return true - if the pattern is anchored
+ *         false - otherwise
+ */
+static bool
+re_scan_is_anchored (const uint8_t *bc_p) /**< pointer to the byte code */
+{
+  if (*bc_p != RE_OP_ALTERNATIVE_START)
+  {
+    return *bc_p == RE_OP_ASSERT_LINE_START;
+  }
+
+  do
+  {
+    bc_p++;
+    const uint32_t length = re_get_value (&bc_p);
+
+    if (*bc_p != RE_OP_ASSERT_LINE_START)
+    {
+      return false;
+    }
+
+    bc_p += length;
+  } while (*bc_p == RE_OP_ALTERNATIVE_NEXT);
+
+  return true;
+} /* re_scan_is_anchored */
+
+/**
+ * Collect the literal prefix of a pattern.
+ */
+static void
+re_scan_get_prefix (re_scan_ctx_t *scan_ctx_p, /**< scan context */
+                    const uint8_t *bc_p) /**< pointer to the byte code */
+{
+  scan_ctx_p->prefix_size = 0;
+
+  if (scan_ctx_p->flags & RE_FLAG_IGNORE_CASE)
+  {
+    return;
+  }
+
+  while (true)
+  {
+    lit_utf8_byte_t char_bytes[LIT_CESU8_MAX_BYTES_IN_CODE_POINT];
+    lit_utf8_size_t char_size;
+    const re_opcode_t opcode = re_get_opcode (&bc_p);
+
+    if (opcode == RE_OP_BYTE)
+    {
+      char_bytes[0] = re_get_byte (&bc_p);
+      char_size = 1;
+    }
+    else if (opcode == RE_OP_CHAR)
+    {
+      char_size = lit_code_point_to_cesu8 (re_get_char (&bc_p, scan_ctx_p->flags & RE_FLAG_UNICODE), char_bytes);
+    }
+    else
+    {
+      break;
+    }
+
+    if (scan_ctx_p->prefix_size + char_size > RE_SCAN_MAX_PREFIX_SIZE)
+    {
+      break;
+    }
+
+    memcpy (scan_ctx_p->prefix + scan_ctx_p->prefix_size, char_bytes, char_size);
+    scan_ctx_p->prefix_size += char_size;
+  }
+
+  if ((scan_ctx_p->flags & RE_FLAG_UNICODE) && scan_ctx_p->prefix_size > 0
+      && scan_ctx_p->prefix[0] == RE_SCAN_SURROGATE_LEAD_BYTE)
+  {
+    /* A prefix starting with a surrogate code unit could be found in the middle of a surrogate pair. */
+    scan_ctx_p->prefix_size = 0;
+  }
+} /* re_scan_get_prefix */
+
+/**
+ * Compute the start position scan of a pattern, which is used for skipping
+ * the positions where a match cannot start.
+ *
+ * @return type of the scan
+ */
+static re_scan_type_t
+re_scan_compute (re_scan_ctx_t *scan_ctx_p, /**< [out] scan context */
+                 const re_compiled_code_t *re_compiled_code_p) /**< compiled byte code */
+{
+  const uint8_t *bc_p = (const uint8_t *) (re_compiled_code_p + 1);
+  scan_ctx_p->flags = re_compiled_code_p->header.status_flags;
+  scan_ctx_p->is_any = false;
+  memset (scan_ctx_p->first_bytes, 0, RE_SCAN_BITMAP_SIZE);
+
+  if (scan_ctx_p->flags & RE_FLAG_STICKY)
+  {
+    /* Sticky patterns are matched only at a single position. */
+    return RE_SCAN_ANY;
+  }
+
+  if (!(scan_ctx_p->flags & RE_FLAG_MULTILINE) && re_scan_is_anchored (bc_p))
+  {
+    return RE_SCAN_INPUT_START;
+  }
+
+  re_scan_get_prefix (scan_ctx_p, bc_p);
+
+  if (scan_ctx_p->prefix_size > 0)
+  {
+    return RE_SCAN_PREFIX;
+  }
+
+  const bool is_nullable = re_scan_disjunction (scan_ctx_p, &bc_p);
+  if ((scan_ctx_p->flags & RE_FLAG_UNICODE)
+      && (scan_ctx_p->first_bytes[RE_SCAN_SURROGATE_LEAD_BYTE >> 3] & (1u << (RE_SCAN_SURROGATE_LEAD_BYTE & 0x7))))
+  {
+    /* The low surrogate of a surrogate pair could be found. */
+    scan_ctx_p->is_any = true;
+  }
+
+  if (is_nullable || scan_ctx_p->is_any)
+  {
+    return RE_SCAN_ANY;
+  }
+
+  return RE_SCAN_FIRST_BYTES;
+} /* re_scan_compute */
+
 /**
  * Compilation of RegExp bytecode
  *
@@ -140,10 +1197,74 @@ re_compile_bytecode (ecma_string_t *pattern_str_p, /**< pattern */
     return NULL;
   }
 
+  re_compiled_code_t *re_compiled_code_p = (re_compiled_code_t *) re_ctx.bytecode_start_p;
+  re_compiled_code_p->header.status_flags = re_ctx.flags;
+  re_compiled_code_p->captures_count = re_ctx.captures_count;
+
+  re_scan_ctx_t scan_ctx;
+  re_scan_type_t scan_type = re_scan_compute (&scan_ctx, re_compiled_code_p);
+  const uint32_t scan_offset = (uint32_t) re_ctx.bytecode_size;
+  uint32_t scan_size = 0;
+
+  if (scan_type == RE_SCAN_PREFIX)
+  {
+    scan_size = scan_ctx.prefix_size;
+  }
+  else if (scan_type == RE_SCAN_FIRST_BYTES)
+  {
+    scan_size = RE_SCAN_BITMAP_SIZE;
+  }
+
+  /* Patterns which can be converted to an automaton are matched in linear time. */
+  re_nfa_compiler_ctx_t nfa_ctx;
+  uint32_t nfa_offset = (uint32_t) JERRY_ALIGNUP (scan_offset + scan_size, sizeof (uint32_t));
+  uint32_t final_size = scan_offset + scan_size;
+
+  if (re_nfa_compile (&nfa_ctx, re_compiled_code_p, NULL))
+  {
+    final_size = nfa_offset + (uint32_t) sizeof (re_nfa_header_t)
+                 + nfa_ctx.instruction_count * (uint32_t) sizeof (re_nfa_instruction_t);
+  }
+  else
+  {
+    nfa_offset = 0;
+  }
+
+  if (JERRY_ALIGNUP (final_size, JMEM_ALIGNMENT) > ((uint32_t) UINT16_MAX << JMEM_ALIGNMENT_LOG))
+  {
+    final_size = scan_offset;
+    scan_type = RE_SCAN_ANY;
+    scan_size = 0;
+    nfa_offset = 0;
+  }
+
   /* Align bytecode size to JMEM_ALIGNMENT so that it can be stored in the bytecode header. */
-  const uint32_t final_size = JERRY_ALIGNUP (re_ctx.bytecode_size, JMEM_ALIGNMENT);
-  re_compiled_code_t *re_compiled_code_p =
+  final_size = JERRY_ALIGNUP (final_size, JMEM_ALIGNMENT);
+  re_compiled_code_p =
     (re_compiled_code_t *) jmem_heap_realloc_block (re_ctx.bytecode_start_p, re_ctx.bytecode_size, final_size);
+  re_ctx.bytecode_start_p = (uint8_t *) re_compiled_code_p;
+  re_compiled_code_p->nfa_offset = nfa_offset;
+  re_compiled_code_p->scan_offset = scan_offset;
+  re_compiled_code_p->scan_type = (uint8_t) scan_type;
+  re_compiled_code_p->prefix_size = 0;
+
+  if (scan_type == RE_SCAN_PREFIX)
+  {
+    re_compiled_code_p->prefix_size = (uint8_t) scan_size;
+    memcpy (((uint8_t *) re_compiled_code_p) + scan_offset, scan_ctx.prefix, scan_size);
+  }
+  else if (scan_type == RE_SCAN_FIRST_BYTES)
+  {
+    memcpy (((uint8_t *) re_compiled_code_p) + scan_offset, scan_ctx.first_bytes, scan_size);
+  }
+
+  if (nfa_offset != 0)
+  {
+    re_nfa_header_t *nfa_p = (re_nfa_header_t *) (((uint8_t *) re_compiled_code_p) + nfa_offset);
+    bool is_compiled = re_nfa_compile (&nfa_ctx, re_compiled_code_p, nfa_p);
+    JERRY_ASSERT (is_compiled);
+    JERRY_UNUSED (is_compiled);
+  }
 
   /* Bytecoded will be inserted into the cache and returned to the caller, so refcount is implicitly set to 2. */
   re_compiled_code_p->header.refs = 2;
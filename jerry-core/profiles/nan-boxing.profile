@@ -0,0 +1,2 @@
+# All features are enabled, numbers are stored in 64 bit NaN-boxed values.
+JERRY_NAN_BOXING=1
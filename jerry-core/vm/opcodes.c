@@ -30,6 +30,7 @@
 #include "ecma-objects.h"
 #include "ecma-promise-object.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 
 #include "jcontext.h"
 #include "vm-defines.h"
@@ -150,6 +151,7 @@ opfunc_set_accessor (bool is_getter, /**< is getter accessor */
 
       ecma_free_value_if_not_object (prop_value_p->value);
       *property_p = (uint8_t) (*property_p & ~(ECMA_PROPERTY_FLAG_DATA | ECMA_PROPERTY_FLAG_WRITABLE));
+      ECMA_GC_REMEMBER_OBJECT (accessor_p);
 
 #if JERRY_CPOINTER_32_BIT
       ECMA_SET_POINTER (getter_setter_pair_p->getter_cp, getter_func_p);
@@ -520,6 +522,7 @@ opfunc_append_array (ecma_value_t *stack_top_p, /**< current stack top */
       {
         filled_holes++;
 
+        ECMA_GC_REMEMBER_VALUE (stack_top_p[i]);
         ecma_deref_if_object (stack_top_p[i]);
       }
     }
@@ -548,6 +551,7 @@ opfunc_append_array (ecma_value_t *stack_top_p, /**< current stack top */
 
         ecma_deref_ecma_string (index_str_p);
         prop_value_p->value = stack_top_p[i];
+        ECMA_GC_REMEMBER_VALUE (stack_top_p[i]);
         ecma_deref_if_object (stack_top_p[i]);
       }
     }
@@ -778,10 +782,14 @@ opfunc_resume_executable_object (vm_executable_object_t *executable_object_p, /*
   register_p = VM_GET_REGISTERS (&executable_object_p->frame_ctx);
   stack_top_p = executable_object_p->frame_ctx.stack_top_p;
 
+  /* The suspended frame is referenced by the executable object only. */
+  ECMA_GC_REMEMBER_OBJECT (executable_object_p->frame_ctx.lex_env_p);
+
   if (executable_object_p->frame_ctx.context_depth > 0)
   {
     while (register_p < register_end_p)
     {
+      ECMA_GC_REMEMBER_VALUE (*register_p);
       ecma_deref_if_object (*register_p++);
     }
 
@@ -795,9 +803,11 @@ opfunc_resume_executable_object (vm_executable_object_t *executable_object_p, /*
 
   while (register_p < stack_top_p)
   {
+    ECMA_GC_REMEMBER_VALUE (*register_p);
     ecma_deref_if_object (*register_p++);
   }
 
+  ECMA_GC_REMEMBER_VALUE (executable_object_p->iterator);
   ecma_deref_if_object (executable_object_p->iterator);
 
   return result;
@@ -871,6 +881,7 @@ opfunc_async_create_and_await (vm_frame_ctx_t *frame_ctx_p, /**< frame context *
 
   JERRY_ASSERT (ecma_is_value_object (result));
   executable_object_p->iterator = result;
+  ECMA_GC_REMEMBER_VALUE (result);
 
   return result;
 } /* opfunc_async_create_and_await */
@@ -902,7 +913,7 @@ opfunc_private_method_or_accessor_add (ecma_object_t *class_object_p, /**< the f
 
   while (current_p < end_p)
   {
-    uint32_t prop_desc = *current_p++;
+    uint32_t prop_desc = (uint32_t) *current_p++;
     ecma_private_property_kind_t kind = ECMA_PRIVATE_PROPERTY_KIND (prop_desc);
 
     if ((prop_desc & ECMA_PRIVATE_PROPERTY_STATIC_FLAG) != static_flag || kind == ECMA_PRIVATE_FIELD)
@@ -929,6 +940,7 @@ opfunc_private_method_or_accessor_add (ecma_object_t *class_object_p, /**< the f
       ecma_property_value_t *prop_value_p =
         ecma_create_named_data_property (this_obj_p, prop_name_p, ECMA_PROPERTY_FIXED, NULL);
       prop_value_p->value = method;
+      ECMA_GC_REMEMBER_VALUE (method);
       continue;
     }
 
@@ -942,6 +954,7 @@ opfunc_private_method_or_accessor_add (ecma_object_t *class_object_p, /**< the f
 
     ecma_property_value_t *accessor_objs_p = ECMA_PROPERTY_VALUE_PTR (prop_p);
     ecma_getter_setter_pointers_t *get_set_pair_p = ecma_get_named_accessor_property (accessor_objs_p);
+    ECMA_GC_REMEMBER_OBJECT (method_p);
 
     if (kind == ECMA_PRIVATE_GETTER)
     {
@@ -1193,6 +1206,7 @@ opfunc_set_home_object (ecma_object_t *func_p, /**< function object */
   if (ecma_get_object_type (func_p) == ECMA_OBJECT_TYPE_FUNCTION)
   {
     ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) func_p;
+    ECMA_GC_REMEMBER_OBJECT (parent_env_p);
     ECMA_SET_NON_NULL_POINTER_TAG (ext_func_p->u.function.scope_cp,
                                    parent_env_p,
                                    JMEM_CP_GET_POINTER_TAG_BITS (ext_func_p->u.function.scope_cp));
@@ -1731,6 +1745,13 @@ opfunc_init_class (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
   ecma_object_t *proto_p = ecma_create_object (proto_parent_p, 0, ECMA_OBJECT_TYPE_GENERAL);
   ecma_value_t proto = ecma_make_object_value (proto_p);
 
+#if JERRY_GC_GENERATIONAL
+  if (ctor_parent_p != NULL)
+  {
+    ecma_gc_remember_object (ctor_parent_p);
+  }
+#endif /* JERRY_GC_GENERATIONAL */
+
   ECMA_SET_POINTER (ctor_p->u2.prototype_cp, ctor_parent_p);
 
   if (free_proto_parent)
@@ -1746,6 +1767,7 @@ opfunc_init_class (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
                                                       ECMA_PROPERTY_FIXED,
                                                       NULL);
   property_value_p->value = proto;
+  ECMA_GC_REMEMBER_VALUE (proto);
 
   /* 18. */
   property_value_p = ecma_create_named_data_property (proto_p,
@@ -1753,6 +1775,7 @@ opfunc_init_class (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
                                                       ECMA_PROPERTY_CONFIGURABLE_WRITABLE,
                                                       NULL);
   property_value_p->value = ecma_make_object_value (ctor_p);
+  ECMA_GC_REMEMBER_OBJECT (ctor_p);
 
   if (ecma_get_object_type (ctor_p) == ECMA_OBJECT_TYPE_FUNCTION)
   {
@@ -1791,6 +1814,7 @@ opfunc_bind_class_environment (ecma_object_t *lex_env_p, /**< lexical environmen
   if (func_obj_p)
   {
     JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION);
+    ECMA_GC_REMEMBER_OBJECT (proto_env_p);
     ECMA_SET_NON_NULL_POINTER_TAG (((ecma_extended_object_t *) func_obj_p)->u.function.scope_cp, proto_env_p, 0);
     ecma_deref_object (proto_env_p);
     return NULL;
@@ -1808,6 +1832,16 @@ opfunc_set_class_attributes (ecma_object_t *obj_p, /**< object */
 {
   jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
 
+#if JERRY_OBJECT_SHAPES
+  if (prop_iter_cp != JMEM_CP_NULL
+      && ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp)->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+  {
+    /* Class prototypes are rarely shared, so they are converted to property lists. */
+    ecma_shape_convert_to_property_list (obj_p, NULL);
+    prop_iter_cp = obj_p->u1.property_list_cp;
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
 #if JERRY_PROPERTY_HASHMAP
   if (prop_iter_cp != JMEM_CP_NULL)
   {
@@ -15,6 +15,7 @@
 #ifndef VM_DEFINES_H
 #define VM_DEFINES_H
 
+#include "ecma-builtins.h"
 #include "ecma-globals.h"
 
 #include "byte-code.h"
@@ -50,6 +51,9 @@ typedef enum
   VM_FRAME_CTX_SHARED_HAS_CLASS_FIELDS = (1 << 6), /**< has class fields */
   VM_FRAME_CTX_SHARED_EXECUTABLE = (1 << 7), /**< frame is an executable object constructed
                                               *   with opfunc_create_executable_object */
+#if JERRY_VM_STACKLESS
+  VM_FRAME_CTX_SHARED_STACKLESS = (1 << 8), /**< frame is allocated on the vm call stack */
+#endif /* JERRY_VM_STACKLESS */
 } vm_frame_ctx_shared_flags_t;
 
 /**
@@ -115,6 +119,62 @@ typedef struct vm_frame_ctx_t
   /* Registers start immediately after the frame context. */
 } vm_frame_ctx_t;
 
+#if JERRY_VM_STACKLESS
+
+/**
+ * Minimum size of a segment of the vm call stack.
+ */
+#define VM_CALL_STACK_SEGMENT_SIZE 2048
+
+/**
+ * Segment of the vm call stack, which holds the frames of the stackless calls.
+ */
+typedef struct vm_call_stack_segment_t
+{
+  struct vm_call_stack_segment_t *prev_p; /**< previous segment */
+  uint32_t size; /**< size of the segment */
+  uint32_t top; /**< offset of the first free byte of the segment */
+} vm_call_stack_segment_t;
+
+/**
+ * Data of a stackless call, which is followed by the frame context
+ * of the callee on the vm call stack.
+ */
+typedef struct
+{
+  vm_frame_ctx_shared_args_t shared_args; /**< shared data of the call */
+  ecma_object_t *scope_p; /**< lexical environment of the call */
+  ecma_object_t *saved_new_target_p; /**< new.target of the caller */
+#if JERRY_BUILTIN_REALMS
+  ecma_global_object_t *saved_global_object_p; /**< realm of the caller */
+#endif /* JERRY_BUILTIN_REALMS */
+  uint32_t size; /**< size of the call data and the frame on the vm call stack */
+} vm_stackless_call_t;
+
+#endif /* JERRY_VM_STACKLESS */
+
+#if JERRY_VM_PROPERTY_CACHE
+
+/**
+ * Number of entries in the property cache of the vm (must be a power of 2).
+ *
+ * Note:
+ *      even entries are used by property reads, odd entries by property writes
+ */
+#define VM_PROPERTY_CACHE_SIZE 256
+
+/**
+ * Property cache entry, selected by the address of the instruction which accesses the property.
+ */
+typedef struct
+{
+  uint8_t position; /**< index of the property pair in the property list shifted left by one,
+                     *   plus the index of the property in the pair */
+  uint8_t skip_count; /**< number of skipped cache lookups when the property was not found */
+} vm_property_cache_entry_t;
+
+#endif /* JERRY_VM_PROPERTY_CACHE */
+
 /**
  * Get register list corresponding to the frame context.
  */
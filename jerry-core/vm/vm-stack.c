@@ -145,7 +145,7 @@ vm_stack_context_abort (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 
       ecma_value_t *buffer_p = collection_p->buffer_p;
 
-      for (uint32_t index = vm_stack_top_p[-3]; index < collection_p->item_count; index++)
+      for (uint32_t index = (uint32_t) vm_stack_top_p[-3]; index < collection_p->item_count; index++)
       {
         ecma_free_value (buffer_p[index]);
       }
@@ -490,6 +490,7 @@ vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment
       }
       else
       {
+        ECMA_GC_REMEMBER_OBJECT (lex_env_p);
         ecma_deref_object (lex_env_p);
       }
 
@@ -510,6 +511,7 @@ vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment
         }
         else
         {
+          ECMA_GC_REMEMBER_VALUE (context_top_p[-1]);
           ecma_deref_if_object (*(--context_top_p));
         }
       } while (context_top_p > last_item_p);
@@ -529,6 +531,7 @@ vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment
       }
       else
       {
+        ECMA_GC_REMEMBER_VALUE (context_top_p[offset]);
         ecma_deref_if_object (context_top_p[offset]);
       }
 
@@ -540,6 +543,132 @@ vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment
   } while (context_top_p > context_end_p);
 } /* vm_ref_lex_env_chain */
 
+#if JERRY_VM_STACKLESS
+
+/**
+ * Heap usage limit for allocating new vm call stack segments. The rest of the
+ * heap is reserved for the objects created by the callees and for the error
+ * thrown when the limit is reached.
+ */
+#define VM_CALL_STACK_HEAP_LIMIT (CONFIG_MEM_HEAP_SIZE - CONFIG_MEM_HEAP_SIZE / 8)
+
+/**
+ * Allocate a block on the vm call stack.
+ *
+ * Note:
+ *      blocks must be released in reverse allocation order
+ *
+ * @return pointer to the allocated block - if success
+ *         NULL - if the vm call stack limit is reached or there is not enough memory
+ */
+void *
+vm_call_stack_alloc (uint32_t size) /**< size of the block */
+{
+  JERRY_ASSERT (size == JERRY_ALIGNUP (size, JMEM_ALIGNMENT));
+
+  vm_call_stack_segment_t *segment_p = JERRY_CONTEXT (vm_call_stack_p);
+
+  if (JERRY_LIKELY (segment_p != NULL && size <= segment_p->size - segment_p->top))
+  {
+    uint8_t *block_p = ((uint8_t *) segment_p) + segment_p->top;
+    segment_p->top += size;
+    return block_p;
+  }
+
+  uint32_t segment_size = (uint32_t) (size + sizeof (vm_call_stack_segment_t));
+  segment_size = JERRY_MAX (segment_size, VM_CALL_STACK_SEGMENT_SIZE);
+
+  vm_call_stack_segment_t *new_segment_p = JERRY_CONTEXT (vm_call_stack_free_p);
+
+  if (new_segment_p != NULL && new_segment_p->size >= segment_size)
+  {
+    JERRY_CONTEXT (vm_call_stack_free_p) = NULL;
+  }
+  else
+  {
+    vm_call_stack_free_unused ();
+
+#if (JERRY_STACK_LIMIT != 0)
+    /* The frames of the stackless calls are counted as stack usage. */
+    if (ecma_get_current_stack_usage () + JERRY_CONTEXT (vm_call_stack_size) + segment_size > CONFIG_MEM_STACK_LIMIT)
+    {
+      return NULL;
+    }
+#endif /* (JERRY_STACK_LIMIT != 0) */
+
+    if (JERRY_CONTEXT (jmem_heap_allocated_size) + segment_size > VM_CALL_STACK_HEAP_LIMIT)
+    {
+      ecma_gc_run ();
+
+      if (JERRY_CONTEXT (jmem_heap_allocated_size) + segment_size > VM_CALL_STACK_HEAP_LIMIT)
+      {
+        return NULL;
+      }
+    }
+
+    new_segment_p = (vm_call_stack_segment_t *) jmem_heap_alloc_block_null_on_error (segment_size);
+
+    if (new_segment_p == NULL)
+    {
+      return NULL;
+    }
+
+    new_segment_p->size = segment_size;
+    JERRY_CONTEXT (vm_call_stack_size) += segment_size;
+  }
+
+  new_segment_p->prev_p = segment_p;
+  new_segment_p->top = (uint32_t) (sizeof (vm_call_stack_segment_t) + size);
+  JERRY_CONTEXT (vm_call_stack_p) = new_segment_p;
+  return new_segment_p + 1;
+} /* vm_call_stack_alloc */
+
+/**
+ * Release the last block allocated on the vm call stack.
+ */
+void
+vm_call_stack_free (void *block_p, /**< block allocated by vm_call_stack_alloc */
+                    uint32_t size) /**< size of the block */
+{
+  vm_call_stack_segment_t *segment_p = JERRY_CONTEXT (vm_call_stack_p);
+
+  JERRY_ASSERT (segment_p != NULL);
+  JERRY_ASSERT (((uint8_t *) block_p) + size == ((uint8_t *) segment_p) + segment_p->top);
+  JERRY_UNUSED (block_p);
+
+  segment_p->top -= size;
+
+  if (segment_p->top > sizeof (vm_call_stack_segment_t))
+  {
+    return;
+  }
+
+  /* The empty segment is kept for the next calls, which avoids
+   * repeated allocations when the call depth oscillates around
+   * the end of a segment. */
+  JERRY_CONTEXT (vm_call_stack_p) = segment_p->prev_p;
+  vm_call_stack_free_unused ();
+  JERRY_CONTEXT (vm_call_stack_free_p) = segment_p;
+} /* vm_call_stack_free */
+
+/**
+ * Release the unused segment of the vm call stack.
+ */
+void
+vm_call_stack_free_unused (void)
+{
+  vm_call_stack_segment_t *segment_p = JERRY_CONTEXT (vm_call_stack_free_p);
+
+  if (segment_p != NULL)
+  {
+    JERRY_CONTEXT (vm_call_stack_free_p) = NULL;
+    JERRY_CONTEXT (vm_call_stack_size) -= segment_p->size;
+    jmem_heap_free_block (segment_p, segment_p->size);
+  }
+} /* vm_call_stack_free_unused */
+
+#endif /* JERRY_VM_STACKLESS */
+
 /**
  * @}
  * @}
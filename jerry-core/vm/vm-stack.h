@@ -45,7 +45,7 @@
 /**
  * Get the end position of a vm context.
  */
-#define VM_GET_CONTEXT_END(value) ((value) >> 7)
+#define VM_GET_CONTEXT_END(value) ((uint32_t) ((value) >> 7))
 
 /**
  * This flag is set if the context has a lexical environment.
@@ -132,6 +132,12 @@ vm_stack_found_type vm_stack_find_finally (vm_frame_ctx_t *frame_ctx_p,
 uint32_t vm_get_context_value_offsets (ecma_value_t *context_item_p);
 void vm_ref_lex_env_chain (ecma_object_t *lex_env_p, uint16_t context_depth, ecma_value_t *context_end_p, bool do_ref);
 
+#if JERRY_VM_STACKLESS
+void *vm_call_stack_alloc (uint32_t size);
+void vm_call_stack_free (void *block_p, uint32_t size);
+void vm_call_stack_free_unused (void);
+#endif /* JERRY_VM_STACKLESS */
+
 /**
  * @}
  * @}
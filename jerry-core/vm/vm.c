@@ -35,6 +35,7 @@
 #include "ecma-objects.h"
 #include "ecma-promise-object.h"
 #include "ecma-regexp-object.h"
+#include "ecma-shape.h"
 
 #include "common.h"
 #include "jcontext.h"
@@ -51,6 +52,177 @@
 JERRY_STATIC_ASSERT ((sizeof (vm_frame_ctx_t) % sizeof (ecma_value_t)) == 0,
                      sizeof_vm_frame_ctx_must_be_sizeof_ecma_value_t_aligned);
 
+#if JERRY_VM_PROPERTY_CACHE
+
+/**
+ * Number of property pairs searched when a property cache entry is updated.
+ */
+#define VM_PROPERTY_CACHE_MAX_PAIRS 8
+
+/**
+ * Position of properties which are not found in the first VM_PROPERTY_CACHE_MAX_PAIRS pairs.
+ */
+#define VM_PROPERTY_CACHE_NO_POSITION UINT8_MAX
+
+/**
+ * Number of cache lookups skipped after a failed search.
+ */
+#define VM_PROPERTY_CACHE_SKIP_COUNT 16
+
+/**
+ * Find an own property of an object using the property cache entry of an instruction.
+ *
+ * Objects created by the same code usually have the same property layout, so the
+ * position of the property is remembered instead of the object. The name stored in
+ * the property pair is always compared, so no invalidation is needed when properties
+ * are added or deleted. Property names are compared by reference, hence equal names
+ * stored in different strings are not found.
+ *
+ * @return pointer to the property - if found
+ *         NULL - otherwise
+ */
+static ecma_property_t *
+vm_property_cache_find (const uint8_t *byte_code_p, /**< instruction which accesses the property */
+                        bool is_write, /**< property write */
+                        ecma_object_t *object_p, /**< object */
+                        ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (ecma_get_object_base_type (object_p) == ECMA_OBJECT_BASE_TYPE_GENERAL);
+
+  uintptr_t entry_index = (((uintptr_t) byte_code_p << 1) | (uintptr_t) is_write) & (VM_PROPERTY_CACHE_SIZE - 1);
+  vm_property_cache_entry_t *entry_p = JERRY_CONTEXT (vm_property_cache) + entry_index;
+
+  if (entry_p->position == VM_PROPERTY_CACHE_NO_POSITION && entry_p->skip_count > 0)
+  {
+    entry_p->skip_count--;
+    return NULL;
+  }
+
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  if (prop_iter_cp == JMEM_CP_NULL)
+  {
+    return NULL;
+  }
+
+  ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+#if JERRY_PROPERTY_HASHMAP
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_cp = prop_iter_p->next_property_cp;
+
+    if (prop_iter_cp == JMEM_CP_NULL)
+    {
+      return NULL;
+    }
+
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+  }
+#endif /* JERRY_PROPERTY_HASHMAP */
+
+  ecma_property_t name_type = ECMA_DIRECT_STRING_PTR;
+  jmem_cpointer_t name_cp;
+
+  if (JERRY_UNLIKELY (ECMA_IS_DIRECT_STRING (property_name_p)))
+  {
+    name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (property_name_p);
+    name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (property_name_p);
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (name_cp, property_name_p);
+  }
+
+#if JERRY_OBJECT_SHAPES
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+  {
+    /* The position is the index of the property, which is the same for all objects with the same shape. */
+    ecma_shape_property_list_t *list_p = (ecma_shape_property_list_t *) prop_iter_p;
+    ecma_shape_t *shape_p = ECMA_SHAPE_FROM_LIST (list_p);
+    uint32_t index = entry_p->position;
+
+    if (index < shape_p->property_count)
+    {
+      ecma_shape_names_t *names_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_names_t, shape_p->names_cp);
+
+      if (ECMA_SHAPE_GET_NAMES (names_p)[index] == name_cp
+          && ECMA_PROPERTY_GET_NAME_TYPE (ECMA_SHAPE_GET_NAME_TYPES (names_p)[index]) == name_type)
+      {
+        return ECMA_SHAPE_GET_PROPERTY (ECMA_SHAPE_GET_PAIRS (list_p), index);
+      }
+    }
+
+    index = ecma_shape_find_property_index (shape_p, property_name_p);
+
+    if (index != ECMA_SHAPE_PROPERTY_NOT_FOUND)
+    {
+      entry_p->position = (uint8_t) index;
+      return ECMA_SHAPE_GET_PROPERTY (ECMA_SHAPE_GET_PAIRS (list_p), index);
+    }
+
+    entry_p->position = VM_PROPERTY_CACHE_NO_POSITION;
+    entry_p->skip_count = VM_PROPERTY_CACHE_SKIP_COUNT;
+    return NULL;
+  }
+#endif /* JERRY_OBJECT_SHAPES */
+
+  if (entry_p->position != VM_PROPERTY_CACHE_NO_POSITION)
+  {
+    ecma_property_header_t *pair_iter_p = prop_iter_p;
+    uint32_t pair_index = (uint32_t) (entry_p->position >> 1);
+
+    while (pair_index > 0 && pair_iter_p->next_property_cp != JMEM_CP_NULL)
+    {
+      pair_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, pair_iter_p->next_property_cp);
+      pair_index--;
+    }
+
+    if (pair_index == 0)
+    {
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (pair_iter_p));
+
+      uint32_t index = (uint32_t) (entry_p->position & 0x1);
+
+      if (((ecma_property_pair_t *) pair_iter_p)->names_cp[index] == name_cp
+          && ECMA_PROPERTY_GET_NAME_TYPE (pair_iter_p->types[index]) == name_type)
+      {
+        return pair_iter_p->types + index;
+      }
+    }
+  }
+
+  for (uint32_t pair_index = 0; pair_index < VM_PROPERTY_CACHE_MAX_PAIRS; pair_index++)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (uint32_t index = 0; index < ECMA_PROPERTY_PAIR_ITEM_COUNT; index++)
+    {
+      if (prop_pair_p->names_cp[index] == name_cp
+          && ECMA_PROPERTY_GET_NAME_TYPE (prop_iter_p->types[index]) == name_type)
+      {
+        entry_p->position = (uint8_t) ((pair_index << 1) | index);
+        return prop_iter_p->types + index;
+      }
+    }
+
+    if (prop_iter_p->next_property_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  entry_p->position = VM_PROPERTY_CACHE_NO_POSITION;
+  entry_p->skip_count = VM_PROPERTY_CACHE_SKIP_COUNT;
+  return NULL;
+} /* vm_property_cache_find */
+
+#endif /* JERRY_VM_PROPERTY_CACHE */
+
 /**
  * Get the value of object[property].
  *
@@ -58,8 +230,13 @@ JERRY_STATIC_ASSERT ((sizeof (vm_frame_ctx_t) % sizeof (ecma_value_t)) == 0,
  */
 static ecma_value_t
 vm_op_get_value (ecma_value_t object, /**< base object */
-                 ecma_value_t property) /**< property name */
+                 ecma_value_t property, /**< property name */
+                 const uint8_t *byte_code_p) /**< instruction which reads the property */
 {
+#if !JERRY_VM_PROPERTY_CACHE
+  JERRY_UNUSED (byte_code_p);
+#endif /* !JERRY_VM_PROPERTY_CACHE */
+
   if (ecma_is_value_object (object))
   {
     ecma_object_t *object_p = ecma_get_object_from_value (object);
@@ -102,6 +279,18 @@ vm_op_get_value (ecma_value_t object, /**< base object */
 
     if (property_name_p != NULL)
     {
+#if JERRY_VM_PROPERTY_CACHE
+      if (ecma_get_object_base_type (object_p) == ECMA_OBJECT_BASE_TYPE_GENERAL)
+      {
+        ecma_property_t *property_p = vm_property_cache_find (byte_code_p, false, object_p, property_name_p);
+
+        if (property_p != NULL && (*property_p & ECMA_PROPERTY_FLAG_DATA))
+        {
+          return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+        }
+      }
+#endif /* JERRY_VM_PROPERTY_CACHE */
+
 #if JERRY_LCACHE
       ecma_property_t *property_p = ecma_lcache_lookup (object_p, property_name_p);
 
@@ -154,8 +343,13 @@ static ecma_value_t
 vm_op_set_value (ecma_value_t base, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
-                 bool is_strict) /**< strict mode */
+                 bool is_strict, /**< strict mode */
+                 const uint8_t *byte_code_p) /**< instruction which writes the property */
 {
+#if !JERRY_VM_PROPERTY_CACHE
+  JERRY_UNUSED (byte_code_p);
+#endif /* !JERRY_VM_PROPERTY_CACHE */
+
   ecma_value_t result = ECMA_VALUE_EMPTY;
   ecma_object_t *object_p;
   ecma_string_t *property_p;
@@ -221,6 +415,23 @@ vm_op_set_value (ecma_value_t base, /**< base object */
 
     if (!ecma_is_lexical_environment (object_p))
     {
+#if JERRY_VM_PROPERTY_CACHE
+      /* Writable own data properties of general objects can be updated without the [[Set]] operation. */
+      if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL)
+      {
+        ecma_property_t *cached_property_p = vm_property_cache_find (byte_code_p, true, object_p, property_p);
+
+        if (cached_property_p != NULL && (*cached_property_p & ECMA_PROPERTY_FLAG_DATA)
+            && ecma_is_property_writable (*cached_property_p))
+        {
+          ecma_named_data_property_assign_value (object_p, ECMA_PROPERTY_VALUE_PTR (cached_property_p), value);
+          ecma_deref_object (object_p);
+          ecma_deref_ecma_string (property_p);
+          return ECMA_VALUE_TRUE;
+        }
+      }
+#endif /* JERRY_VM_PROPERTY_CACHE */
+
       result = ecma_op_object_put_with_receiver (object_p, property_p, value, base, is_strict);
     }
     else
@@ -728,34 +939,43 @@ vm_spread_operation (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 } /* vm_spread_operation */
 
 /**
- * 'Function call' opcode handler.
+ * Decode the argument list length of a call opcode.
  *
- * See also: ECMA-262 v5, 11.2.3
+ * @return pointer to the byte code after the argument list length
  */
-static void
-opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+static inline const uint8_t *JERRY_ATTR_ALWAYS_INLINE
+vm_decode_call_arguments (const vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                          uint32_t *arguments_list_len_p) /**< [out] length of the argument list */
 {
   const uint8_t *byte_code_p = frame_ctx_p->byte_code_p + 1;
   uint8_t opcode = byte_code_p[-1];
-  uint32_t arguments_list_len;
 
   if (opcode >= CBC_CALL0)
   {
-    arguments_list_len = (unsigned int) ((opcode - CBC_CALL0) / 6);
+    *arguments_list_len_p = (unsigned int) ((opcode - CBC_CALL0) / 6);
   }
   else
   {
-    arguments_list_len = *byte_code_p++;
+    *arguments_list_len_p = *byte_code_p++;
   }
 
+  return byte_code_p;
+} /* vm_decode_call_arguments */
+
+/**
+ * Complete a 'Function call' opcode: release the operands and store the result.
+ */
+static void
+opfunc_call_finish (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                    ecma_value_t completion_value) /**< result of the call */
+{
+  uint8_t opcode = frame_ctx_p->byte_code_p[0];
+  uint32_t arguments_list_len;
+  const uint8_t *byte_code_p = vm_decode_call_arguments (frame_ctx_p, &arguments_list_len);
+
   bool is_call_prop = ((opcode - CBC_CALL) % 6) >= 3;
 
   ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p - arguments_list_len;
-  ecma_value_t this_value = is_call_prop ? stack_top_p[-3] : ECMA_VALUE_UNDEFINED;
-  ecma_value_t func_value = stack_top_p[-1];
-
-  ecma_value_t completion_value =
-    ecma_op_function_validated_call (func_value, this_value, stack_top_p, arguments_list_len);
 
   JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_DIRECT_EVAL;
 
@@ -800,6 +1020,30 @@ opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   }
 
   frame_ctx_p->stack_top_p = stack_top_p;
+} /* opfunc_call_finish */
+
+/**
+ * 'Function call' opcode handler.
+ *
+ * See also: ECMA-262 v5, 11.2.3
+ */
+static void
+opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  uint8_t opcode = frame_ctx_p->byte_code_p[0];
+  uint32_t arguments_list_len;
+  vm_decode_call_arguments (frame_ctx_p, &arguments_list_len);
+
+  bool is_call_prop = ((opcode - CBC_CALL) % 6) >= 3;
+
+  ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p - arguments_list_len;
+  ecma_value_t this_value = is_call_prop ? stack_top_p[-3] : ECMA_VALUE_UNDEFINED;
+  ecma_value_t func_value = stack_top_p[-1];
+
+  ecma_value_t completion_value =
+    ecma_op_function_validated_call (func_value, this_value, stack_top_p, arguments_list_len);
+
+  opfunc_call_finish (frame_ctx_p, completion_value);
 } /* opfunc_call */
 
 /**
@@ -960,6 +1204,166 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
  */
 #define VM_LAST_CONTEXT_END() (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth)
 
+#if JERRY_VM_THREADED_DISPATCH
+
+/**
+ * Case label of an opcode handler, which is also a jump target of the dispatch table.
+ */
+#define VM_CASE(opcode) case opcode: vm_label_##opcode
+
+/**
+ * Address of the handler label of an opcode.
+ */
+#define VM_LABEL(opcode) __extension__ &&vm_label_##opcode
+
+/**
+ * Jump to the handler of the current opcode group.
+ */
+#define VM_DISPATCH(table)                            \
+  _Pragma ("GCC diagnostic push")                     \
+  _Pragma ("GCC diagnostic ignored \"-Wpedantic\"") \
+  goto *(table)[VM_OC_GROUP_GET_INDEX (opcode_data)]; \
+  _Pragma ("GCC diagnostic pop")
+
+#else /* !JERRY_VM_THREADED_DISPATCH */
+
+/**
+ * Case label of an opcode handler.
+ */
+#define VM_CASE(opcode) case opcode
+
+#endif /* JERRY_VM_THREADED_DISPATCH */
+
+#if JERRY_VM_HALT
+
+/**
+ * Call the halt callback after the backward branch counter reached zero.
+ *
+ * @return ECMA_VALUE_ERROR - if the execution must be aborted
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t JERRY_ATTR_NOINLINE
+vm_call_halt_callback (void)
+{
+  ecma_value_t result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+
+  if (ecma_is_value_undefined (result))
+  {
+    JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
+    return ECMA_VALUE_EMPTY;
+  }
+
+  JERRY_CONTEXT (vm_exec_stop_counter) = 1;
+
+  if (ecma_is_value_exception (result))
+  {
+    ecma_throw_exception (result);
+  }
+  else
+  {
+    jcontext_raise_exception (result);
+  }
+
+  JERRY_ASSERT (jcontext_has_pending_exception ());
+  jcontext_set_abort_flag (true);
+  return ECMA_VALUE_ERROR;
+} /* vm_call_halt_callback */
+
+#endif /* JERRY_VM_HALT */
+
+/**
+ * Rewrite the literal forms of an add, subtract or multiply opcode to their quickened form
+ * when the operands observed by the generic opcode are numbers.
+ *
+ * Note:
+ *      the quickened opcodes read their literal arguments without resolving them, so
+ *      only registers and constant literals are accepted, and read-only byte code
+ *      (static snapshots or byte code which is not copied from a snapshot) is never modified
+ */
+static void JERRY_ATTR_NOINLINE
+vm_quicken_arithmetic (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                       const uint8_t *byte_code_start_p, /**< start of the generic opcode */
+                       uint32_t quickened_flags) /**< VM_OC_QUICKENED_DOUBLE_FLAG or 0 */
+{
+  const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->shared_p->bytecode_header_p;
+  const uint8_t *byte_code_end_p =
+    ((const uint8_t *) bytecode_header_p) + ((size_t) bytecode_header_p->size << JMEM_ALIGNMENT_LOG);
+  uint32_t opcode_index = (uint32_t) (byte_code_start_p[0] - CBC_ADD);
+
+  JERRY_ASSERT (opcode_index < 3 * 3 && opcode_index % 3 != 0);
+
+  if ((bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION)
+      || byte_code_start_p < (const uint8_t *) bytecode_header_p || byte_code_start_p >= byte_code_end_p)
+  {
+    return;
+  }
+
+  uint16_t encoding_limit = CBC_SMALL_LITERAL_ENCODING_LIMIT;
+  uint16_t encoding_delta = CBC_SMALL_LITERAL_ENCODING_DELTA;
+  uint16_t register_end;
+  uint16_t ident_end;
+  uint16_t const_literal_end;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING)
+  {
+    encoding_limit = CBC_FULL_LITERAL_ENCODING_LIMIT;
+    encoding_delta = CBC_FULL_LITERAL_ENCODING_DELTA;
+  }
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+  }
+
+  const uint8_t *byte_code_p = byte_code_start_p + 1;
+  uint32_t literal_count = opcode_index % 3;
+
+  if (literal_count == 2)
+  {
+    quickened_flags |= VM_OC_QUICKENED_TWO_LITERALS_FLAG;
+  }
+
+  do
+  {
+    uint16_t literal_index = *byte_code_p++;
+
+    if (literal_index >= encoding_limit)
+    {
+      literal_index = (uint16_t) (((literal_index << 8) | *byte_code_p++) - encoding_delta);
+    }
+
+    if (literal_index >= register_end && (literal_index < ident_end || literal_index >= const_literal_end))
+    {
+      return;
+    }
+  } while (--literal_count > 0);
+
+  *(uint8_t *) byte_code_start_p = (uint8_t) (CBC_ADD_RIGHT_LITERAL_INT + (opcode_index / 3) * 4 + quickened_flags);
+} /* vm_quicken_arithmetic */
+
+/**
+ * Quicken the literal forms of an add, subtract or multiply opcode. The stack only
+ * forms have no literal arguments, so their generic implementation is kept.
+ */
+#define VM_QUICKEN_ARITHMETIC(stack_opcode, quickened_flags)                     \
+  do                                                                             \
+  {                                                                              \
+    if (opcode != (stack_opcode))                                                \
+    {                                                                            \
+      vm_quicken_arithmetic (frame_ctx_p, byte_code_start_p, (quickened_flags)); \
+    }                                                                            \
+  } while (0)
+
 /**
  * Run generic byte code.
  *
@@ -985,6 +1389,202 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   ecma_value_t result = ECMA_VALUE_EMPTY;
   bool is_strict = ((bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
 
+#if JERRY_VM_THREADED_DISPATCH
+  /* Handler addresses of all opcode groups. Disabled opcodes jump to the VM_OC_NONE handler. */
+  static const void *const vm_dispatch_table[] = {
+    [VM_OC_POP] = VM_LABEL (VM_OC_POP),
+    [VM_OC_POP_BLOCK] = VM_LABEL (VM_OC_POP_BLOCK),
+    [VM_OC_PUSH] = VM_LABEL (VM_OC_PUSH),
+    [VM_OC_PUSH_TWO] = VM_LABEL (VM_OC_PUSH_TWO),
+    [VM_OC_PUSH_THREE] = VM_LABEL (VM_OC_PUSH_THREE),
+    [VM_OC_PUSH_UNDEFINED] = VM_LABEL (VM_OC_PUSH_UNDEFINED),
+    [VM_OC_PUSH_TRUE] = VM_LABEL (VM_OC_PUSH_TRUE),
+    [VM_OC_PUSH_FALSE] = VM_LABEL (VM_OC_PUSH_FALSE),
+    [VM_OC_PUSH_NULL] = VM_LABEL (VM_OC_PUSH_NULL),
+    [VM_OC_PUSH_THIS] = VM_LABEL (VM_OC_PUSH_THIS),
+    [VM_OC_PUSH_0] = VM_LABEL (VM_OC_PUSH_0),
+    [VM_OC_PUSH_POS_BYTE] = VM_LABEL (VM_OC_PUSH_POS_BYTE),
+    [VM_OC_PUSH_NEG_BYTE] = VM_LABEL (VM_OC_PUSH_NEG_BYTE),
+    [VM_OC_PUSH_LIT_0] = VM_LABEL (VM_OC_PUSH_LIT_0),
+    [VM_OC_PUSH_LIT_POS_BYTE] = VM_LABEL (VM_OC_PUSH_LIT_POS_BYTE),
+    [VM_OC_PUSH_LIT_NEG_BYTE] = VM_LABEL (VM_OC_PUSH_LIT_NEG_BYTE),
+    [VM_OC_PUSH_OBJECT] = VM_LABEL (VM_OC_PUSH_OBJECT),
+    [VM_OC_PUSH_NAMED_FUNC_EXPR] = VM_LABEL (VM_OC_PUSH_NAMED_FUNC_EXPR),
+    [VM_OC_SET_PROPERTY] = VM_LABEL (VM_OC_SET_PROPERTY),
+    [VM_OC_SET_GETTER] = VM_LABEL (VM_OC_SET_GETTER),
+    [VM_OC_SET_SETTER] = VM_LABEL (VM_OC_SET_SETTER),
+    [VM_OC_PUSH_ARRAY] = VM_LABEL (VM_OC_PUSH_ARRAY),
+    [VM_OC_PUSH_ELISON] = VM_LABEL (VM_OC_PUSH_ELISON),
+    [VM_OC_APPEND_ARRAY] = VM_LABEL (VM_OC_APPEND_ARRAY),
+    [VM_OC_IDENT_REFERENCE] = VM_LABEL (VM_OC_IDENT_REFERENCE),
+    [VM_OC_PROP_REFERENCE] = VM_LABEL (VM_OC_PROP_REFERENCE),
+    [VM_OC_PROP_GET] = VM_LABEL (VM_OC_PROP_GET),
+    [VM_OC_PROP_PRE_INCR] = VM_LABEL (VM_OC_PROP_PRE_INCR),
+    [VM_OC_PROP_PRE_DECR] = VM_LABEL (VM_OC_PROP_PRE_DECR),
+    [VM_OC_PROP_POST_INCR] = VM_LABEL (VM_OC_PROP_POST_INCR),
+    [VM_OC_PROP_POST_DECR] = VM_LABEL (VM_OC_PROP_POST_DECR),
+    [VM_OC_PRE_INCR] = VM_LABEL (VM_OC_PRE_INCR),
+    [VM_OC_PRE_DECR] = VM_LABEL (VM_OC_PRE_DECR),
+    [VM_OC_POST_INCR] = VM_LABEL (VM_OC_POST_INCR),
+    [VM_OC_POST_DECR] = VM_LABEL (VM_OC_POST_DECR),
+    [VM_OC_PROP_DELETE] = VM_LABEL (VM_OC_PROP_DELETE),
+    [VM_OC_DELETE] = VM_LABEL (VM_OC_DELETE),
+    [VM_OC_MOV_IDENT] = VM_LABEL (VM_OC_MOV_IDENT),
+    [VM_OC_ASSIGN] = VM_LABEL (VM_OC_ASSIGN),
+    [VM_OC_ASSIGN_PROP] = VM_LABEL (VM_OC_ASSIGN_PROP),
+    [VM_OC_ASSIGN_PROP_THIS] = VM_LABEL (VM_OC_ASSIGN_PROP_THIS),
+    [VM_OC_RETURN] = VM_LABEL (VM_OC_RETURN),
+    [VM_OC_RETURN_FUNCTION_END] = VM_LABEL (VM_OC_RETURN_FUNCTION_END),
+    [VM_OC_THROW] = VM_LABEL (VM_OC_THROW),
+    [VM_OC_THROW_REFERENCE_ERROR] = VM_LABEL (VM_OC_THROW_REFERENCE_ERROR),
+    [VM_OC_EVAL] = VM_LABEL (VM_OC_EVAL),
+    [VM_OC_CALL] = VM_LABEL (VM_OC_CALL),
+    [VM_OC_NEW] = VM_LABEL (VM_OC_NEW),
+    [VM_OC_RESOLVE_BASE_FOR_CALL] = VM_LABEL (VM_OC_RESOLVE_BASE_FOR_CALL),
+    [VM_OC_ERROR] = VM_LABEL (VM_OC_ERROR),
+    [VM_OC_JUMP] = VM_LABEL (VM_OC_JUMP),
+    [VM_OC_BRANCH_IF_NULLISH] = VM_LABEL (VM_OC_BRANCH_IF_NULLISH),
+    [VM_OC_POP_REFERENCE] = VM_LABEL (VM_OC_POP_REFERENCE),
+    [VM_OC_BRANCH_IF_STRICT_EQUAL] = VM_LABEL (VM_OC_BRANCH_IF_STRICT_EQUAL),
+    [VM_OC_BRANCH_IF_TRUE] = VM_LABEL (VM_OC_BRANCH_IF_TRUE),
+    [VM_OC_BRANCH_IF_FALSE] = VM_LABEL (VM_OC_BRANCH_IF_FALSE),
+    [VM_OC_BRANCH_IF_LOGICAL_TRUE] = VM_LABEL (VM_OC_BRANCH_IF_LOGICAL_TRUE),
+    [VM_OC_BRANCH_IF_LOGICAL_FALSE] = VM_LABEL (VM_OC_BRANCH_IF_LOGICAL_FALSE),
+    [VM_OC_PLUS] = VM_LABEL (VM_OC_PLUS),
+    [VM_OC_MINUS] = VM_LABEL (VM_OC_MINUS),
+    [VM_OC_NOT] = VM_LABEL (VM_OC_NOT),
+    [VM_OC_BIT_NOT] = VM_LABEL (VM_OC_BIT_NOT),
+    [VM_OC_VOID] = VM_LABEL (VM_OC_VOID),
+    [VM_OC_TYPEOF_IDENT] = VM_LABEL (VM_OC_TYPEOF_IDENT),
+    [VM_OC_TYPEOF] = VM_LABEL (VM_OC_TYPEOF),
+    [VM_OC_ADD] = VM_LABEL (VM_OC_ADD),
+    [VM_OC_SUB] = VM_LABEL (VM_OC_SUB),
+    [VM_OC_MUL] = VM_LABEL (VM_OC_MUL),
+    [VM_OC_DIV] = VM_LABEL (VM_OC_DIV),
+    [VM_OC_MOD] = VM_LABEL (VM_OC_MOD),
+    [VM_OC_EXP] = VM_LABEL (VM_OC_EXP),
+    [VM_OC_QUICKENED_ARITHMETIC] = VM_LABEL (VM_OC_QUICKENED_ARITHMETIC),
+    [VM_OC_EQUAL] = VM_LABEL (VM_OC_EQUAL),
+    [VM_OC_NOT_EQUAL] = VM_LABEL (VM_OC_NOT_EQUAL),
+    [VM_OC_STRICT_EQUAL] = VM_LABEL (VM_OC_STRICT_EQUAL),
+    [VM_OC_STRICT_NOT_EQUAL] = VM_LABEL (VM_OC_STRICT_NOT_EQUAL),
+    [VM_OC_LESS] = VM_LABEL (VM_OC_LESS),
+    [VM_OC_GREATER] = VM_LABEL (VM_OC_GREATER),
+    [VM_OC_LESS_EQUAL] = VM_LABEL (VM_OC_LESS_EQUAL),
+    [VM_OC_GREATER_EQUAL] = VM_LABEL (VM_OC_GREATER_EQUAL),
+    [VM_OC_BRANCH_IF_RELATION] = VM_LABEL (VM_OC_BRANCH_IF_RELATION),
+    [VM_OC_IN] = VM_LABEL (VM_OC_IN),
+    [VM_OC_INSTANCEOF] = VM_LABEL (VM_OC_INSTANCEOF),
+    [VM_OC_BIT_OR] = VM_LABEL (VM_OC_BIT_OR),
+    [VM_OC_BIT_XOR] = VM_LABEL (VM_OC_BIT_XOR),
+    [VM_OC_BIT_AND] = VM_LABEL (VM_OC_BIT_AND),
+    [VM_OC_LEFT_SHIFT] = VM_LABEL (VM_OC_LEFT_SHIFT),
+    [VM_OC_RIGHT_SHIFT] = VM_LABEL (VM_OC_RIGHT_SHIFT),
+    [VM_OC_UNS_RIGHT_SHIFT] = VM_LABEL (VM_OC_UNS_RIGHT_SHIFT),
+    [VM_OC_BLOCK_CREATE_CONTEXT] = VM_LABEL (VM_OC_BLOCK_CREATE_CONTEXT),
+    [VM_OC_WITH] = VM_LABEL (VM_OC_WITH),
+    [VM_OC_FOR_IN_INIT] = VM_LABEL (VM_OC_FOR_IN_INIT),
+    [VM_OC_FOR_IN_GET_NEXT] = VM_LABEL (VM_OC_FOR_IN_GET_NEXT),
+    [VM_OC_FOR_IN_HAS_NEXT] = VM_LABEL (VM_OC_FOR_IN_HAS_NEXT),
+    [VM_OC_TRY] = VM_LABEL (VM_OC_TRY),
+    [VM_OC_CATCH] = VM_LABEL (VM_OC_CATCH),
+    [VM_OC_FINALLY] = VM_LABEL (VM_OC_FINALLY),
+    [VM_OC_CONTEXT_END] = VM_LABEL (VM_OC_CONTEXT_END),
+    [VM_OC_JUMP_AND_EXIT_CONTEXT] = VM_LABEL (VM_OC_JUMP_AND_EXIT_CONTEXT),
+    [VM_OC_CREATE_BINDING] = VM_LABEL (VM_OC_CREATE_BINDING),
+    [VM_OC_CREATE_ARGUMENTS] = VM_LABEL (VM_OC_CREATE_ARGUMENTS),
+#if JERRY_SNAPSHOT_EXEC
+    [VM_OC_SET_BYTECODE_PTR] = VM_LABEL (VM_OC_SET_BYTECODE_PTR),
+#else /* !JERRY_SNAPSHOT_EXEC */
+    [VM_OC_SET_BYTECODE_PTR] = VM_LABEL (VM_OC_NONE),
+#endif /* JERRY_SNAPSHOT_EXEC */
+    [VM_OC_VAR_EVAL] = VM_LABEL (VM_OC_VAR_EVAL),
+    [VM_OC_EXT_VAR_EVAL] = VM_LABEL (VM_OC_EXT_VAR_EVAL),
+    [VM_OC_INIT_ARG_OR_FUNC] = VM_LABEL (VM_OC_INIT_ARG_OR_FUNC),
+#if JERRY_DEBUGGER
+    [VM_OC_BREAKPOINT_ENABLED] = VM_LABEL (VM_OC_BREAKPOINT_ENABLED),
+    [VM_OC_BREAKPOINT_DISABLED] = VM_LABEL (VM_OC_BREAKPOINT_DISABLED),
+#endif /* JERRY_DEBUGGER */
+    [VM_OC_CLASS_CALL_STATIC_BLOCK] = VM_LABEL (VM_OC_CLASS_CALL_STATIC_BLOCK),
+    [VM_OC_DEFINE_FIELD] = VM_LABEL (VM_OC_DEFINE_FIELD),
+    [VM_OC_PRIVATE_PROP_REFERENCE] = VM_LABEL (VM_OC_PRIVATE_PROP_REFERENCE),
+    [VM_OC_ASSIGN_PRIVATE] = VM_LABEL (VM_OC_ASSIGN_PRIVATE),
+    [VM_OC_PRIVATE_FIELD_ADD] = VM_LABEL (VM_OC_PRIVATE_FIELD_ADD),
+    [VM_OC_PRIVATE_PROP_GET] = VM_LABEL (VM_OC_PRIVATE_PROP_GET),
+    [VM_OC_PRIVATE_IN] = VM_LABEL (VM_OC_PRIVATE_IN),
+    [VM_OC_COLLECT_PRIVATE_PROPERTY] = VM_LABEL (VM_OC_COLLECT_PRIVATE_PROPERTY),
+    [VM_OC_CHECK_VAR] = VM_LABEL (VM_OC_CHECK_VAR),
+    [VM_OC_CHECK_LET] = VM_LABEL (VM_OC_CHECK_LET),
+    [VM_OC_ASSIGN_LET_CONST] = VM_LABEL (VM_OC_ASSIGN_LET_CONST),
+    [VM_OC_INIT_BINDING] = VM_LABEL (VM_OC_INIT_BINDING),
+    [VM_OC_THROW_CONST_ERROR] = VM_LABEL (VM_OC_THROW_CONST_ERROR),
+    [VM_OC_COPY_TO_GLOBAL] = VM_LABEL (VM_OC_COPY_TO_GLOBAL),
+    [VM_OC_COPY_FROM_ARG] = VM_LABEL (VM_OC_COPY_FROM_ARG),
+    [VM_OC_CLONE_CONTEXT] = VM_LABEL (VM_OC_CLONE_CONTEXT),
+    [VM_OC_COPY_DATA_PROPERTIES] = VM_LABEL (VM_OC_COPY_DATA_PROPERTIES),
+    [VM_OC_SET_COMPUTED_PROPERTY] = VM_LABEL (VM_OC_SET_COMPUTED_PROPERTY),
+    [VM_OC_FOR_OF_INIT] = VM_LABEL (VM_OC_FOR_OF_INIT),
+    [VM_OC_FOR_OF_GET_NEXT] = VM_LABEL (VM_OC_FOR_OF_GET_NEXT),
+    [VM_OC_FOR_OF_HAS_NEXT] = VM_LABEL (VM_OC_FOR_OF_HAS_NEXT),
+    [VM_OC_FOR_AWAIT_OF_INIT] = VM_LABEL (VM_OC_FOR_AWAIT_OF_INIT),
+    [VM_OC_FOR_AWAIT_OF_HAS_NEXT] = VM_LABEL (VM_OC_FOR_AWAIT_OF_HAS_NEXT),
+    [VM_OC_LOCAL_EVAL] = VM_LABEL (VM_OC_LOCAL_EVAL),
+    [VM_OC_SUPER_CALL] = VM_LABEL (VM_OC_SUPER_CALL),
+    [VM_OC_PUSH_CLASS_ENVIRONMENT] = VM_LABEL (VM_OC_PUSH_CLASS_ENVIRONMENT),
+    [VM_OC_PUSH_IMPLICIT_CTOR] = VM_LABEL (VM_OC_PUSH_IMPLICIT_CTOR),
+    [VM_OC_INIT_CLASS] = VM_LABEL (VM_OC_INIT_CLASS),
+    [VM_OC_FINALIZE_CLASS] = VM_LABEL (VM_OC_FINALIZE_CLASS),
+    [VM_OC_SET_FIELD_INIT] = VM_LABEL (VM_OC_SET_FIELD_INIT),
+    [VM_OC_SET_STATIC_FIELD_INIT] = VM_LABEL (VM_OC_NONE),
+    [VM_OC_RUN_FIELD_INIT] = VM_LABEL (VM_OC_RUN_FIELD_INIT),
+    [VM_OC_RUN_STATIC_FIELD_INIT] = VM_LABEL (VM_OC_RUN_STATIC_FIELD_INIT),
+    [VM_OC_SET_NEXT_COMPUTED_FIELD] = VM_LABEL (VM_OC_SET_NEXT_COMPUTED_FIELD),
+    [VM_OC_PUSH_SUPER_CONSTRUCTOR] = VM_LABEL (VM_OC_PUSH_SUPER_CONSTRUCTOR),
+    [VM_OC_RESOLVE_LEXICAL_THIS] = VM_LABEL (VM_OC_RESOLVE_LEXICAL_THIS),
+    [VM_OC_SUPER_REFERENCE] = VM_LABEL (VM_OC_SUPER_REFERENCE),
+    [VM_OC_SET_HOME_OBJECT] = VM_LABEL (VM_OC_SET_HOME_OBJECT),
+    [VM_OC_OBJECT_LITERAL_HOME_ENV] = VM_LABEL (VM_OC_OBJECT_LITERAL_HOME_ENV),
+    [VM_OC_SET_FUNCTION_NAME] = VM_LABEL (VM_OC_SET_FUNCTION_NAME),
+    [VM_OC_PUSH_SPREAD_ELEMENT] = VM_LABEL (VM_OC_PUSH_SPREAD_ELEMENT),
+    [VM_OC_PUSH_REST_OBJECT] = VM_LABEL (VM_OC_PUSH_REST_OBJECT),
+    [VM_OC_ITERATOR_CONTEXT_CREATE] = VM_LABEL (VM_OC_ITERATOR_CONTEXT_CREATE),
+    [VM_OC_ITERATOR_CONTEXT_END] = VM_LABEL (VM_OC_ITERATOR_CONTEXT_END),
+    [VM_OC_ITERATOR_STEP] = VM_LABEL (VM_OC_ITERATOR_STEP),
+    [VM_OC_OBJ_INIT_CONTEXT_CREATE] = VM_LABEL (VM_OC_OBJ_INIT_CONTEXT_CREATE),
+    [VM_OC_OBJ_INIT_CONTEXT_END] = VM_LABEL (VM_OC_OBJ_INIT_CONTEXT_END),
+    [VM_OC_OBJ_INIT_PUSH_REST] = VM_LABEL (VM_OC_OBJ_INIT_PUSH_REST),
+    [VM_OC_INITIALIZER_PUSH_NAME] = VM_LABEL (VM_OC_INITIALIZER_PUSH_NAME),
+    [VM_OC_DEFAULT_INITIALIZER] = VM_LABEL (VM_OC_DEFAULT_INITIALIZER),
+    [VM_OC_REST_INITIALIZER] = VM_LABEL (VM_OC_REST_INITIALIZER),
+    [VM_OC_INITIALIZER_PUSH_PROP] = VM_LABEL (VM_OC_INITIALIZER_PUSH_PROP),
+    [VM_OC_SPREAD_ARGUMENTS] = VM_LABEL (VM_OC_SPREAD_ARGUMENTS),
+    [VM_OC_CREATE_GENERATOR] = VM_LABEL (VM_OC_CREATE_GENERATOR),
+    [VM_OC_YIELD] = VM_LABEL (VM_OC_YIELD),
+    [VM_OC_ASYNC_YIELD] = VM_LABEL (VM_OC_ASYNC_YIELD),
+    [VM_OC_ASYNC_YIELD_ITERATOR] = VM_LABEL (VM_OC_ASYNC_YIELD_ITERATOR),
+    [VM_OC_AWAIT] = VM_LABEL (VM_OC_AWAIT),
+    [VM_OC_GENERATOR_AWAIT] = VM_LABEL (VM_OC_GENERATOR_AWAIT),
+    [VM_OC_EXT_RETURN] = VM_LABEL (VM_OC_EXT_RETURN),
+    [VM_OC_ASYNC_EXIT] = VM_LABEL (VM_OC_ASYNC_EXIT),
+    [VM_OC_STRING_CONCAT] = VM_LABEL (VM_OC_STRING_CONCAT),
+    [VM_OC_GET_TEMPLATE_OBJECT] = VM_LABEL (VM_OC_GET_TEMPLATE_OBJECT),
+    [VM_OC_PUSH_NEW_TARGET] = VM_LABEL (VM_OC_PUSH_NEW_TARGET),
+    [VM_OC_REQUIRE_OBJECT_COERCIBLE] = VM_LABEL (VM_OC_REQUIRE_OBJECT_COERCIBLE),
+    [VM_OC_ASSIGN_SUPER] = VM_LABEL (VM_OC_ASSIGN_SUPER),
+    [VM_OC_SET__PROTO__] = VM_LABEL (VM_OC_SET__PROTO__),
+    [VM_OC_PUSH_STATIC_FIELD_FUNC] = VM_LABEL (VM_OC_PUSH_STATIC_FIELD_FUNC),
+    [VM_OC_ADD_COMPUTED_FIELD] = VM_LABEL (VM_OC_ADD_COMPUTED_FIELD),
+#if JERRY_MODULE_SYSTEM
+    [VM_OC_MODULE_IMPORT] = VM_LABEL (VM_OC_MODULE_IMPORT),
+    [VM_OC_MODULE_IMPORT_META] = VM_LABEL (VM_OC_MODULE_IMPORT_META),
+#endif /* JERRY_MODULE_SYSTEM */
+    [VM_OC_NONE] = VM_LABEL (VM_OC_NONE)
+  };
+
+  JERRY_STATIC_ASSERT (sizeof (vm_dispatch_table) / sizeof (vm_dispatch_table[0]) == VM_OC_NONE + 1,
+                       vm_dispatch_table_must_have_an_entry_for_each_opcode_group);
+#endif /* JERRY_VM_THREADED_DISPATCH */
+
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
   {
@@ -1110,28 +1710,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #if JERRY_VM_HALT
           if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
           {
-            result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+            result = vm_call_halt_callback ();
 
-            if (ecma_is_value_undefined (result))
-            {
-              JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
-            }
-            else
+            if (ECMA_IS_VALUE_ERROR (result))
             {
-              JERRY_CONTEXT (vm_exec_stop_counter) = 1;
-
-              if (ecma_is_value_exception (result))
-              {
-                ecma_throw_exception (result);
-              }
-              else
-              {
-                jcontext_raise_exception (result);
-              }
-
-              JERRY_ASSERT (jcontext_has_pending_exception ());
-              jcontext_set_abort_flag (true);
-              result = ECMA_VALUE_ERROR;
               goto error;
             }
           }
@@ -1141,32 +1723,36 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
       }
 
+#if JERRY_VM_THREADED_DISPATCH
+      VM_DISPATCH (vm_dispatch_table);
+#endif /* JERRY_VM_THREADED_DISPATCH */
+
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_POP:
+        VM_CASE (VM_OC_POP):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
           ecma_free_value (*(--stack_top_p));
           continue;
         }
-        case VM_OC_POP_BLOCK:
+        VM_CASE (VM_OC_POP_BLOCK):
         {
           ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, 0));
           VM_GET_REGISTERS (frame_ctx_p)[0] = *(--stack_top_p);
           continue;
         }
-        case VM_OC_PUSH:
+        VM_CASE (VM_OC_PUSH):
         {
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_TWO:
+        VM_CASE (VM_OC_PUSH_TWO):
         {
           *stack_top_p++ = left_value;
           *stack_top_p++ = right_value;
           continue;
         }
-        case VM_OC_PUSH_THREE:
+        VM_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -1180,56 +1766,56 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_UNDEFINED:
+        VM_CASE (VM_OC_PUSH_UNDEFINED):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           continue;
         }
-        case VM_OC_PUSH_TRUE:
+        VM_CASE (VM_OC_PUSH_TRUE):
         {
           *stack_top_p++ = ECMA_VALUE_TRUE;
           continue;
         }
-        case VM_OC_PUSH_FALSE:
+        VM_CASE (VM_OC_PUSH_FALSE):
         {
           *stack_top_p++ = ECMA_VALUE_FALSE;
           continue;
         }
-        case VM_OC_PUSH_NULL:
+        VM_CASE (VM_OC_PUSH_NULL):
         {
           *stack_top_p++ = ECMA_VALUE_NULL;
           continue;
         }
-        case VM_OC_PUSH_THIS:
+        VM_CASE (VM_OC_PUSH_THIS):
         {
           *stack_top_p++ = ecma_copy_value (frame_ctx_p->this_binding);
           continue;
         }
-        case VM_OC_PUSH_0:
+        VM_CASE (VM_OC_PUSH_0):
         {
           *stack_top_p++ = ecma_make_integer_value (0);
           continue;
         }
-        case VM_OC_PUSH_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (number + 1);
           continue;
         }
-        case VM_OC_PUSH_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (-(number + 1));
           continue;
         }
-        case VM_OC_PUSH_LIT_0:
+        VM_CASE (VM_OC_PUSH_LIT_0):
         {
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (0);
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1237,7 +1823,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1245,7 +1831,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *obj_p =
             ecma_create_object (ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE), 0, ECMA_OBJECT_TYPE_GENERAL);
@@ -1253,7 +1839,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (obj_p);
           continue;
         }
-        case VM_OC_PUSH_NAMED_FUNC_EXPR:
+        VM_CASE (VM_OC_PUSH_NAMED_FUNC_EXPR):
         {
           ecma_object_t *func_p = ecma_get_object_from_value (left_value);
 
@@ -1268,6 +1854,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_op_create_immutable_binding (name_lex_env, ecma_get_string_from_value (right_value), left_value);
 
+          ECMA_GC_REMEMBER_OBJECT (name_lex_env);
           ECMA_SET_NON_NULL_POINTER_TAG (ext_func_p->u.function.scope_cp, name_lex_env, 0);
 
           ecma_free_value (right_value);
@@ -1275,7 +1862,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_CREATE_BINDING:
+        VM_CASE (VM_OC_CREATE_BINDING):
         {
           uint32_t literal_index;
 
@@ -1307,7 +1894,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_VAR_EVAL:
+        VM_CASE (VM_OC_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1384,6 +1971,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               JERRY_ASSERT (ecma_is_value_undefined (ECMA_PROPERTY_VALUE_PTR (prop_p)->value));
               JERRY_ASSERT (ecma_is_property_writable (*prop_p));
               ECMA_PROPERTY_VALUE_PTR (prop_p)->value = lit_value;
+              ECMA_GC_REMEMBER_VALUE (lit_value);
               ecma_free_object (lit_value);
             }
             else
@@ -1399,7 +1987,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_EXT_VAR_EVAL:
+        VM_CASE (VM_OC_EXT_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1467,10 +2055,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
 
           property_value_p->value = lit_value;
+          ECMA_GC_REMEMBER_VALUE (lit_value);
           ecma_deref_object (ecma_get_object_from_value (lit_value));
           continue;
         }
-        case VM_OC_CREATE_ARGUMENTS:
+        VM_CASE (VM_OC_CREATE_ARGUMENTS):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1496,19 +2085,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           property_value_p = ecma_create_named_data_property (frame_ctx_p->lex_env_p, name_p, prop_attributes, NULL);
           property_value_p->value = result;
+          ECMA_GC_REMEMBER_VALUE (result);
 
           ecma_deref_object (ecma_get_object_from_value (result));
           continue;
         }
 #if JERRY_SNAPSHOT_EXEC
-        case VM_OC_SET_BYTECODE_PTR:
+        VM_CASE (VM_OC_SET_BYTECODE_PTR):
         {
           memcpy (&byte_code_p, byte_code_p++, sizeof (uintptr_t));
           frame_ctx_p->byte_code_start_p = byte_code_p;
           continue;
         }
 #endif /* JERRY_SNAPSHOT_EXEC */
-        case VM_OC_INIT_ARG_OR_FUNC:
+        VM_CASE (VM_OC_INIT_ARG_OR_FUNC):
         {
           uint32_t literal_index, value_index;
           ecma_value_t lit_value;
@@ -1551,6 +2141,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (property_value_p->value == ECMA_VALUE_UNDEFINED);
           property_value_p->value = lit_value;
+          ECMA_GC_REMEMBER_VALUE (lit_value);
 
           if (release)
           {
@@ -1558,7 +2149,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_CHECK_VAR:
+        VM_CASE (VM_OC_CHECK_VAR):
         {
           JERRY_ASSERT (CBC_FUNCTION_GET_TYPE (frame_ctx_p->shared_p->bytecode_header_p->status_flags)
                         == CBC_FUNCTION_SCRIPT);
@@ -1582,7 +2173,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_CHECK_LET:
+        VM_CASE (VM_OC_CHECK_LET):
         {
           JERRY_ASSERT (CBC_FUNCTION_GET_TYPE (frame_ctx_p->shared_p->bytecode_header_p->status_flags)
                         == CBC_FUNCTION_SCRIPT);
@@ -1628,7 +2219,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_ASSIGN_LET_CONST:
+        VM_CASE (VM_OC_ASSIGN_LET_CONST):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1646,6 +2237,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p)->value == ECMA_VALUE_UNINITIALIZED);
 
           ECMA_PROPERTY_VALUE_PTR (property_p)->value = left_value;
+          ECMA_GC_REMEMBER_VALUE (left_value);
 
           if (ecma_is_value_object (left_value))
           {
@@ -1653,7 +2245,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_INIT_BINDING:
+        VM_CASE (VM_OC_INIT_BINDING):
         {
           uint32_t literal_index;
 
@@ -1685,15 +2277,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_value_t value = *(--stack_top_p);
 
           property_value_p->value = value;
+          ECMA_GC_REMEMBER_VALUE (value);
           ecma_deref_if_object (value);
           continue;
         }
-        case VM_OC_THROW_CONST_ERROR:
+        VM_CASE (VM_OC_THROW_CONST_ERROR):
         {
           result = ecma_raise_type_error (ECMA_ERR_CONSTANT_BINDINGS_CANNOT_BE_REASSIGNED);
           goto error;
         }
-        case VM_OC_COPY_TO_GLOBAL:
+        VM_CASE (VM_OC_COPY_TO_GLOBAL):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1747,7 +2340,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_COPY_FROM_ARG:
+        VM_CASE (VM_OC_COPY_FROM_ARG):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1772,7 +2365,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           property_value_p->value = ecma_copy_value_if_not_object (arg_prop_value_p->value);
           continue;
         }
-        case VM_OC_CLONE_CONTEXT:
+        VM_CASE (VM_OC_CLONE_CONTEXT):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE);
 
@@ -1780,7 +2373,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = ecma_clone_decl_lexical_environment (frame_ctx_p->lex_env_p, copy_values);
           continue;
         }
-        case VM_OC_SET__PROTO__:
+        VM_CASE (VM_OC_SET__PROTO__):
         {
           result = ecma_builtin_object_object_set_proto (stack_top_p[-1], left_value);
           if (ECMA_IS_VALUE_ERROR (result))
@@ -1789,7 +2382,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_CLASS_CALL_STATIC_BLOCK:
+        VM_CASE (VM_OC_CLASS_CALL_STATIC_BLOCK):
         {
           result = ecma_op_function_call (ecma_get_object_from_value (left_value), frame_ctx_p->this_binding, NULL, 0);
 
@@ -1799,7 +2392,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_PUSH_STATIC_FIELD_FUNC:
+        VM_CASE (VM_OC_PUSH_STATIC_FIELD_FUNC):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE
                         && (byte_code_start_p[1] == CBC_EXT_PUSH_STATIC_FIELD_FUNC
@@ -1828,7 +2421,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = value;
           /* FALLTHRU */
         }
-        case VM_OC_ADD_COMPUTED_FIELD:
+        VM_CASE (VM_OC_ADD_COMPUTED_FIELD):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE
                         && (byte_code_start_p[1] == CBC_EXT_PUSH_STATIC_COMPUTED_FIELD_FUNC
@@ -1844,7 +2437,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_COPY_DATA_PROPERTIES:
+        VM_CASE (VM_OC_COPY_DATA_PROPERTIES):
         {
           left_value = *(--stack_top_p);
 
@@ -1862,7 +2455,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_SET_COMPUTED_PROPERTY:
+        VM_CASE (VM_OC_SET_COMPUTED_PROPERTY):
         {
           /* Swap values. */
           left_value ^= right_value;
@@ -1870,7 +2463,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value ^= right_value;
           /* FALLTHRU */
         }
-        case VM_OC_SET_PROPERTY:
+        VM_CASE (VM_OC_SET_PROPERTY):
         {
           JERRY_STATIC_ASSERT (VM_OC_NON_STATIC_FLAG == VM_OC_BACKWARD_BRANCH,
                                vm_oc_non_static_flag_must_be_equal_to_vm_oc_backward_branch);
@@ -1901,8 +2494,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_CASE (VM_OC_SET_GETTER):
+        VM_CASE (VM_OC_SET_SETTER):
         {
           JERRY_ASSERT ((opcode_data >> VM_OC_NON_STATIC_SHIFT) <= 0x1);
 
@@ -1931,20 +2524,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_CASE (VM_OC_PUSH_ARRAY):
         {
           /* Note: this operation cannot throw an exception */
           *stack_top_p++ = ecma_make_object_value (ecma_op_new_array_object (0));
           continue;
         }
-        case VM_OC_LOCAL_EVAL:
+        VM_CASE (VM_OC_LOCAL_EVAL):
         {
           ECMA_CLEAR_LOCAL_PARSE_OPTS ();
           uint8_t parse_opts = *byte_code_p++;
           ECMA_SET_LOCAL_PARSE_OPTS (parse_opts);
           continue;
         }
-        case VM_OC_SUPER_CALL:
+        VM_CASE (VM_OC_SUPER_CALL):
         {
           uint8_t arguments_list_len = *byte_code_p++;
 
@@ -1972,7 +2565,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_PUSH_CLASS_ENVIRONMENT:
+        VM_CASE (VM_OC_PUSH_CLASS_ENVIRONMENT):
         {
           uint16_t literal_index;
 
@@ -1980,12 +2573,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           opfunc_push_class_environment (frame_ctx_p, &stack_top_p, literal_start_p[literal_index]);
           continue;
         }
-        case VM_OC_PUSH_IMPLICIT_CTOR:
+        VM_CASE (VM_OC_PUSH_IMPLICIT_CTOR):
         {
           *stack_top_p++ = opfunc_create_implicit_class_constructor (opcode, frame_ctx_p->shared_p->bytecode_header_p);
           continue;
         }
-        case VM_OC_DEFINE_FIELD:
+        VM_CASE (VM_OC_DEFINE_FIELD):
         {
           result = opfunc_define_field (frame_ctx_p->this_binding, right_value, left_value);
 
@@ -1996,7 +2589,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_ASSIGN_PRIVATE:
+        VM_CASE (VM_OC_ASSIGN_PRIVATE):
         {
           result = opfunc_private_set (stack_top_p[-3], stack_top_p[-2], stack_top_p[-1]);
 
@@ -2026,7 +2619,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_FIELD_ADD:
+        VM_CASE (VM_OC_PRIVATE_FIELD_ADD):
         {
           result = opfunc_private_field_add (frame_ctx_p->this_binding, right_value, left_value);
 
@@ -2037,7 +2630,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_PROP_GET:
+        VM_CASE (VM_OC_PRIVATE_PROP_GET):
         {
           result = opfunc_private_get (left_value, right_value);
 
@@ -2049,7 +2642,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PRIVATE_PROP_REFERENCE:
+        VM_CASE (VM_OC_PRIVATE_PROP_REFERENCE):
         {
           result = opfunc_private_get (stack_top_p[-1], left_value);
 
@@ -2062,7 +2655,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_PRIVATE_IN:
+        VM_CASE (VM_OC_PRIVATE_IN):
         {
           result = opfunc_private_in (left_value, right_value);
 
@@ -2074,12 +2667,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_COLLECT_PRIVATE_PROPERTY:
+        VM_CASE (VM_OC_COLLECT_PRIVATE_PROPERTY):
         {
           opfunc_collect_private_properties (stack_top_p[-2], left_value, right_value, opcode);
           continue;
         }
-        case VM_OC_INIT_CLASS:
+        VM_CASE (VM_OC_INIT_CLASS):
         {
           result = opfunc_init_class (frame_ctx_p, stack_top_p);
 
@@ -2089,7 +2682,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FINALIZE_CLASS:
+        VM_CASE (VM_OC_FINALIZE_CLASS):
         {
           JERRY_ASSERT (opcode == CBC_EXT_FINALIZE_NAMED_CLASS || opcode == CBC_EXT_FINALIZE_ANONYMOUS_CLASS);
 
@@ -2103,7 +2696,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           opfunc_finalize_class (frame_ctx_p, &stack_top_p, left_value);
           continue;
         }
-        case VM_OC_SET_FIELD_INIT:
+        VM_CASE (VM_OC_SET_FIELD_INIT):
         {
           ecma_string_t *property_name_p = ecma_get_magic_string (LIT_INTERNAL_MAGIC_STRING_CLASS_FIELD_INIT);
           ecma_object_t *proto_object_p = ecma_get_object_from_value (stack_top_p[-1]);
@@ -2115,6 +2708,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_property_value_t *property_value_p =
             ecma_create_named_data_property (class_object_p, property_name_p, ECMA_PROPERTY_FIXED, NULL);
           property_value_p->value = left_value;
+          ECMA_GC_REMEMBER_VALUE (left_value);
 
           property_name_p = ecma_get_internal_string (LIT_INTERNAL_MAGIC_STRING_CLASS_FIELD_COMPUTED);
           ecma_property_t *property_p = ecma_find_named_property (class_object_p, property_name_p);
@@ -2130,7 +2724,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_RUN_FIELD_INIT:
+        VM_CASE (VM_OC_RUN_FIELD_INIT):
         {
           JERRY_ASSERT (frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_NON_ARROW_FUNC);
           result = opfunc_init_class_fields (frame_ctx_p->shared_p->function_object_p, frame_ctx_p->this_binding);
@@ -2141,7 +2735,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_RUN_STATIC_FIELD_INIT:
+        VM_CASE (VM_OC_RUN_STATIC_FIELD_INIT):
         {
           left_value = stack_top_p[-2];
           stack_top_p[-2] = stack_top_p[-1];
@@ -2155,7 +2749,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_SET_NEXT_COMPUTED_FIELD:
+        VM_CASE (VM_OC_SET_NEXT_COMPUTED_FIELD):
         {
           ecma_integer_value_t next_index = ecma_get_integer_from_value (stack_top_p[-2]) + 1;
           stack_top_p[-2] = ecma_make_integer_value (next_index);
@@ -2195,7 +2789,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (*(--stack_top_p));
           continue;
         }
-        case VM_OC_PUSH_SUPER_CONSTRUCTOR:
+        VM_CASE (VM_OC_PUSH_SUPER_CONSTRUCTOR):
         {
           result = ecma_op_function_get_super_constructor (vm_get_class_function (frame_ctx_p));
 
@@ -2207,7 +2801,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_RESOLVE_LEXICAL_THIS:
+        VM_CASE (VM_OC_RESOLVE_LEXICAL_THIS):
         {
           result = ecma_op_get_this_binding (frame_ctx_p->lex_env_p);
 
@@ -2219,7 +2813,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_OBJECT_LITERAL_HOME_ENV:
+        VM_CASE (VM_OC_OBJECT_LITERAL_HOME_ENV):
         {
           if (opcode == CBC_EXT_PUSH_OBJECT_SUPER_ENVIRONMENT)
           {
@@ -2239,14 +2833,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_SET_HOME_OBJECT:
+        VM_CASE (VM_OC_SET_HOME_OBJECT):
         {
           int offset = opcode == CBC_EXT_OBJECT_LITERAL_SET_HOME_OBJECT_COMPUTED ? -1 : 0;
           opfunc_set_home_object (ecma_get_object_from_value (stack_top_p[-1]),
                                   ecma_get_object_from_value (stack_top_p[-3 + offset]));
           continue;
         }
-        case VM_OC_SUPER_REFERENCE:
+        VM_CASE (VM_OC_SUPER_REFERENCE):
         {
           result = opfunc_form_super_reference (&stack_top_p, frame_ctx_p, left_value, opcode);
 
@@ -2257,7 +2851,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_SET_FUNCTION_NAME:
+        VM_CASE (VM_OC_SET_FUNCTION_NAME):
         {
           char *prefix_p = NULL;
           lit_utf8_size_t prefix_size = 0;
@@ -2325,12 +2919,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (left_value);
           continue;
         }
-        case VM_OC_PUSH_SPREAD_ELEMENT:
+        VM_CASE (VM_OC_PUSH_SPREAD_ELEMENT):
         {
           *stack_top_p++ = ECMA_VALUE_SPREAD_ELEMENT;
           continue;
         }
-        case VM_OC_PUSH_REST_OBJECT:
+        VM_CASE (VM_OC_PUSH_REST_OBJECT):
         {
           vm_frame_ctx_shared_t *shared_p = frame_ctx_p->shared_p;
 
@@ -2360,7 +2954,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_ITERATOR_CONTEXT_CREATE:
+        VM_CASE (VM_OC_ITERATOR_CONTEXT_CREATE):
         {
           result = ecma_op_get_iterator (stack_top_p[-1], ECMA_VALUE_SYNC_ITERATOR, &left_value);
 
@@ -2380,7 +2974,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_ITERATOR_STEP:
+        VM_CASE (VM_OC_ITERATOR_STEP):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
 
@@ -2417,7 +3011,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = value;
           continue;
         }
-        case VM_OC_ITERATOR_CONTEXT_END:
+        VM_CASE (VM_OC_ITERATOR_CONTEXT_END):
         {
           JERRY_ASSERT (VM_LAST_CONTEXT_END () == stack_top_p);
 
@@ -2436,7 +3030,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             vm_stack_context_abort_variable_length (frame_ctx_p, stack_top_p, PARSER_ITERATOR_CONTEXT_STACK_ALLOCATION);
           continue;
         }
-        case VM_OC_DEFAULT_INITIALIZER:
+        VM_CASE (VM_OC_DEFAULT_INITIALIZER):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
 
@@ -2449,7 +3043,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p--;
           continue;
         }
-        case VM_OC_REST_INITIALIZER:
+        VM_CASE (VM_OC_REST_INITIALIZER):
         {
           ecma_object_t *array_p = ecma_op_new_array_object (0);
           JERRY_ASSERT (ecma_op_object_is_fast_array (array_p));
@@ -2494,7 +3088,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (array_p);
           continue;
         }
-        case VM_OC_OBJ_INIT_CONTEXT_CREATE:
+        VM_CASE (VM_OC_OBJ_INIT_CONTEXT_CREATE):
         {
           left_value = stack_top_p[-1];
           vm_stack_context_type_t context_type = VM_CONTEXT_OBJ_INIT;
@@ -2519,7 +3113,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_OBJ_INIT_CONTEXT_END:
+        VM_CASE (VM_OC_OBJ_INIT_CONTEXT_END):
         {
           JERRY_ASSERT (stack_top_p == VM_LAST_CONTEXT_END ());
 
@@ -2533,7 +3127,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p = vm_stack_context_abort_variable_length (frame_ctx_p, stack_top_p, context_stack_allocation);
           continue;
         }
-        case VM_OC_OBJ_INIT_PUSH_REST:
+        VM_CASE (VM_OC_OBJ_INIT_PUSH_REST):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
           if (!ecma_op_require_object_coercible (last_context_end_p[-2]))
@@ -2560,7 +3154,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_INITIALIZER_PUSH_NAME:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_NAME):
         {
           if (JERRY_UNLIKELY (!ecma_is_value_prop_name (left_value)))
           {
@@ -2584,7 +3178,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_fast_array_set_property (array_obj_p, ext_array_obj_p->u.array.length, left_value);
           /* FALLTHRU */
         }
-        case VM_OC_INITIALIZER_PUSH_PROP:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_PROP):
         {
           ecma_value_t *last_context_end_p = VM_LAST_CONTEXT_END ();
           ecma_value_t base = last_context_end_p[-2];
@@ -2600,7 +3194,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             stack_top_p--;
           }
 
-          result = vm_op_get_value (base, left_value);
+          result = vm_op_get_value (base, left_value, byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2610,7 +3204,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_SPREAD_ARGUMENTS:
+        VM_CASE (VM_OC_SPREAD_ARGUMENTS):
         {
           uint8_t arguments_list_len = *byte_code_p++;
           stack_top_p -= arguments_list_len;
@@ -2631,7 +3225,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_CREATE_GENERATOR:
+        VM_CASE (VM_OC_CREATE_GENERATOR):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
@@ -2642,14 +3236,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           return ecma_make_object_value ((ecma_object_t *) executable_object_p);
         }
-        case VM_OC_YIELD:
+        VM_CASE (VM_OC_YIELD):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
           frame_ctx_p->stack_top_p = --stack_top_p;
           return *stack_top_p;
         }
-        case VM_OC_ASYNC_YIELD:
+        VM_CASE (VM_OC_ASYNC_YIELD):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2660,7 +3254,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = --stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ASYNC_YIELD_ITERATOR:
+        VM_CASE (VM_OC_ASYNC_YIELD_ITERATOR):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2700,7 +3294,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_AWAIT:
+        VM_CASE (VM_OC_AWAIT):
         {
           if (JERRY_UNLIKELY (!(frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_EXECUTABLE)))
           {
@@ -2718,7 +3312,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_GENERATOR_AWAIT:
+        VM_CASE (VM_OC_GENERATOR_AWAIT):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2734,7 +3328,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_EXT_RETURN:
+        VM_CASE (VM_OC_EXT_RETURN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
@@ -2748,7 +3342,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_ASYNC_EXIT:
+        VM_CASE (VM_OC_ASYNC_EXIT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2791,7 +3385,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->call_operation = VM_NO_EXEC_OP;
           return result;
         }
-        case VM_OC_STRING_CONCAT:
+        VM_CASE (VM_OC_STRING_CONCAT):
         {
           ecma_string_t *left_str_p = ecma_op_to_string (left_value);
 
@@ -2815,7 +3409,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_string_value (result_str_p);
           goto free_both_values;
         }
-        case VM_OC_GET_TEMPLATE_OBJECT:
+        VM_CASE (VM_OC_GET_TEMPLATE_OBJECT):
         {
           uint8_t tagged_idx = *byte_code_p++;
           ecma_collection_t *collection_p = ecma_compiled_code_get_tagged_template_collection (bytecode_header_p);
@@ -2824,7 +3418,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_copy_value (collection_p->buffer_p[tagged_idx]);
           continue;
         }
-        case VM_OC_PUSH_NEW_TARGET:
+        VM_CASE (VM_OC_PUSH_NEW_TARGET):
         {
           ecma_object_t *new_target_object_p = JERRY_CONTEXT (current_new_target_p);
           if (new_target_object_p == NULL)
@@ -2838,7 +3432,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_REQUIRE_OBJECT_COERCIBLE:
+        VM_CASE (VM_OC_REQUIRE_OBJECT_COERCIBLE):
         {
           if (!ecma_op_require_object_coercible (stack_top_p[-1]))
           {
@@ -2847,7 +3441,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_ASSIGN_SUPER:
+        VM_CASE (VM_OC_ASSIGN_SUPER):
         {
           result = opfunc_assign_super_reference (&stack_top_p, frame_ctx_p, opcode_data);
 
@@ -2857,12 +3451,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_PUSH_ELISON:
+        VM_CASE (VM_OC_PUSH_ELISON):
         {
           *stack_top_p++ = ECMA_VALUE_ARRAY_HOLE;
           continue;
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_CASE (VM_OC_APPEND_ARRAY):
         {
           uint16_t values_length = *byte_code_p++;
           stack_top_p -= values_length;
@@ -2880,7 +3474,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -2915,9 +3509,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_PROP_GET:
+        VM_CASE (VM_OC_PROP_GET):
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (left_value, right_value, byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2927,7 +3521,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -2951,12 +3545,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_CASE (VM_OC_PROP_PRE_INCR):
+        VM_CASE (VM_OC_PROP_PRE_DECR):
+        VM_CASE (VM_OC_PROP_POST_INCR):
+        VM_CASE (VM_OC_PROP_POST_DECR):
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (left_value, right_value, byte_code_start_p);
 
           if (opcode < CBC_PRE_INCR)
           {
@@ -2979,10 +3573,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = ECMA_VALUE_UNDEFINED;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_CASE (VM_OC_PRE_INCR):
+        VM_CASE (VM_OC_PRE_DECR):
+        VM_CASE (VM_OC_POST_INCR):
+        VM_CASE (VM_OC_POST_DECR):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
           ecma_number_t result_number;
@@ -3017,7 +3611,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 POST_INCREASE_DECREASE_PUT_RESULT (result);
               }
 
-              result = (ecma_value_t) (int_value + int_increase);
+              result = (ecma_value_t) (uint32_t) (int_value + int_increase);
               break;
             }
             result_number = (ecma_number_t) ecma_get_integer_from_value (result);
@@ -3102,13 +3696,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_CASE (VM_OC_ASSIGN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_MOV_IDENT:
+        VM_CASE (VM_OC_MOV_IDENT):
         {
           uint32_t literal_index;
 
@@ -3121,14 +3715,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           VM_GET_REGISTER (frame_ctx_p, literal_index) = left_value;
           continue;
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_CASE (VM_OC_ASSIGN_PROP):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_copy_value (frame_ctx_p->this_binding);
@@ -3136,7 +3730,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_RETURN_FUNCTION_END:
+        VM_CASE (VM_OC_RETURN_FUNCTION_END):
         {
           if (CBC_FUNCTION_GET_TYPE (bytecode_header_p->status_flags) == CBC_FUNCTION_SCRIPT)
           {
@@ -3150,7 +3744,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_RETURN:
+        VM_CASE (VM_OC_RETURN):
         {
           JERRY_ASSERT (opcode == CBC_RETURN || opcode == CBC_RETURN_WITH_LITERAL);
 
@@ -3158,7 +3752,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_CASE (VM_OC_THROW):
         {
           jcontext_raise_exception (left_value);
 
@@ -3166,12 +3760,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           result = ecma_raise_reference_error (ECMA_ERR_UNDEFINED_REFERENCE);
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_CASE (VM_OC_EVAL):
         {
           JERRY_CONTEXT (status_flags) |= ECMA_STATUS_DIRECT_EVAL;
           JERRY_ASSERT ((*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK)
@@ -3179,21 +3773,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                             && byte_code_p[1] <= CBC_EXT_SPREAD_CALL_PROP_BLOCK));
           continue;
         }
-        case VM_OC_CALL:
+        VM_CASE (VM_OC_CALL):
         {
           frame_ctx_p->call_operation = VM_EXEC_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_NEW:
+        VM_CASE (VM_OC_NEW):
         {
           frame_ctx_p->call_operation = VM_EXEC_CONSTRUCT;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ERROR:
+        VM_CASE (VM_OC_ERROR):
         {
           JERRY_ASSERT (frame_ctx_p->byte_code_p[1] == CBC_EXT_ERROR);
 #if JERRY_DEBUGGER
@@ -3203,7 +3797,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = ECMA_VALUE_ERROR;
           goto error;
         }
-        case VM_OC_RESOLVE_BASE_FOR_CALL:
+        VM_CASE (VM_OC_RESOLVE_BASE_FOR_CALL):
         {
           ecma_value_t this_value = stack_top_p[-3];
 
@@ -3221,7 +3815,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_PROP_DELETE:
+        VM_CASE (VM_OC_PROP_DELETE):
         {
           result = vm_op_delete_prop (left_value, right_value, is_strict);
 
@@ -3235,7 +3829,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DELETE:
+        VM_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -3259,12 +3853,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_JUMP:
+        VM_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3278,10 +3872,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (value);
           continue;
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
           ecma_value_t value = *(--stack_top_p);
@@ -3307,7 +3901,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_fast_free_value (value);
           continue;
         }
-        case VM_OC_POP_REFERENCE:
+        VM_CASE (VM_OC_POP_REFERENCE):
         {
           ecma_free_value (stack_top_p[-2]);
           ecma_free_value (stack_top_p[-3]);
@@ -3315,7 +3909,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p -= 2;
           continue;
         }
-        case VM_OC_BRANCH_IF_NULLISH:
+        VM_CASE (VM_OC_BRANCH_IF_NULLISH):
         {
           left_value = stack_top_p[-1];
 
@@ -3327,8 +3921,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           --stack_top_p;
           continue;
         }
-        case VM_OC_PLUS:
-        case VM_OC_MINUS:
+        VM_CASE (VM_OC_PLUS):
+        VM_CASE (VM_OC_MINUS):
         {
           result = opfunc_unary_operation (left_value, VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS);
 
@@ -3340,13 +3934,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_NOT:
+        VM_CASE (VM_OC_NOT):
         {
           *stack_top_p++ = ecma_make_boolean_value (!ecma_op_to_boolean (left_value));
           JERRY_ASSERT (ecma_is_value_boolean (stack_top_p[-1]));
           goto free_left_value;
         }
-        case VM_OC_BIT_NOT:
+        VM_CASE (VM_OC_BIT_NOT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3367,12 +3961,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_VOID:
+        VM_CASE (VM_OC_VOID):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           goto free_left_value;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -3406,7 +4000,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_CASE (VM_OC_TYPEOF):
         {
           result = opfunc_typeof (left_value);
 
@@ -3418,13 +4012,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_ADD:
+        VM_CASE (VM_OC_ADD):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer + right_integer));
+            VM_QUICKEN_ARITHMETIC (CBC_ADD, 0);
             continue;
           }
 
@@ -3435,6 +4030,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
+            VM_QUICKEN_ARITHMETIC (CBC_ADD, VM_OC_QUICKENED_DOUBLE_FLAG);
             continue;
           }
 
@@ -3444,6 +4040,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               ((ecma_number_t) ecma_get_integer_from_value (left_value) + ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
+            VM_QUICKEN_ARITHMETIC (CBC_ADD, VM_OC_QUICKENED_DOUBLE_FLAG);
             continue;
           }
 
@@ -3457,7 +4054,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_SUB:
+        VM_CASE (VM_OC_SUB):
         {
           JERRY_STATIC_ASSERT (ECMA_INTEGER_NUMBER_MAX * 2 <= INT32_MAX && ECMA_INTEGER_NUMBER_MIN * 2 >= INT32_MIN,
                                doubled_ecma_numbers_must_fit_into_int32_range);
@@ -3469,6 +4066,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
             *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer - right_integer));
+            VM_QUICKEN_ARITHMETIC (CBC_SUBTRACT, 0);
             continue;
           }
 
@@ -3479,6 +4077,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
+            VM_QUICKEN_ARITHMETIC (CBC_SUBTRACT, VM_OC_QUICKENED_DOUBLE_FLAG);
             continue;
           }
 
@@ -3488,6 +4087,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               ((ecma_number_t) ecma_get_integer_from_value (left_value) - ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
+            VM_QUICKEN_ARITHMETIC (CBC_SUBTRACT, VM_OC_QUICKENED_DOUBLE_FLAG);
             continue;
           }
 
@@ -3501,7 +4101,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MUL:
+        VM_CASE (VM_OC_MUL):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
@@ -3519,11 +4119,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 && left_integer != 0 && right_integer != 0)
             {
               *stack_top_p++ = ecma_integer_multiply (left_integer, right_integer);
+              VM_QUICKEN_ARITHMETIC (CBC_MULTIPLY, 0);
               continue;
             }
 
             ecma_number_t multiply = (ecma_number_t) left_integer * (ecma_number_t) right_integer;
             *stack_top_p++ = ecma_make_number_value (multiply);
+            VM_QUICKEN_ARITHMETIC (CBC_MULTIPLY, 0);
             continue;
           }
 
@@ -3534,6 +4136,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
+            VM_QUICKEN_ARITHMETIC (CBC_MULTIPLY, VM_OC_QUICKENED_DOUBLE_FLAG);
             continue;
           }
 
@@ -3543,6 +4146,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               ((ecma_number_t) ecma_get_integer_from_value (left_value) * ecma_get_float_from_value (right_value));
 
             *stack_top_p++ = ecma_update_float_number (right_value, new_value);
+            VM_QUICKEN_ARITHMETIC (CBC_MULTIPLY, VM_OC_QUICKENED_DOUBLE_FLAG);
             continue;
           }
 
@@ -3556,7 +4160,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DIV:
+        VM_CASE (VM_OC_DIV):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
@@ -3570,7 +4174,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MOD:
+        VM_CASE (VM_OC_MOD):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value) && !ECMA_IS_VALUE_ERROR (right_value));
 
@@ -3601,7 +4205,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_EXP:
+        VM_CASE (VM_OC_EXP):
         {
           result = do_number_arithmetic (NUMBER_ARITHMETIC_EXPONENTIATION, left_value, right_value);
 
@@ -3613,7 +4217,121 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_EQUAL:
+        VM_CASE (VM_OC_QUICKENED_ARITHMETIC):
+        {
+          uint32_t quickened_index = (uint32_t) (opcode - CBC_ADD_RIGHT_LITERAL_INT);
+          uint32_t operation = quickened_index >> 2;
+          uint16_t literal_index;
+
+          /* The operands are not copied, so nothing can be changed before the operand types are checked. */
+          if (quickened_index & VM_OC_QUICKENED_TWO_LITERALS_FLAG)
+          {
+            READ_LITERAL_INDEX (literal_index);
+            JERRY_ASSERT (literal_index < register_end
+                          || (literal_index >= ident_end && literal_index < const_literal_end));
+
+            left_value = (literal_index < register_end ? VM_GET_REGISTER (frame_ctx_p, literal_index)
+                                                       : literal_start_p[literal_index]);
+          }
+          else
+          {
+            JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
+            left_value = stack_top_p[-1];
+          }
+
+          READ_LITERAL_INDEX (literal_index);
+          JERRY_ASSERT (literal_index < register_end
+                        || (literal_index >= ident_end && literal_index < const_literal_end));
+
+          right_value = (literal_index < register_end ? VM_GET_REGISTER (frame_ctx_p, literal_index)
+                                                      : literal_start_p[literal_index]);
+
+          if (!(quickened_index & VM_OC_QUICKENED_DOUBLE_FLAG))
+          {
+            if (ecma_are_values_integer_numbers (left_value, right_value))
+            {
+              ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+              ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+              if (operation == 0)
+              {
+                result = ecma_make_int32_value ((int32_t) (left_integer + right_integer));
+              }
+              else if (operation == 1)
+              {
+                result = ecma_make_int32_value ((int32_t) (left_integer - right_integer));
+              }
+              else if (-ECMA_INTEGER_MULTIPLY_MAX <= left_integer && left_integer <= ECMA_INTEGER_MULTIPLY_MAX
+                       && -ECMA_INTEGER_MULTIPLY_MAX <= right_integer && right_integer <= ECMA_INTEGER_MULTIPLY_MAX
+                       && left_integer != 0 && right_integer != 0)
+              {
+                result = ecma_integer_multiply (left_integer, right_integer);
+              }
+              else
+              {
+                result = ecma_make_number_value ((ecma_number_t) left_integer * (ecma_number_t) right_integer);
+              }
+
+              if (quickened_index & VM_OC_QUICKENED_TWO_LITERALS_FLAG)
+              {
+                *stack_top_p++ = result;
+              }
+              else
+              {
+                stack_top_p[-1] = result;
+              }
+              continue;
+            }
+
+            /* Any other number operands switch the site to the double precision form. */
+            if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+            {
+              quickened_index |= VM_OC_QUICKENED_DOUBLE_FLAG;
+              *(uint8_t *) byte_code_start_p = (uint8_t) (CBC_ADD_RIGHT_LITERAL_INT + quickened_index);
+            }
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            ecma_number_t left_number = ecma_get_number_from_value (left_value);
+            ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+            if (operation == 0)
+            {
+              left_number += right_number;
+            }
+            else if (operation == 1)
+            {
+              left_number -= right_number;
+            }
+            else
+            {
+              left_number *= right_number;
+            }
+
+            if (quickened_index & VM_OC_QUICKENED_TWO_LITERALS_FLAG)
+            {
+              *stack_top_p++ = ecma_make_number_value (left_number);
+            }
+            else if (ecma_is_value_float_number (left_value))
+            {
+              /* The left operand is owned by the stack, so its storage can be reused. */
+              stack_top_p[-1] = ecma_update_float_number (left_value, left_number);
+            }
+            else
+            {
+              stack_top_p[-1] = ecma_make_number_value (left_number);
+            }
+            continue;
+          }
+
+          /* Deoptimize: restore the generic opcode and execute it again. */
+          *(uint8_t *) byte_code_start_p =
+            (uint8_t) (CBC_ADD_RIGHT_LITERAL + operation * 3 + (quickened_index & VM_OC_QUICKENED_TWO_LITERALS_FLAG));
+          byte_code_p = byte_code_start_p;
+          continue;
+        }
+        VM_CASE (VM_OC_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3625,7 +4343,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_NOT_EQUAL:
+        VM_CASE (VM_OC_NOT_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3637,7 +4355,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_invert_boolean_value (result);
           goto free_both_values;
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_CASE (VM_OC_STRICT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -3646,7 +4364,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -3655,7 +4373,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_OR:
+        VM_CASE (VM_OC_BIT_OR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3676,7 +4394,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_XOR:
+        VM_CASE (VM_OC_BIT_XOR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3697,7 +4415,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_AND:
+        VM_CASE (VM_OC_BIT_AND):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3718,7 +4436,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_CASE (VM_OC_LEFT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3742,7 +4460,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_CASE (VM_OC_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3765,7 +4483,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3788,7 +4506,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS:
+        VM_CASE (VM_OC_LESS):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3851,7 +4569,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER:
+        VM_CASE (VM_OC_GREATER):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3881,7 +4599,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS_EQUAL:
+        VM_CASE (VM_OC_LESS_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3911,7 +4629,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_CASE (VM_OC_GREATER_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3941,7 +4659,104 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_IN:
+        VM_CASE (VM_OC_BRANCH_IF_RELATION):
+        {
+          /* The relation is encoded in the position of the opcode group: less,
+           * greater, less equal, greater equal. Backward branches are taken
+           * when the relation is true, forward branches when it is false. */
+          uint32_t relation = ((uint32_t) (opcode - CBC_EXT_BRANCH_IF_LESS_BACKWARD) >> 2) & 0x3;
+          bool is_true;
+
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
+            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
+
+            switch (relation)
+            {
+              case 0:
+              {
+                is_true = left_integer < right_integer;
+                break;
+              }
+              case 1:
+              {
+                is_true = left_integer > right_integer;
+                break;
+              }
+              case 2:
+              {
+                is_true = left_integer <= right_integer;
+                break;
+              }
+              default:
+              {
+                is_true = left_integer >= right_integer;
+                break;
+              }
+            }
+          }
+          else
+          {
+            result = opfunc_relation (left_value, right_value, relation == 0 || relation == 3, relation >= 2);
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+
+            is_true = ecma_is_value_true (result);
+
+            ecma_fast_free_value (left_value);
+            ecma_fast_free_value (right_value);
+            left_value = ECMA_VALUE_UNDEFINED;
+            right_value = ECMA_VALUE_UNDEFINED;
+          }
+
+          branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
+          JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
+
+          if (is_true != ((opcode_data & VM_OC_BACKWARD_BRANCH) != 0))
+          {
+            byte_code_p += branch_offset_length;
+            continue;
+          }
+
+          branch_offset = *(byte_code_p++);
+
+          if (JERRY_UNLIKELY (branch_offset_length != 1))
+          {
+            branch_offset <<= 8;
+            branch_offset |= *(byte_code_p++);
+
+            if (JERRY_UNLIKELY (branch_offset_length == 3))
+            {
+              branch_offset <<= 8;
+              branch_offset |= *(byte_code_p++);
+            }
+          }
+
+          if (opcode_data & VM_OC_BACKWARD_BRANCH)
+          {
+#if JERRY_VM_HALT
+            if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
+            {
+              result = vm_call_halt_callback ();
+
+              if (ECMA_IS_VALUE_ERROR (result))
+              {
+                goto error;
+              }
+            }
+#endif /* JERRY_VM_HALT */
+
+            branch_offset = -branch_offset;
+          }
+
+          byte_code_p = byte_code_start_p + branch_offset;
+          continue;
+        }
+        VM_CASE (VM_OC_IN):
         {
           result = opfunc_in (left_value, right_value);
 
@@ -3953,7 +4768,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_INSTANCEOF:
+        VM_CASE (VM_OC_INSTANCEOF):
         {
           result = opfunc_instanceof (left_value, right_value);
 
@@ -3965,7 +4780,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BLOCK_CREATE_CONTEXT:
+        VM_CASE (VM_OC_BLOCK_CREATE_CONTEXT):
         {
           ecma_value_t *stack_context_top_p;
           stack_context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
@@ -4007,7 +4822,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_WITH:
+        VM_CASE (VM_OC_WITH):
         {
           ecma_value_t value = *(--stack_top_p);
           ecma_object_t *object_p;
@@ -4039,7 +4854,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = with_env_p;
           continue;
         }
-        case VM_OC_FOR_IN_INIT:
+        VM_CASE (VM_OC_FOR_IN_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4079,7 +4894,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
 
@@ -4088,14 +4903,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_IN);
 
-          uint32_t index = context_top_p[-3];
+          uint32_t index = (uint32_t) context_top_p[-3];
           ecma_value_t *buffer_p = collection_p->buffer_p;
 
           *stack_top_p++ = buffer_p[index];
           context_top_p[-3]++;
           continue;
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -4106,7 +4921,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_value_t *buffer_p = collection_p->buffer_p;
           ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-4]);
-          uint32_t index = stack_top_p[-3];
+          uint32_t index = (uint32_t) stack_top_p[-3];
 
           while (index < collection_p->item_count)
           {
@@ -4143,7 +4958,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FOR_OF_INIT:
+        VM_CASE (VM_OC_FOR_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4204,7 +5019,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FOR_OF_GET_NEXT:
+        VM_CASE (VM_OC_FOR_OF_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_OF
@@ -4215,7 +5030,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           context_top_p[-2] = ECMA_VALUE_UNDEFINED;
           continue;
         }
-        case VM_OC_FOR_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_OF);
@@ -4254,7 +5069,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_FOR_AWAIT_OF_INIT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4325,7 +5140,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           return result;
         }
-        case VM_OC_FOR_AWAIT_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_AWAIT_OF);
@@ -4356,7 +5171,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_TRY:
+        VM_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -4369,7 +5184,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
           continue;
         }
-        case VM_OC_CATCH:
+        VM_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
@@ -4378,7 +5193,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_FINALLY:
+        VM_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -4402,7 +5217,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-2] = (ecma_value_t) branch_offset;
           continue;
         }
-        case VM_OC_CONTEXT_END:
+        VM_CASE (VM_OC_CONTEXT_END):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!(stack_top_p[-1] & VM_CONTEXT_CLOSE_ITERATOR));
@@ -4450,7 +5265,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (context_type == VM_CONTEXT_FINALLY_JUMP);
 
-          uint32_t jump_target = *stack_top_p;
+          uint32_t jump_target = (uint32_t) *stack_top_p;
 
           vm_stack_found_type type =
             vm_stack_find_finally (frame_ctx_p, stack_top_p, VM_CONTEXT_FINALLY_JUMP, jump_target);
@@ -4487,7 +5302,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           continue;
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!jcontext_has_pending_exception ());
@@ -4530,7 +5345,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if JERRY_MODULE_SYSTEM
-        case VM_OC_MODULE_IMPORT:
+        VM_CASE (VM_OC_MODULE_IMPORT):
         {
           left_value = *(--stack_top_p);
 
@@ -4562,7 +5377,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_MODULE_IMPORT_META:
+        VM_CASE (VM_OC_MODULE_IMPORT_META):
         {
           ecma_value_t script_value = ((cbc_uint8_arguments_t *) bytecode_header_p)->script_value;
           cbc_script_t *script_p = ECMA_GET_INTERNAL_VALUE_POINTER (cbc_script_t, script_value);
@@ -4598,7 +5413,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
 #endif /* JERRY_MODULE_SYSTEM */
 #if JERRY_DEBUGGER
-        case VM_OC_BREAKPOINT_ENABLED:
+        VM_CASE (VM_OC_BREAKPOINT_ENABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
@@ -4619,7 +5434,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_BREAKPOINT_DISABLED:
+        VM_CASE (VM_OC_BREAKPOINT_DISABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
@@ -4672,7 +5487,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* JERRY_DEBUGGER */
-        case VM_OC_NONE:
+        VM_CASE (VM_OC_NONE):
         default:
         {
           JERRY_ASSERT (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_NONE);
@@ -4738,7 +5553,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_value_t set_value_result = vm_op_set_value (base, property, result, is_strict);
+          ecma_value_t set_value_result = vm_op_set_value (base, property, result, is_strict, byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (set_value_result))
           {
@@ -4973,6 +5788,7 @@ vm_init_module_scope (ecma_module_t *module_p) /**< module without scope */
   ((ecma_lexical_environment_class_t *) scope_p)->type = ECMA_LEX_ENV_CLASS_TYPE_MODULE;
 
   module_p->scope_p = scope_p;
+  ECMA_GC_REMEMBER_OBJECT (scope_p);
   ecma_deref_object (scope_p);
 
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
@@ -5090,6 +5906,7 @@ vm_init_module_scope (ecma_module_t *module_p) /**< module without scope */
 
         JERRY_ASSERT (property_value_p->value == ECMA_VALUE_UNDEFINED);
         property_value_p->value = ecma_make_object_value (function_obj_p);
+        ECMA_GC_REMEMBER_OBJECT (function_obj_p);
         ecma_deref_object (function_obj_p);
         break;
       }
@@ -5198,6 +6015,150 @@ vm_init_exec (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p;
 } /* vm_init_exec */
 
+#if JERRY_VM_STACKLESS
+
+/**
+ * Start a 'Function call' opcode without recursion: when the callee is a byte code
+ * function, its frame is allocated on the vm call stack and it is executed by the
+ * vm_execute loop of the caller.
+ *
+ * @return frame context of the callee - if the call is started
+ *         NULL - if the call must be performed by opfunc_call
+ */
+static vm_frame_ctx_t *
+vm_stackless_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context of the caller */
+{
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (status_flags) & ECMA_STATUS_DIRECT_EVAL))
+  {
+    return NULL;
+  }
+
+  uint8_t opcode = frame_ctx_p->byte_code_p[0];
+  uint32_t arguments_list_len;
+  vm_decode_call_arguments (frame_ctx_p, &arguments_list_len);
+
+  ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p - arguments_list_len;
+  ecma_value_t func_value = stack_top_p[-1];
+
+  if (!ecma_is_value_object (func_value))
+  {
+    return NULL;
+  }
+
+  ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
+
+  if (ecma_get_object_type (func_obj_p) != ECMA_OBJECT_TYPE_FUNCTION)
+  {
+    return NULL;
+  }
+
+  const ecma_compiled_code_t *bytecode_header_p =
+    ecma_op_function_get_compiled_code ((ecma_extended_object_t *) func_obj_p);
+
+#if JERRY_LAZY_FUNCTIONS
+  if (JERRY_UNLIKELY (bytecode_header_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+  {
+    /* The body is compiled by the first (recursive) call. */
+    return NULL;
+  }
+#endif /* JERRY_LAZY_FUNCTIONS */
+
+  switch (CBC_FUNCTION_GET_TYPE (bytecode_header_p->status_flags))
+  {
+    case CBC_FUNCTION_NORMAL:
+    case CBC_FUNCTION_ACCESSOR:
+    case CBC_FUNCTION_METHOD:
+    case CBC_FUNCTION_ARROW:
+    {
+      break;
+    }
+    default:
+    {
+      /* Constructors, generators and async functions are called recursively. */
+      return NULL;
+    }
+  }
+
+  size_t frame_size;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
+  }
+
+  size_t size = sizeof (vm_stackless_call_t) + sizeof (vm_frame_ctx_t) + frame_size * sizeof (ecma_value_t);
+  size = JERRY_ALIGNUP (size, JMEM_ALIGNMENT);
+
+  vm_stackless_call_t *call_p = (vm_stackless_call_t *) vm_call_stack_alloc ((uint32_t) size);
+
+  if (JERRY_UNLIKELY (call_p == NULL))
+  {
+    opfunc_call_finish (frame_ctx_p, ecma_raise_maximum_callstack_error ());
+    return frame_ctx_p;
+  }
+
+  call_p->size = (uint32_t) size;
+  call_p->saved_new_target_p = JERRY_CONTEXT (current_new_target_p);
+  JERRY_CONTEXT (current_new_target_p) = NULL;
+
+  bool is_call_prop = ((opcode - CBC_CALL) % 6) >= 3;
+  ecma_value_t this_value = is_call_prop ? stack_top_p[-3] : ECMA_VALUE_UNDEFINED;
+
+  this_value = ecma_op_function_prepare_simple_call (func_obj_p, this_value, &call_p->shared_args, &call_p->scope_p);
+  call_p->shared_args.header.status_flags |= VM_FRAME_CTX_SHARED_STACKLESS;
+  call_p->shared_args.arg_list_p = stack_top_p;
+  call_p->shared_args.arg_list_len = arguments_list_len;
+
+#if JERRY_BUILTIN_REALMS
+  call_p->saved_global_object_p = JERRY_CONTEXT (global_object_p);
+  JERRY_CONTEXT (global_object_p) = ecma_op_function_get_realm (bytecode_header_p);
+#endif /* JERRY_BUILTIN_REALMS */
+
+  vm_frame_ctx_t *callee_frame_ctx_p = (vm_frame_ctx_t *) (call_p + 1);
+
+  callee_frame_ctx_p->shared_p = &call_p->shared_args.header;
+  callee_frame_ctx_p->lex_env_p = call_p->scope_p;
+  callee_frame_ctx_p->this_binding = this_value;
+
+  vm_init_exec (callee_frame_ctx_p);
+  return callee_frame_ctx_p;
+} /* vm_stackless_call */
+
+/**
+ * Complete a call started by vm_stackless_call after the callee is finished.
+ *
+ * @return frame context of the caller
+ */
+static vm_frame_ctx_t *
+vm_stackless_return (vm_frame_ctx_t *frame_ctx_p, /**< frame context of the callee */
+                     ecma_value_t completion_value) /**< result of the callee */
+{
+  vm_stackless_call_t *call_p = (vm_stackless_call_t *) frame_ctx_p->shared_p;
+  vm_frame_ctx_t *caller_frame_ctx_p = frame_ctx_p->prev_context_p;
+
+  JERRY_ASSERT ((vm_frame_ctx_t *) (call_p + 1) == frame_ctx_p);
+
+#if JERRY_BUILTIN_REALMS
+  JERRY_CONTEXT (global_object_p) = call_p->saved_global_object_p;
+#endif /* JERRY_BUILTIN_REALMS */
+
+  ecma_op_function_finish_simple_call (&call_p->shared_args.header, call_p->scope_p, frame_ctx_p->this_binding);
+  JERRY_CONTEXT (current_new_target_p) = call_p->saved_new_target_p;
+
+  vm_call_stack_free (call_p, call_p->size);
+
+  opfunc_call_finish (caller_frame_ctx_p, completion_value);
+  return caller_frame_ctx_p;
+} /* vm_stackless_return */
+
+#endif /* JERRY_VM_STACKLESS */
+
 /**
  * Resume execution of a code block.
  *
@@ -5214,6 +6175,16 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     {
       case VM_EXEC_CALL:
       {
+#if JERRY_VM_STACKLESS
+        vm_frame_ctx_t *callee_frame_ctx_p = vm_stackless_call (frame_ctx_p);
+
+        if (callee_frame_ctx_p != NULL)
+        {
+          frame_ctx_p = callee_frame_ctx_p;
+          break;
+        }
+#endif /* JERRY_VM_STACKLESS */
+
         opfunc_call (frame_ctx_p);
         break;
       }
@@ -5229,6 +6200,9 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       }
       case VM_EXEC_RETURN:
       {
+#if JERRY_VM_STACKLESS
+        JERRY_ASSERT (!(frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_STACKLESS));
+#endif /* JERRY_VM_STACKLESS */
         return completion_value;
       }
       case VM_EXEC_CONSTRUCT:
@@ -5269,6 +6243,15 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* JERRY_DEBUGGER */
 
         JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p->prev_context_p;
+
+#if JERRY_VM_STACKLESS
+        if (frame_ctx_p->shared_p->status_flags & VM_FRAME_CTX_SHARED_STACKLESS)
+        {
+          frame_ctx_p = vm_stackless_return (frame_ctx_p, completion_value);
+          break;
+        }
+#endif /* JERRY_VM_STACKLESS */
+
         return completion_value;
       }
     }
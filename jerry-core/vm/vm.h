@@ -188,6 +188,7 @@ typedef enum
   VM_OC_DIV, /**< div */
   VM_OC_MOD, /**< mod */
   VM_OC_EXP, /**< exponentiation */
+  VM_OC_QUICKENED_ARITHMETIC, /**< quickened add, sub or mul */
 
   VM_OC_EQUAL, /**< equal */
   VM_OC_NOT_EQUAL, /**< not equal */
@@ -197,6 +198,7 @@ typedef enum
   VM_OC_GREATER, /**< greater */
   VM_OC_LESS_EQUAL, /**< less equal */
   VM_OC_GREATER_EQUAL, /**< greater equal */
+  VM_OC_BRANCH_IF_RELATION, /**< compare two literals and branch */
   VM_OC_IN, /**< in */
   VM_OC_INSTANCEOF, /**< instanceof */
 
@@ -353,6 +355,16 @@ typedef enum
  */
 #define VM_OC_LOGICAL_BRANCH_FLAG 0x2
 
+/**
+ * Both operands of a quickened opcode are literals.
+ */
+#define VM_OC_QUICKENED_TWO_LITERALS_FLAG 0x1
+
+/**
+ * Quickened opcode which computes the result in double precision.
+ */
+#define VM_OC_QUICKENED_DOUBLE_FLAG 0x2
+
 /**
  * Bit index shift for non-static property initializers.
  */
@@ -165,6 +165,7 @@ typedef enum
   OPT_GENERATE_STATIC,
   OPT_GENERATE_SHOW_OP,
   OPT_GENERATE_FUNCTION,
+  OPT_GENERATE_OPTIMIZE,
   OPT_GENERATE_OUT,
   OPT_IMPORT_LITERAL_LIST
 } generate_opt_id_t;
@@ -185,6 +186,7 @@ static const cli_opt_t generate_opts[] = {
                .meta = "FILE",
                .help = "import literals from list format (for static snapshots)"),
   CLI_OPT_DEF (.id = OPT_GENERATE_SHOW_OP, .longopt = "show-opcodes", .help = "print generated opcodes"),
+  CLI_OPT_DEF (.id = OPT_GENERATE_OPTIMIZE, .longopt = "optimize", .help = "optimize the byte code"),
   CLI_OPT_DEF (.id = OPT_GENERATE_OUT,
                .opt = "o",
                .meta = "FILE",
@@ -212,6 +214,7 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
   size_t source_length = 0;
   const char *literals_file_name_p = NULL;
   const char *function_args_p = NULL;
+  bool optimize = false;
 
   cli_change_opts (cli_state_p, generate_opts);
 
@@ -248,6 +251,11 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
         }
         break;
       }
+      case OPT_GENERATE_OPTIMIZE:
+      {
+        optimize = true;
+        break;
+      }
       case OPT_GENERATE_OUT:
       {
         output_file_name_p = cli_consume_string (cli_state_p);
@@ -336,6 +344,12 @@ process_generate (cli_state_t *cli_state_p, /**< cli state */
 
   jerry_parse_options_t parse_options;
   parse_options.options = JERRY_PARSE_HAS_SOURCE_NAME;
+
+  if (optimize)
+  {
+    parse_options.options |= JERRY_PARSE_OPTIMIZE;
+  }
+
   /* To avoid cppcheck warning. */
   parse_options.argument_list = 0;
   parse_options.source_name =
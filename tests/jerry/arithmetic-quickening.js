@@ -0,0 +1,94 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* The operand types of the same operations change between calls. */
+
+function add (a, b) {
+  return a + b;
+}
+
+function sub (a) {
+  return a - 0.25;
+}
+
+function mul (a, b) {
+  return a * b;
+}
+
+assert (add (1, 2) === 3);
+assert (add (1, 2) === 3);
+assert (add (1.5, 2) === 3.5);
+assert (add (0.5, 0.5) === 1);
+assert (add ("a", 2) === "a2");
+assert (add (2, "b") === "2b");
+assert (add (1, 2) === 3);
+assert (add (1073741823, 1073741823) === 2147483646);
+assert (add (2147483647, 1) === 2147483648);
+assert (add (-0, -0) === 0 && 1 / add (-0, -0) === -Infinity);
+assert (add (1.5, 1.5) === 3);
+
+assert (sub (1) === 0.75);
+assert (sub (1.25) === 1);
+assert (sub ("3") === 2.75);
+assert (isNaN (sub (undefined)));
+assert (sub (1) === 0.75);
+
+assert (mul (3, 4) === 12);
+assert (mul (0, -1) === 0 && 1 / mul (0, -1) === -Infinity);
+assert (mul (3, 4) === 12);
+assert (mul (1e10, 1e10) === 1e20);
+assert (mul (1.5, 2) === 3);
+assert (mul (1.5, 1.5) === 2.25);
+assert (mul (3, 4) === 12);
+
+var value_of_calls = 0;
+var object = {
+  valueOf: function () {
+    value_of_calls++;
+    return 7;
+  }
+};
+
+assert (mul (object, 2) === 14);
+assert (value_of_calls === 1);
+assert (add (object, 1) === 8);
+assert (value_of_calls === 2);
+assert (mul (3, 4) === 12);
+
+function loop (n, x) {
+  var s = 0.5, t = 0, u = 1;
+
+  for (var i = 0; i < n; i++) {
+    s = s * x + i;
+    t = t + i;
+    u = u * 3;
+  }
+
+  return [s, t, u];
+}
+
+var result = loop (10, 1.5);
+assert (result[0] === 235.49267578125);
+assert (result[1] === 45);
+assert (result[2] === 59049);
+
+result = loop (40, 1);
+assert (result[0] === 780.5);
+assert (result[1] === 780);
+assert (result[2] === 12157665459056928801);
+
+result = loop (3, "2");
+assert (result[0] === 8);
+assert (result[1] === 3);
+assert (result[2] === 27);
@@ -0,0 +1,156 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Calls between byte code functions are executed by the same vm loop. */
+
+function fact (n) {
+  return n <= 1 ? 1 : n * fact (n - 1);
+}
+
+assert (fact (10) === 3628800);
+
+function depth (n) {
+  return n === 0 ? 0 : 1 + depth (n - 1);
+}
+
+assert (depth (50) === 50);
+
+/* Argument handling. */
+function args (a, b, c) {
+  return arguments.length + ":" + a + ":" + b + ":" + c;
+}
+
+assert (args () === "0:undefined:undefined:undefined");
+assert (args (1, 2) === "2:1:2:undefined");
+assert (args (1, 2, 3, 4) === "4:1:2:3");
+
+function closure (x) {
+  return function () { return x; };
+}
+
+var getters = [];
+for (var i = 0; i < 5; i++) {
+  getters.push (closure (i * 2));
+}
+assert (getters[3] () === 6);
+
+/* This binding. */
+function sloppyThis () {
+  return this;
+}
+
+function strictThis () {
+  "use strict";
+  return this;
+}
+
+assert (sloppyThis () === this);
+assert (strictThis () === undefined);
+assert (typeof sloppyThis.call (5) === "object");
+assert (strictThis.call (5) === 5);
+
+var obj = {
+  value: 7,
+  method: function () { return this.value; },
+  shorthand () { return this.method () + 1; },
+  arrow: function () { var f = () => this.value; return f (); }
+};
+
+assert (obj.method () === 7);
+assert (obj.shorthand () === 8);
+assert (obj.arrow () === 7);
+
+function Target () {
+  var f = () => new.target;
+  return f ();
+}
+
+assert (new Target () === Target);
+assert (Target () === undefined);
+
+/* Errors propagate through the frames and can be caught at any level. */
+function thrower (n) {
+  if (n === 0) {
+    throw new Error ("bottom");
+  }
+  return thrower (n - 1);
+}
+
+function catcher (n) {
+  try {
+    return thrower (n);
+  } catch (e) {
+    return e.message;
+  } finally {
+    obj.value++;
+  }
+}
+
+assert (catcher (20) === "bottom");
+assert (obj.value === 8);
+
+/* Native boundaries in the middle of the call chain. */
+function mapDepth (n) {
+  if (n === 0) {
+    return [0];
+  }
+  return [n].map (function (v) { return v + mapDepth (n - 1)[0]; });
+}
+
+assert (mapDepth (20)[0] === 210);
+
+function* gen (n) {
+  yield sloppyThis () === this;
+  yield depth (n);
+}
+
+var it = gen (5);
+assert (it.next ().value === true);
+assert (it.next ().value === 5);
+
+class Cls {
+  constructor () {
+    this.x = depth (3);
+  }
+}
+
+assert (new Cls ().x === 3);
+
+try {
+  Cls ();
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+function evalCaller (v) {
+  return eval ("v + 1");
+}
+
+assert (evalCaller (1) === 2);
+
+/* Unbounded recursion throws a catchable error. */
+function infinite () {
+  return infinite () + 1;
+}
+
+try {
+  infinite ();
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+assert (depth (100) === 100);
@@ -0,0 +1,151 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* The functions below are compiled on their first call when lazy compilation is enabled. */
+
+var outer = 10;
+
+function add (a, b) {
+  return a + b;
+}
+
+assert (add.length === 2);
+assert (add.name === "add");
+assert (add (1, 2) === 3);
+assert (add (3, 4) === 7);
+
+function make_counter (start) {
+  var count = start;
+
+  function step (delta) {
+    count += delta;
+    return count + outer;
+  }
+
+  return step;
+}
+
+var counter = make_counter (5);
+assert (counter.name === "step");
+assert (counter.length === 1);
+assert (counter (1) === 16);
+assert (counter (2) === 18);
+assert (make_counter (0) (0) === 10);
+
+function fact (n) {
+  return n <= 1 ? 1 : n * fact (n - 1);
+}
+
+assert (fact (10) === 3628800);
+
+var named = function self (n) {
+  return n > 0 ? self (n - 1) + 1 : 0;
+};
+
+assert (named.name === "self");
+assert (named (5) === 5);
+
+function strict_this () {
+  "use strict";
+  return this;
+}
+
+assert (strict_this () === undefined);
+
+function inherited_strict () {
+  "use strict";
+
+  function inner () {
+    return this;
+  }
+
+  return inner ();
+}
+
+assert (inherited_strict () === undefined);
+
+function sloppy_this () {
+  return this;
+}
+
+assert (sloppy_this () === this);
+
+function count_arguments (a) {
+  a = 5;
+  return arguments.length * 100 + arguments[0];
+}
+
+assert (count_arguments (1, 2, 3) === 305);
+
+function duplicated (a, a) {
+  return a;
+}
+
+assert (duplicated (1, 2) === 2);
+
+function Point (x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+Point.prototype.sum = function () {
+  return this.x + this.y;
+};
+
+var point = new Point (3, 4);
+assert (point instanceof Point);
+assert (point.sum () === 7);
+
+function with_eval (code) {
+  var local = 3;
+  return eval (code);
+}
+
+assert (with_eval ("local + outer") === 13);
+
+function block_scoped (n) {
+  let result = [];
+
+  for (let i = 0; i < n; i++) {
+    result.push (function () {
+      return i;
+    });
+  }
+
+  return result[0] () + result[n - 1] ();
+}
+
+assert (block_scoped (4) === 3);
+
+function throws (message) {
+  throw new Error (message);
+}
+
+try {
+  throws ("lazy");
+  assert (false);
+} catch (e) {
+  assert (e instanceof Error);
+  assert (e.message === "lazy");
+}
+
+function unicode_body () {
+  return "árvíztűrő 😀".length;
+}
+
+assert (unicode_body () === 12);
+
+var source = "function add (a, b) {\n  return a + b;\n}";
+var to_string = add.toString ();
+assert (to_string === source || to_string === "function () { /* ecmascript */ }");
@@ -0,0 +1,62 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Long chains are marked through the mark stack. */
+var head = null;
+for (var i = 0; i < 5000; i++) {
+  head = { next: head, value: i };
+}
+
+/* The chain is reversed, so each object refers to an older one. */
+var reversed = null;
+while (head !== null) {
+  var next = head.next;
+  head.next = reversed;
+  reversed = head;
+  head = next;
+}
+
+gc();
+
+var expected = 0;
+for (var node = reversed; node !== null; node = node.next) {
+  assert(node.value === expected);
+  expected++;
+}
+assert(expected === 5000);
+
+/* Wide and deep trees of arrays. */
+function build (depth) {
+  if (depth === 0) {
+    return [depth];
+  }
+  return [build(depth - 1), build(depth - 1), depth];
+}
+
+var tree = build(10);
+
+for (var i = 0; i < 10; i++) {
+  var garbage = build(6);
+  garbage = null;
+  gc();
+}
+
+function count (node) {
+  if (node.length === 1) {
+    return 1;
+  }
+  return count(node[0]) + count(node[1]) + 1;
+}
+assert(count(tree) === 2047);
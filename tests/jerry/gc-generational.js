@@ -0,0 +1,62 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Young objects which are only referenced by old objects must survive. */
+var old_objects = [];
+for (var i = 0; i < 64; i++) {
+  old_objects.push({ index: i });
+}
+
+function Node (value) {
+  this.value = value;
+}
+
+for (var round = 0; round < 200; round++) {
+  for (var i = 0; i < old_objects.length; i++) {
+    var holder = old_objects[i];
+    holder.child = new Node (round);
+    holder.list = [new Node (round + 1), { value: round + 2 }];
+
+    Object.defineProperty (holder, "getter", { get: function () { return round; }, configurable: true });
+  }
+
+  /* Short-lived garbage. */
+  for (var j = 0; j < 100; j++) {
+    var tmp = { a: [j], b: new Node (j) };
+  }
+}
+
+for (var i = 0; i < old_objects.length; i++) {
+  var holder = old_objects[i];
+  assert (holder.index === i);
+  assert (holder.child instanceof Node);
+  assert (holder.child.value === 199);
+  assert (holder.list[0].value === 200);
+  assert (holder.list[1].value === 201);
+  assert (typeof Object.getOwnPropertyDescriptor (holder, "getter").get === "function");
+}
+
+/* Closures capture young environments. */
+var closures = [];
+for (var i = 0; i < 100; i++) {
+  closures.push ((function (value) {
+    var captured = { value: value };
+    return function () { return captured.value; };
+  }) (i));
+}
+
+for (var i = 0; i < 100; i++) {
+  assert (closures[i] () === i);
+}
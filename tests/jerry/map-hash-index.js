@@ -0,0 +1,129 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Large containers are searched through a hash index. */
+var m = new Map();
+var objects = [];
+var count = 1000;
+
+for (var i = 0; i < count; i++) {
+  var obj = {};
+  objects.push(obj);
+  m.set(i, i * 2);
+  m.set("key" + i, i);
+  m.set(obj, i);
+}
+
+assert(m.size === 3 * count);
+
+for (var i = 0; i < count; i++) {
+  assert(m.get(i) === i * 2);
+  assert(m.get(i + 0.5) === undefined);
+  assert(m.get("key" + i) === i);
+  assert(m.get(objects[i]) === i);
+  assert(!m.has({}));
+}
+
+/* Integers and equal doubles are the same keys. */
+m.set(2.5 * 2, 10);
+assert(m.get(5) === 10);
+assert(m.size === 3 * count);
+
+/* SameValueZero semantics. */
+m.set(-0, "zero");
+assert(m.get(0) === "zero");
+assert(m.get(+0) === "zero");
+m.set(NaN, "nan");
+assert(m.get(0 / 0) === "nan");
+assert(m.get(Number("x")) === "nan");
+
+var sym = Symbol("s");
+m.set(sym, "symbol");
+assert(m.get(sym) === "symbol");
+assert(m.get(Symbol("s")) === undefined);
+
+m.set(12345678901234567890n, "bigint");
+assert(m.get(12345678901234567890n) === "bigint");
+assert(m.get(12345678901234567891n) === undefined);
+assert(m.get(-12345678901234567890n) === undefined);
+m.set(0n, "bigint zero");
+assert(m.get(0n) === "bigint zero");
+
+/* Deleted entries are removed from the index while the insertion order is kept. */
+for (var i = 0; i < count; i += 2) {
+  assert(m.delete(i));
+  assert(!m.has(i));
+  assert(!m.delete(i));
+}
+
+for (var i = 1; i < count; i += 2) {
+  assert(m.get(i) === i * 2);
+}
+
+var expected = 1;
+for (var entry of m) {
+  if (typeof entry[0] === "number" && expected < count) {
+    assert(entry[0] === expected);
+    expected += 2;
+  }
+}
+assert(expected === count + 1);
+
+/* Deleting and reinserting keeps the map consistent. */
+for (var round = 0; round < 5; round++) {
+  for (var i = 0; i < count; i++) {
+    m.delete("key" + i);
+    m.set("key" + i, round);
+  }
+}
+
+for (var i = 0; i < count; i++) {
+  assert(m.get("key" + i) === 4);
+}
+
+/* Iterators created before a clear see the new entries. */
+var iter = m.keys();
+m.clear();
+assert(m.size === 0);
+assert(m.get(1) === undefined);
+
+for (var i = 0; i < 100; i++) {
+  m.set(i, i);
+}
+assert(iter.next().value === 0);
+assert(m.get(99) === 99);
+
+var s = new Set();
+for (var i = 0; i < count; i++) {
+  s.add("v" + (i % 100));
+}
+assert(s.size === 100);
+assert(s.has("v99"));
+assert(!s.has("v100"));
+
+var ws = new WeakSet();
+var wm = new WeakMap();
+for (var i = 0; i < count; i++) {
+  ws.add(objects[i]);
+  wm.set(objects[i], i);
+}
+
+for (var i = 0; i < count; i++) {
+  assert(ws.has(objects[i]));
+  assert(wm.get(objects[i]) === i);
+}
+
+assert(!ws.has({}));
+objects = undefined;
@@ -0,0 +1,48 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* NaN values with arbitrary payloads must be handled as any other NaN. */
+
+var words = new Uint32Array (2);
+var doubles = new Float64Array (words.buffer);
+
+words[0] = 0xffffffff;
+words[1] = 0xffffffff;
+
+var nan = doubles[0];
+assert (isNaN (nan));
+assert (nan !== nan);
+assert (typeof nan === "number");
+
+var object = { value: nan };
+assert (isNaN (object.value + 1));
+assert (isNaN (object.value * 2.5));
+assert (String (object.value) === "NaN");
+
+doubles[0] = nan;
+assert (isNaN (doubles[0]));
+
+words[0] = 0;
+words[1] = 0x80000000;
+assert (1 / doubles[0] === -Infinity);
+
+var values = [0.5, -0.5, 1e300, -1e-300, Infinity, -Infinity, 2147483648.5];
+var copies = values.slice ();
+
+for (var i = 0; i < values.length; i++) {
+  assert (copies[i] === values[i]);
+  doubles[0] = values[i];
+  assert (doubles[0] === values[i]);
+}
@@ -0,0 +1,165 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function Point (x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+function check_keys (object, expected) {
+  var keys = Object.keys (object);
+  assert (keys.length === expected.length);
+
+  for (var i = 0; i < keys.length; i++) {
+    assert (keys[i] === expected[i]);
+  }
+}
+
+/* Objects with the same layout. */
+var points = [];
+
+for (var i = 0; i < 100; i++) {
+  points.push (new Point (i, i * 2));
+}
+
+for (var i = 0; i < 100; i++) {
+  assert (points[i].x === i);
+  assert (points[i].y === i * 2);
+  check_keys (points[i], ["x", "y"]);
+}
+
+/* Layouts which differ only in the last property. */
+var a = { first: 1, second: 2 };
+var b = { first: 3, third: 4 };
+
+assert (a.second === 2 && a.third === undefined);
+assert (b.third === 4 && b.second === undefined);
+check_keys (a, ["first", "second"]);
+check_keys (b, ["first", "third"]);
+
+/* Integer keys come first, other keys keep their creation order. */
+var o = {};
+o.b = 1;
+o[2] = 2;
+o.a = 3;
+o[1] = 4;
+o[Symbol.iterator] = 5;
+check_keys (o, ["1", "2", "b", "a"]);
+assert (Object.getOwnPropertySymbols (o)[0] === Symbol.iterator);
+
+/* Deleting a property. */
+var d = new Point (5, 6);
+d.z = 7;
+assert (delete d.y);
+assert (d.y === undefined && d.x === 5 && d.z === 7);
+check_keys (d, ["x", "z"]);
+d.y = 8;
+check_keys (d, ["x", "z", "y"]);
+assert (points[3].y === 6);
+
+/* Many properties. */
+var big = {};
+
+for (var i = 0; i < 200; i++) {
+  big["p" + i] = i;
+}
+
+for (var i = 0; i < 200; i++) {
+  assert (big["p" + i] === i);
+}
+
+assert (Object.keys (big).length === 200);
+assert (Object.keys (big)[100] === "p100");
+
+/* Many different layouts created from the same layout. */
+var objects = [];
+
+for (var i = 0; i < 200; i++) {
+  var obj = { base: i };
+  obj["key" + i] = i;
+  objects.push (obj);
+}
+
+for (var i = 0; i < 200; i++) {
+  assert (objects[i].base === i);
+  assert (objects[i]["key" + i] === i);
+  assert (objects[i]["key" + (i + 1)] === undefined);
+  check_keys (objects[i], ["base", "key" + i]);
+}
+
+/* Accessors and property attributes. */
+var counter = 0;
+var acc = { value: 1 };
+
+Object.defineProperty (acc, "getter", {
+  get: function () { return ++counter; },
+  enumerable: true,
+  configurable: true
+});
+
+assert (acc.getter === 1 && acc.getter === 2);
+Object.defineProperty (acc, "value", { writable: false });
+acc.value = 5;
+assert (acc.value === 1);
+
+var frozen = Object.freeze (new Point (1, 2));
+frozen.x = 10;
+frozen.z = 3;
+assert (frozen.x === 1 && frozen.z === undefined);
+assert (Object.isFrozen (frozen));
+
+var p = new Point (1, 2);
+assert (!Object.isFrozen (p));
+p.x = 10;
+assert (p.x === 10);
+
+Object.defineProperty (p, "x", { get: function () { return 42; } });
+assert (p.x === 42);
+check_keys (p, ["x", "y"]);
+
+/* Property accesses from the same instruction with different layouts. */
+function get_x (obj) {
+  return obj.x;
+}
+
+var sum = 0;
+var layouts = [new Point (1, 2), { y: 0, x: 2 }, { a: 0, b: 0, x: 3 }, { x: 4 }, Object.create ({ x: 5 })];
+
+for (var i = 0; i < 100; i++) {
+  sum += get_x (layouts[i % layouts.length]);
+}
+
+assert (sum === 300);
+
+/* Objects with internal properties. */
+var key = {};
+key.a = 1;
+var map = new WeakMap ();
+map.set (key, 2);
+key.b = 3;
+assert (map.get (key) === 2 && key.a === 1 && key.b === 3);
+check_keys (key, ["a", "b"]);
+
+/* Class prototypes. */
+class C {
+  method () { return 1; }
+  get prop () { return 2; }
+}
+
+assert (new C ().method () === 1 && new C ().prop === 2);
+assert (Object.keys (C.prototype).length === 0);
+
+/* JSON round trip. */
+var json = JSON.parse ('{"a":1,"b":{"c":2},"d":[3]}');
+assert (JSON.stringify (json) === '{"a":1,"b":{"c":2},"d":[3]}');
@@ -0,0 +1,130 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+function get_x (obj) {
+  return obj.x;
+}
+
+function set_x (obj, value) {
+  obj.x = value;
+}
+
+var obj = { x: 1, y: 2 };
+
+for (var i = 0; i < 10; i++) {
+  assert(get_x(obj) === 1);
+}
+
+/* Updates are visible through the cached property slot. */
+for (var i = 0; i < 10; i++) {
+  set_x(obj, i);
+  assert(get_x(obj) === i);
+}
+
+/* Adding properties does not move the cached slot. */
+for (var i = 0; i < 50; i++) {
+  obj["p" + i] = i;
+  assert(get_x(obj) === 9);
+}
+
+/* Deleted properties must not be read from the cache. */
+delete obj.x;
+assert(get_x(obj) === undefined);
+
+Object.prototype.x = "proto";
+assert(get_x(obj) === "proto");
+delete Object.prototype.x;
+assert(get_x(obj) === undefined);
+
+obj.x = 5;
+assert(get_x(obj) === 5);
+
+/* Data property redefined as an accessor. */
+var getter_calls = 0;
+Object.defineProperty(obj, "x", { get: function () { getter_calls++; return "getter"; }, configurable: true });
+assert(get_x(obj) === "getter");
+assert(get_x(obj) === "getter");
+assert(getter_calls === 2);
+
+Object.defineProperty(obj, "x", { value: 6, writable: true, configurable: true });
+assert(get_x(obj) === 6);
+assert(get_x(obj) === 6);
+
+/* Read-only properties must not be written through the cache. */
+var frozen = { x: 1 };
+set_x(frozen, 2);
+set_x(frozen, 3);
+assert(get_x(frozen) === 3);
+Object.freeze(frozen);
+set_x(frozen, 4);
+assert(get_x(frozen) === 3);
+
+try {
+  (function () {
+    "use strict";
+    frozen.x = 5;
+  })();
+  assert(false);
+} catch (e) {
+  assert(e instanceof TypeError);
+}
+
+/* The same instruction accesses the properties of many objects. */
+var objects = [];
+for (var i = 0; i < 100; i++) {
+  objects.push({ x: i });
+}
+
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < objects.length; i++) {
+    assert(get_x(objects[i]) === i + round);
+    set_x(objects[i], i + round + 1);
+  }
+}
+
+/* Computed property names. */
+var computed = { a: 1, b: 2, c: 3 };
+var names = ["a", "b", "c", "a", "b", "c"];
+var sum = 0;
+for (var i = 0; i < names.length; i++) {
+  sum += computed[names[i]];
+}
+assert(sum === 12);
+
+/* Freed objects and properties must not be reached through the cache. */
+for (var i = 0; i < 20; i++) {
+  var tmp = { x: i };
+  assert(get_x(tmp) === i);
+  set_x(tmp, i + 1);
+  assert(get_x(tmp) === i + 1);
+  tmp = null;
+  gc();
+}
+
+/* Setters of arrays and arguments objects. */
+var arr = [1, 2, 3];
+function set_length (obj, value) {
+  obj.length = value;
+}
+set_length(arr, 2);
+set_length(arr, 1);
+assert(arr.length === 1 && arr[1] === undefined);
+
+function mapped (a) {
+  arguments[0] = 7;
+  arguments[0] = 8;
+  return a;
+}
+assert(mapped(1) === 8);
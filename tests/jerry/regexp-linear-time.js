@@ -0,0 +1,79 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check_match (result, expected) {
+  if (expected === null) {
+    assert (result === null);
+    return;
+  }
+
+  assert (result.length === expected.length);
+
+  for (var i = 0; i < expected.length; i++) {
+    assert (result[i] === expected[i]);
+  }
+}
+
+var input = "";
+
+for (var i = 0; i < 40; i++) {
+  input += "a";
+}
+
+/* Patterns with exponential backtracking. */
+check_match (/(a+)+$/.exec (input + "b"), null);
+check_match (/(a|aa)+c/.exec (input + "b"), null);
+check_match (/^(a*)*b/.exec (input), null);
+check_match (/(a+)+b/.exec (input + "b"), [input + "b", input]);
+check_match (/(\w+\s?)+$/.exec (input + "!"), null);
+assert (input.replace (/(a|a)+x/g, "-") === input);
+
+/* Captures. */
+check_match (/(a)|(b)/.exec ("xb"), ["b", undefined, "b"]);
+check_match (/(a+?)(b*)/.exec ("aaabbb"), ["a", "a", ""]);
+check_match (/(?:(a)|b)+/.exec ("abab"), ["abab", undefined]);
+check_match (/(z)((a+)?(b+)?(c))*/.exec ("zaacbbbcac"), ["zaacbbbcac", "z", "ac", "a", undefined, "c"]);
+check_match (/^(?:a|ab)(?:c|bcd)(d*)$/.exec ("abcd"), ["abcd", ""]);
+check_match (/(a*)*/.exec ("b"), ["", undefined]);
+check_match (/(a*)+/.exec ("b"), ["", ""]);
+check_match (/(a*?)+/.exec ("aa"), ["aa", "a"]);
+check_match (/(?:a?(?:|b))*/.exec ("ab"), ["ab"]);
+check_match (/(?:a?(?:|b)c?)*/.exec ("abcab"), ["abcab"]);
+
+/* Quantifiers. */
+check_match (/a{2,3}/.exec ("aaaa"), ["aaa"]);
+check_match (/a{2,3}?/.exec ("aaaa"), ["aa"]);
+check_match (/(ab){2}c/.exec ("abababc"), ["ababc", "ab"]);
+check_match (/x*y+$/m.exec ("xy\nxxy"), ["xy"]);
+
+/* Assertions, classes and flags. */
+check_match (/\bfoo\b/.exec ("a foo b"), ["foo"]);
+check_match (/[^a-c]+/.exec ("abcdefa"), ["def"]);
+check_match ("aBc".match (/b/i), ["B"]);
+check_match (/^.$/u.exec ("😀"), ["😀"]);
+check_match (/é(x)/.exec ("aéx"), ["éx", "x"]);
+assert ("xaxbx".replace (/x/g, "-") === "-a-b-");
+
+var sticky = /a/y;
+sticky.lastIndex = 1;
+check_match (sticky.exec ("ba"), ["a"]);
+assert (sticky.lastIndex === 2);
+sticky.lastIndex = 0;
+check_match (sticky.exec ("ba"), null);
+assert (sticky.lastIndex === 0);
+
+/* Backreferences and lookaheads are matched by backtracking. */
+check_match (/(a)\1/.exec ("xaa"), ["aa", "a"]);
+check_match (/(?=(a+))a*b\1/.exec ("baaabac"), ["aba", "a"]);
+check_match (/(?!a)\w/.exec ("ab"), ["b"]);
@@ -0,0 +1,95 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check_match (result, expected, index) {
+  if (expected === null) {
+    assert (result === null);
+    return;
+  }
+
+  assert (result.length === expected.length);
+  assert (result.index === index);
+
+  for (var i = 0; i < expected.length; i++) {
+    assert (result[i] === expected[i]);
+  }
+}
+
+var log = "";
+
+for (var i = 0; i < 50; i++) {
+  log += "INFO: request " + i + " done\n";
+}
+
+/* Literal prefixes. */
+check_match (/ERROR: (\d+)/.exec (log + "ERROR: 42\n"), ["ERROR: 42", "42"], log.length);
+check_match (/ERROR: (\d+)/.exec (log), null);
+check_match (/ERROR|WARN/.exec (log + "WARN"), ["WARN"], log.length);
+check_match (/abc/.exec ("ababababc"), ["abc"], 6);
+check_match (/éx/.exec ("eéeéx"), ["éx"], 3);
+check_match (/😀a/.exec ("😀😀a"), ["😀a"], 2);
+check_match (/😀a/u.exec ("😀😀a"), ["😀a"], 2);
+assert (log.replace (/request 4/g, "-").length === log.length - 11 * 8);
+
+/* First characters. */
+check_match (/[xy]\d/.exec ("abcy1"), ["y1"], 3);
+check_match (/\d+/.exec ("abc 123"), ["123"], 4);
+check_match (/\s\w/.exec ("abc d"), [" d"], 3);
+check_match (/\s\w/.exec ("abc\uFEFFd"), ["\uFEFFd"], 3);
+check_match (/[à-ÿ]+/.exec ("abcéè"), ["éè"], 3);
+check_match (/(?:b|c)+d/.exec ("aaabcd"), ["bcd"], 3);
+check_match (/a?b/.exec ("ccb"), ["b"], 2);
+check_match (/(?=a)\w/.exec ("bba"), ["a"], 2);
+check_match (/[^a]/.exec ("aab"), ["b"], 2);
+check_match (/x*/.exec ("abc"), [""], 0);
+
+/* Ignore case. */
+check_match (/hello/i.exec ("say HeLLo"), ["HeLLo"], 4);
+check_match (/[k-m]/i.exec ("abcK"), ["K"], 3);
+check_match (/k/iu.exec ("ab\u212A"), ["\u212A"], 2);
+check_match (/s/iu.exec ("ab\u017F"), ["\u017F"], 2);
+check_match (/\u212A/iu.exec ("abk"), ["k"], 2);
+check_match (/k/i.exec ("ab\u212A"), null);
+check_match (/é/i.exec ("abÉ"), ["É"], 2);
+
+/* Surrogates. */
+check_match (/\uDE00/.exec ("a😀"), ["\uDE00"], 2);
+check_match (/\uDE00/u.exec ("a😀"), null);
+check_match (/\uDE00/u.exec ("a\uDE00"), ["\uDE00"], 1);
+check_match (/[\uD800-\uDFFF]/u.exec ("ab\uD83D"), ["\uD83D"], 2);
+
+/* Anchored patterns. */
+check_match (/^abc/.exec ("xabc"), null);
+check_match (/^abc|^x/.exec ("xabc"), ["x"], 0);
+check_match (/^abc/m.exec ("x\nabc"), ["abc"], 2);
+check_match (/^a|b/.exec ("cb"), ["b"], 1);
+
+var anchored = /^a/g;
+anchored.lastIndex = 1;
+check_match (anchored.exec ("aa"), null);
+assert (anchored.lastIndex === 0);
+
+/* Global and sticky flags. */
+var global = /ab/g;
+global.lastIndex = 1;
+check_match (global.exec ("abxab"), ["ab"], 3);
+assert (global.lastIndex === 5);
+check_match (global.exec ("abxab"), null);
+assert (global.lastIndex === 0);
+
+var sticky = /ab/y;
+sticky.lastIndex = 1;
+check_match (sticky.exec ("xabab"), ["ab"], 1);
+check_match (sticky.exec ("xabxab"), null);
+assert ("a,b;c".split (/[,;]/).join () === "a,b,c");
@@ -0,0 +1,57 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Repeated concatenation creates rope strings, which are flattened on access. */
+var s = "";
+var t = "";
+for (var i = 0; i < 2000; i++) {
+  s += "<td>" + i + "</td>";
+  t = t + "<td>" + i + "</td>";
+}
+
+assert (s.length === t.length);
+assert (s === t);
+assert (s.charAt (4) === "0");
+assert (s.charCodeAt (s.length - 1) === 62);
+assert (s.indexOf ("<td>1999</td>") === s.length - 13);
+assert (s.substring (0, 9) === "<td>0</td");
+
+/* Ropes as property names. */
+var obj = {};
+obj[s] = 1;
+assert (obj[t] === 1);
+
+/* Non-ascii parts. */
+var u = "é".repeat (300);
+var v = u + "€";
+var w = u + "€";
+assert (v === w);
+assert (v.length === 301);
+assert (v.charCodeAt (300) === 0x20ac);
+assert (v.slice (-2) === "é€");
+
+/* Prepending and nested ropes. */
+var x = "y".repeat (300);
+var prefix = x;
+for (var i = 0; i < 100; i++) {
+  prefix = i + prefix;
+  x = x + (x.length % 10);
+}
+assert (prefix.length === 300 + 190);
+assert (x.length === 400);
+
+var joined = [s, x, s].join ("|");
+assert (joined.length === 2 * s.length + x.length + 2);
+assert (JSON.parse (JSON.stringify (s)) === s);
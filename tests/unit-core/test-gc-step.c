@@ -0,0 +1,190 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Kinds of tracked objects
+ */
+typedef enum
+{
+  TRACKED_GARBAGE, /**< object which is dropped by the script */
+  TRACKED_LIVE, /**< object which is kept alive by the script */
+  TRACKED_WEAK_TARGET, /**< object which is only referenced by a WeakRef */
+} tracked_kind_t;
+
+static int garbage_freed = 0;
+static int live_freed = 0;
+static bool weak_target_freed = false;
+
+static void
+tracked_free_cb (void *native_p, /**< native pointer */
+                 jerry_object_native_info_t *info_p) /**< native info */
+{
+  (void) info_p;
+
+  switch ((tracked_kind_t) (uintptr_t) native_p)
+  {
+    case TRACKED_GARBAGE:
+    {
+      garbage_freed++;
+      break;
+    }
+    case TRACKED_LIVE:
+    {
+      live_freed++;
+      break;
+    }
+    default:
+    {
+      TEST_ASSERT ((tracked_kind_t) (uintptr_t) native_p == TRACKED_WEAK_TARGET);
+      weak_target_freed = true;
+      break;
+    }
+  }
+} /* tracked_free_cb */
+
+static const jerry_object_native_info_t tracked_info = {
+  .free_cb = tracked_free_cb,
+  .number_of_references = 0,
+  .offset_of_references = 0,
+};
+
+static jerry_value_t
+tracked_handler (const jerry_call_info_t *call_info_p, /**< call information */
+                 const jerry_value_t args_p[], /**< arguments list */
+                 const jerry_length_t args_count) /**< arguments length */
+{
+  (void) call_info_p;
+  TEST_ASSERT (args_count == 1 && jerry_value_is_number (args_p[0]));
+
+  uintptr_t kind = (uintptr_t) jerry_value_as_number (args_p[0]);
+  jerry_value_t object = jerry_object ();
+  jerry_object_set_native_ptr (object, &tracked_info, (void *) kind);
+
+  jerry_value_t alive = jerry_boolean (true);
+  jerry_value_free (jerry_object_set_sz (object, "alive", alive));
+  jerry_value_free (alive);
+  return object;
+} /* tracked_handler */
+
+static void
+register_function (const char *name_p, /**< name of the function */
+                   jerry_external_handler_t handler) /**< function handler */
+{
+  jerry_value_t global = jerry_current_realm ();
+  jerry_value_t function = jerry_function_external (handler);
+  jerry_value_free (jerry_object_set_sz (global, name_p, function));
+  jerry_value_free (function);
+  jerry_value_free (global);
+} /* register_function */
+
+static void
+run_script (const char *source_p) /**< source code */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_exception (result));
+  jerry_value_free (result);
+} /* run_script */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  register_function ("tracked", tracked_handler);
+
+  bool has_weakref = jerry_feature_enabled (JERRY_FEATURE_WEAKREF);
+
+  run_script ("var live = [];\n"
+              "var pending = [];\n"
+              "var moved = [];\n"
+              "for (var i = 0; i < 1000; i++) {\n"
+              "  live.push(tracked(1));\n"
+              "  pending.push({ value: tracked(1) });\n"
+              "}\n"
+              "function mutate() {\n"
+              "  var item = pending.pop();\n"
+              "  if (item) {\n"
+              "    moved.push({ value: item.value });\n"
+              "    item.value = null;\n"
+              "  }\n"
+              "  live.push(tracked(1));\n"
+              "  tracked(0);\n"
+              "}\n");
+
+  if (has_weakref)
+  {
+    run_script ("var weak_target = tracked(2);\n"
+                "var weak = new WeakRef(weak_target);\n"
+                "function check_weak() {\n"
+                "  var target = weak.deref();\n"
+                "  if (target !== undefined && target.alive !== true) throw new Error();\n"
+                "}\n");
+  }
+
+  /* The garbage is freed before the target of the WeakRef, since the white objects
+   * are swept in reverse allocation order. */
+  run_script ("var garbage = [];\n"
+              "for (var i = 0; i < 1000; i++) {\n"
+              "  garbage.push(tracked(0));\n"
+              "}\n"
+              "garbage = null;\n"
+              "weak_target = null;\n");
+
+  /* Each step is followed by the script moving objects between the heap and the stack. */
+  int steps = 0;
+
+  while (!jerry_heap_gc_step (0))
+  {
+    run_script ("mutate()");
+
+    /* The sweep phase has started: the target must not be returned after it is found unreachable. */
+    if (has_weakref && garbage_freed > 0)
+    {
+      run_script ("check_weak()");
+    }
+
+    steps++;
+    TEST_ASSERT (steps < 100000);
+  }
+
+  TEST_ASSERT (live_freed == 0);
+  TEST_ASSERT (garbage_freed >= 1000);
+  TEST_ASSERT (weak_target_freed == has_weakref);
+
+  run_script ("for (var i = 0; i < live.length; i++) {\n"
+              "  if (live[i].alive !== true) throw new Error();\n"
+              "}\n"
+              "for (var i = 0; i < moved.length; i++) {\n"
+              "  if (moved[i].value.alive !== true) throw new Error();\n"
+              "}\n"
+              "pending = [];\n");
+
+  /* A full collection finishes the incremental cycle first. */
+  jerry_heap_gc_step (0);
+  jerry_heap_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (garbage_freed == 1000 + steps);
+  TEST_ASSERT (live_freed == (steps < 1000 ? 1000 - steps : 0));
+
+  jerry_cleanup ();
+
+  TEST_ASSERT (live_freed == 2000 + steps);
+  return 0;
+} /* main */
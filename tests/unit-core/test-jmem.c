@@ -103,6 +103,57 @@ main (void)
     jmem_heap_free_block (block4_p, BASIC_SIZE * 2);
   }
 
+  {
+#if JERRY_MEM_STATS
+    jmem_heap_stats_t stats_before;
+    jmem_heap_get_stats (&stats_before);
+#endif /* JERRY_MEM_STATS */
+
+    /* Small blocks are kept in bins, large ones in a tree. */
+    size_t sizes[] = { 8, 40, BASIC_SIZE * 5 };
+    uint8_t *blocks_p[BASIC_SIZE];
+
+    for (size_t i = 0; i < BASIC_SIZE; i++)
+    {
+      blocks_p[i] = (uint8_t *) jmem_heap_alloc_block (sizes[i % 3]);
+      memset (blocks_p[i], (int) i, sizes[i % 3]);
+    }
+
+    for (size_t i = 0; i < BASIC_SIZE; i += 2)
+    {
+      jmem_heap_free_block (blocks_p[i], sizes[i % 3]);
+    }
+
+    /* The holes are reused by exact fits. */
+    for (size_t i = 0; i < BASIC_SIZE; i += 2)
+    {
+      blocks_p[i] = (uint8_t *) jmem_heap_alloc_block (sizes[i % 3]);
+      memset (blocks_p[i], (int) i, sizes[i % 3]);
+    }
+
+    for (size_t i = 1; i < BASIC_SIZE; i += 2)
+    {
+      TEST_ASSERT (blocks_p[i][0] == i && blocks_p[i][sizes[i % 3] - 1] == i);
+      jmem_heap_free_block (blocks_p[i], sizes[i % 3]);
+    }
+
+    for (size_t i = 0; i < BASIC_SIZE; i += 2)
+    {
+      TEST_ASSERT (blocks_p[i][0] == i && blocks_p[i][sizes[i % 3] - 1] == i);
+      jmem_heap_free_block (blocks_p[i], sizes[i % 3]);
+    }
+
+#if JERRY_MEM_STATS
+    /* Every free block is merged with its free neighbours. */
+    jmem_heap_stats_t stats_after;
+    jmem_heap_get_stats (&stats_after);
+
+    TEST_ASSERT (stats_after.free_bytes == stats_before.free_bytes);
+    TEST_ASSERT (stats_after.free_region_count == stats_before.free_region_count);
+    TEST_ASSERT (stats_after.largest_free_region_bytes == stats_before.largest_free_region_bytes);
+#endif /* JERRY_MEM_STATS */
+  }
+
   ecma_finalize ();
   jmem_finalize ();
 
@@ -129,6 +129,18 @@ main (void)
     TEST_ASSERT (ecma_find_or_create_literal_string (NULL, 0, false) != JMEM_CP_NULL);
   }
 
+  /* Float literals are shared by their binary representation. */
+  ecma_value_t nan_lit1 = ecma_find_or_create_literal_number (ecma_number_make_nan ());
+  ecma_value_t nan_lit2 = ecma_find_or_create_literal_number (ecma_number_make_nan ());
+  TEST_ASSERT (ecma_is_value_float_number (nan_lit1));
+  TEST_ASSERT (nan_lit1 == nan_lit2);
+
+  ecma_value_t minus_zero_lit1 = ecma_find_or_create_literal_number (-0.0);
+  ecma_value_t minus_zero_lit2 = ecma_find_or_create_literal_number (-0.0);
+  TEST_ASSERT (ecma_is_value_float_number (minus_zero_lit1));
+  TEST_ASSERT (minus_zero_lit1 == minus_zero_lit2);
+  TEST_ASSERT (minus_zero_lit1 != nan_lit1);
+
   ecma_finalize_lit_storage ();
   jmem_finalize ();
   return 0;
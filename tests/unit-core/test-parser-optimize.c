@@ -0,0 +1,126 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "config.h"
+#include "test-common.h"
+
+static jerry_value_t
+run_script (const char *source_p, /**< source code */
+            uint32_t options) /**< parse options */
+{
+  jerry_parse_options_t parse_options;
+  parse_options.options = options;
+
+  jerry_value_t script = jerry_parse ((const jerry_char_t *) source_p, strlen (source_p), &parse_options);
+  TEST_ASSERT (!jerry_value_is_exception (script));
+
+  jerry_value_t result = jerry_run (script);
+  jerry_value_free (script);
+  return result;
+} /* run_script */
+
+static void
+compare_results (const char *source_p, /**< source code */
+                 const char *expected_p) /**< expected result */
+{
+  jerry_value_t expected = jerry_string_sz (expected_p);
+  jerry_value_t result = run_script (source_p, JERRY_PARSE_NO_OPTS);
+  jerry_value_t optimized_result = run_script (source_p, JERRY_PARSE_OPTIMIZE);
+
+  TEST_ASSERT (jerry_value_is_string (result));
+  TEST_ASSERT (jerry_value_is_string (optimized_result));
+
+  jerry_value_t compare = jerry_binary_op (JERRY_BIN_OP_STRICT_EQUAL, result, expected);
+  TEST_ASSERT (jerry_value_is_true (compare));
+  jerry_value_free (compare);
+
+  compare = jerry_binary_op (JERRY_BIN_OP_STRICT_EQUAL, optimized_result, expected);
+  TEST_ASSERT (jerry_value_is_true (compare));
+  jerry_value_free (compare);
+
+  jerry_value_free (optimized_result);
+  jerry_value_free (result);
+  jerry_value_free (expected);
+} /* compare_results */
+
+static jerry_value_t
+vm_exec_stop_callback (void *user_p)
+{
+  int *int_p = (int *) user_p;
+
+  if (*int_p > 0)
+  {
+    (*int_p)--;
+    return jerry_undefined ();
+  }
+
+  return jerry_string_sz ("Abort script");
+} /* vm_exec_stop_callback */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Constant folding. */
+  compare_results ("String ((2 + 3) * 4 - 6 / 3 + (7 % 4) + (1 << 4) + (-8 >> 1) + (-8 >>> 28))", "48");
+  compare_results ("String ([1 / (0 * -1), 1 / (-0 - 0), 1 / (0 - 0), (0 / 0) | 3])", "-Infinity,-Infinity,Infinity,3");
+  compare_results ("String ([1 + 'a', 2 * '3', 0.1 + 0.2])", "1a,6,0.30000000000000004");
+  compare_results ("var x = 5; String (x * (2 + 3) + (x - 1) * 2)", "33");
+
+  /* Dead stores. */
+  compare_results ("function f (a) { var dead = 5; var b = a + 1; b = a + 2; return b; } String (f (1))", "3");
+  compare_results ("function f (a) { var b = 1; if (a) { b = 2; } return b; } String ([f (0), f (1)])", "1,2");
+
+  /* Jump threading and fused relational branches. */
+  compare_results ("function f (n) { var s = 0; for (var i = 0; i < n; i++) { s += i; } return s; } String (f (100))",
+                   "4950");
+  compare_results ("function f (n) { var s = 0; for (var i = n; i >= 0; i--) { s += i; } return s; } String (f (10))",
+                   "55");
+  compare_results ("function f (a, b) {\n"
+                   "  var r = '';\n"
+                   "  if (a < b) r += 'l'; else r += '-';\n"
+                   "  if (a > b) r += 'g'; else r += '-';\n"
+                   "  if (a <= b) r += 'L'; else r += '-';\n"
+                   "  if (a >= b) r += 'G'; else r += '-';\n"
+                   "  return r;\n"
+                   "}\n"
+                   "String ([f (1, 2), f (2, 1), f (1, 1), f (NaN, 1), f ('a', 'b'), f ('b', 'a'), f (1.5, 1)])",
+                   "l-L-,-g-G,--LG,----,l-L-,-g-G,-g-G");
+  compare_results ("function f (x) { var n = 0; while (x < 5 ? true : false) { x++; n++; if (n > 10) break; } return n; }"
+                   "String ([f (0), f (10)])",
+                   "5,0");
+  compare_results ("function f (o) { var n = 0; do { n++; } while (n < o.limit); return n; } String (f ({ limit: 3 }))",
+                   "3");
+
+  /* Halt callbacks must be called by the fused backward branches as well. */
+  if (jerry_feature_enabled (JERRY_FEATURE_VM_EXEC_STOP))
+  {
+    int countdown = 6;
+    jerry_halt_handler (16, vm_exec_stop_callback, &countdown);
+
+    jerry_value_t result = run_script ("function f () { var i = 0; while (i < 1) { i = 0; } } f ()", JERRY_PARSE_OPTIMIZE);
+    TEST_ASSERT (countdown == 0);
+    TEST_ASSERT (jerry_value_is_exception (result));
+    jerry_value_free (result);
+  }
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
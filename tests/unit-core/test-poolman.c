@@ -32,10 +32,13 @@ const uint32_t test_iters = 1024;
 
 /* Subiterations count. */
 #define TEST_MAX_SUB_ITERS 1024
-#define TEST_CHUNK_SIZE    8
+
+/* Chunk size of each size class is used, and one which is served by the heap. */
+#define TEST_MAX_CHUNK_SIZE (JMEM_POOLS_MAX_SIZE + 4)
+#define TEST_CHUNK_SIZE(j)  (((j) % (JMEM_POOLS_CLASS_COUNT + 1)) * JMEM_ALIGNMENT + 4)
 
 uint8_t *ptrs[TEST_MAX_SUB_ITERS];
-uint8_t data[TEST_MAX_SUB_ITERS][TEST_CHUNK_SIZE];
+uint8_t data[TEST_MAX_SUB_ITERS][TEST_MAX_CHUNK_SIZE];
 
 int
 main (void)
@@ -50,16 +53,16 @@ main (void)
 
     for (size_t j = 0; j < subiters; j++)
     {
-      ptrs[j] = (uint8_t *) jmem_pools_alloc (TEST_CHUNK_SIZE);
+      ptrs[j] = (uint8_t *) jmem_pools_alloc (TEST_CHUNK_SIZE (j));
 
       if (ptrs[j] != NULL)
       {
-        for (size_t k = 0; k < TEST_CHUNK_SIZE; k++)
+        for (size_t k = 0; k < TEST_CHUNK_SIZE (j); k++)
         {
           ptrs[j][k] = (uint8_t) (rand () % 256);
         }
 
-        memcpy (data[j], ptrs[j], TEST_CHUNK_SIZE);
+        memcpy (data[j], ptrs[j], TEST_CHUNK_SIZE (j));
       }
     }
 
@@ -74,9 +77,9 @@ main (void)
 
       if (ptrs[j] != NULL)
       {
-        TEST_ASSERT (!memcmp (data[j], ptrs[j], TEST_CHUNK_SIZE));
+        TEST_ASSERT (!memcmp (data[j], ptrs[j], TEST_CHUNK_SIZE (j)));
 
-        jmem_pools_free (ptrs[j], TEST_CHUNK_SIZE);
+        jmem_pools_free (ptrs[j], TEST_CHUNK_SIZE (j));
       }
     }
   }
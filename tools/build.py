@@ -126,6 +126,8 @@ def get_arguments():
                          help='enable function toString (%(choices)s)')
     coregrp.add_argument('--line-info', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='provide line info (%(choices)s)')
+    coregrp.add_argument('--lazy-functions', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='compile function bodies on their first call (%(choices)s)')
     coregrp.add_argument('--logging', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable logging (%(choices)s)')
     coregrp.add_argument('--mem-heap', metavar='SIZE', type=int,
@@ -134,8 +136,12 @@ def get_arguments():
                          help='memory usage limit to trigger garbage collection (in bytes)')
     coregrp.add_argument('--stack-limit', metavar='SIZE', type=int,
                          help='maximum stack usage (in kilobytes)')
+    coregrp.add_argument('--regexp-step-limit', metavar='COUNT', type=int,
+                         help='maximum number of RegExp backtracking steps')
     coregrp.add_argument('--gc-mark-limit', metavar='SIZE', type=int,
                          help='maximum depth of recursion during GC mark phase')
+    coregrp.add_argument('--gc-mark-stack-size', metavar='SIZE', type=int,
+                         help='number of objects in a segment of the GC mark stack')
     coregrp.add_argument('--mem-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable memory statistics (%(choices)s)'))
     coregrp.add_argument('--mem-stress-test', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -162,6 +168,8 @@ def get_arguments():
                          help='enable VM execution stop callback (%(choices)s)')
     coregrp.add_argument('--vm-throw', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable VM throw callback (%(choices)s)')
+    coregrp.add_argument('--vm-threaded-dispatch', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable threaded dispatch in the VM loop (%(choices)s)')
 
     maingrp = parser.add_argument_group('jerry-main options')
     maingrp.add_argument('--link-map', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -215,10 +223,12 @@ def generate_build_options(arguments):
     build_options_append('JERRY_PARSER', arguments.js_parser)
     build_options_append('JERRY_FUNCTION_TO_STRING', arguments.function_to_string)
     build_options_append('JERRY_LINE_INFO', arguments.line_info)
+    build_options_append('JERRY_LAZY_FUNCTIONS', arguments.lazy_functions)
     build_options_append('JERRY_LOGGING', arguments.logging)
     build_options_append('JERRY_GLOBAL_HEAP_SIZE', arguments.mem_heap)
     build_options_append('JERRY_GC_LIMIT', arguments.gc_limit)
     build_options_append('JERRY_STACK_LIMIT', arguments.stack_limit)
+    build_options_append('JERRY_REGEXP_STEP_LIMIT', arguments.regexp_step_limit)
     build_options_append('JERRY_MEM_STATS', arguments.mem_stats)
     build_options_append('JERRY_MEM_GC_BEFORE_EACH_ALLOC', arguments.mem_stress_test)
     build_options_append('JERRY_PROFILE', arguments.profile)
@@ -232,10 +242,14 @@ def generate_build_options(arguments):
     build_options_append('JERRY_VALGRIND', arguments.valgrind)
     build_options_append('JERRY_VM_HALT', arguments.vm_exec_stop)
     build_options_append('JERRY_VM_THROW', arguments.vm_throw)
+    build_options_append('JERRY_VM_THREADED_DISPATCH', arguments.vm_threaded_dispatch)
 
     if arguments.gc_mark_limit is not None:
         build_options.append(f'-DJERRY_GC_MARK_LIMIT={arguments.gc_mark_limit}')
 
+    if arguments.gc_mark_stack_size is not None:
+        build_options.append(f'-DJERRY_GC_MARK_STACK_SIZE={arguments.gc_mark_stack_size}')
+
     # jerry-main options
     build_options_append('ENABLE_LINK_MAP', arguments.link_map)
     build_options_append('ENABLE_COMPILE_COMMANDS', arguments.compile_commands)